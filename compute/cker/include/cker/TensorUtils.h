@@ -21,7 +21,9 @@
 #include "cker/Types.h"
 #include "cker/PortableTensorUtils.h"
 #include "cker/NeonTensorUtils.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/x86_check.h"
 
 #include <cstring>
 #include <cmath>
@@ -31,55 +33,80 @@ namespace nnfw
 namespace cker
 {
 
-void VectorBatchVectorAssign(const float *vector, int v_size, int n_batch, float *batch_vector)
+inline void VectorBatchVectorAssign(const float *vector, int v_size, int n_batch,
+                                    float *batch_vector)
 {
   PortableVectorBatchVectorAssign(vector, v_size, n_batch, batch_vector);
 }
 
-bool IsZeroVector(const float *vector, int v_size)
+inline bool IsZeroVector(const float *vector, int v_size)
 {
   return NEON_OR_PORTABLE(IsZeroVector, vector, v_size);
 }
 
-void ApplyActivationToVector(const float *vector, int v_size,
-                             FusedActivationFunctionType activation, float *result)
+inline void ApplyActivationToVector(const float *vector, int v_size,
+                                    FusedActivationFunctionType activation, float *result)
 {
-  PortableApplyActivationToVector(vector, v_size, activation, result);
+  X86_OR_PORTABLE(ApplyActivationToVector, vector, v_size, activation, result);
 }
 
-void SymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
-                             float *min, float *max, float *scaling_factor)
+inline void SymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
+                                    float *min, float *max, float *scaling_factor)
 {
   return NEON_OR_PORTABLE(SymmetricQuantizeFloats, values, size, quantized_values, min, max,
                           scaling_factor);
 }
 
-void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows, const int m_cols,
-                                         const int8_t *vector, const float *scaling_factors,
-                                         int n_batch, float *result, int result_stride)
+inline void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows,
+                                                const int m_cols, const int8_t *vector,
+                                                const float *scaling_factors, int n_batch,
+                                                float *result, int result_stride)
 {
   NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector,
                    scaling_factors, n_batch, result, result_stride);
 }
 
-void MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
-                                         const float *vector, int n_batch, float *result,
-                                         int result_stride)
+inline void MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                const float *vector, int n_batch, float *result,
+                                                int result_stride)
 {
   NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vector, n_batch,
                    result, result_stride);
 }
 
-void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows, const int m_cols,
-                                         const int8_t *vectors, const float *scaling_factors,
-                                         int n_batch, int32_t *scratch, float *result,
-                                         int result_stride, ruy::Context *ruy_context)
+inline void MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows,
+                                                const int m_cols, const int8_t *vectors,
+                                                const float *scaling_factors, int n_batch,
+                                                int32_t *scratch, float *result, int result_stride,
+                                                ruy::Context *ruy_context)
 {
   NEON_OR_PORTABLE(MatrixBatchVectorMultiplyAccumulate, matrix, m_rows, m_cols, vectors,
                    scaling_factors, n_batch, scratch, result, result_stride, ruy_context);
 }
 
-void ZeroVector(float *vector, int v_size) { PortableZeroVector(vector, v_size); }
+inline void ZeroVector(float *vector, int v_size) { PortableZeroVector(vector, v_size); }
+
+inline void VectorVectorCwiseProduct(const float *vector1, const float *vector2, int v_size,
+                                     float *result)
+{
+  PortableVectorVectorCwiseProduct(vector1, vector2, v_size, result);
+}
+
+inline void VectorVectorCwiseProductAccumulate(const float *vector1, const float *vector2,
+                                               int v_size, float *result)
+{
+  PortableVectorVectorCwiseProductAccumulate(vector1, vector2, v_size, result);
+}
+
+inline void Sub1Vector(const float *vector, int v_size, float *result)
+{
+  PortableSub1Vector(vector, v_size, result);
+}
+
+inline void CwiseClipping(float *vector, const int v_size, const float clipping_value)
+{
+  PortableCwiseClipping(vector, v_size, clipping_value);
+}
 
 } // namespace cker
 } // namespace nnfw
@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_TYPES_H__
 #define __NNFW_CKER_TYPES_H__
 
+#include "cker/Shape.h"
+
 #include <cstdint>
 #include <type_traits>
 #include <limits>
@@ -34,6 +36,8 @@ enum class FusedActivationFunctionType
   kRelu6 = 1,
   kRelu1 = 2,
   kRelu = 3,
+  kTanh = 4,
+  kSigmoid = 5,
 };
 enum class PaddingType
 {
@@ -152,6 +156,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // Set this if filter is constant, so that ruy caches its packing
+  bool lhs_cacheable{false};
 };
 
 struct ComparisonParams
@@ -260,6 +266,8 @@ struct FullyConnectedParams
   float float_activation_min;
   float float_activation_max;
   // FullyConnectedWeightsFormat weights_format;
+  // Set this if weights are constant, so that ruy caches their packing
+  bool lhs_cacheable{false};
 };
 
 struct L2NormParams
@@ -366,6 +374,38 @@ struct SpaceToDepthParams
   int32_t block_size;
 };
 
+struct DepthToSpaceParams
+{
+  int32_t block_size;
+};
+
+struct ResizeNearestNeighborParams
+{
+  int32_t output_height;
+  int32_t output_width;
+  bool align_corners;
+  bool half_pixel_centers;
+};
+
+struct PReLUParams
+{
+  int32_t input_offset;
+  int32_t alpha_offset;
+  int32_t output_offset;
+  int32_t output_multiplier_1;
+  int output_shift_1;
+  int32_t output_multiplier_2;
+  int output_shift_2;
+};
+
+struct LocalResponseNormalizationParams
+{
+  int32_t range;
+  double bias;
+  double alpha;
+  double beta;
+};
+
 enum class Order
 {
   kColMajor,
@@ -379,6 +419,13 @@ enum class CachePolicy : std::uint8_t
   kAlwaysCache,
 };
 
+// Cache policy of a matrix of which data never changes, e.g. constant weights. Such a matrix is
+// packed by ruy only once, on prepacking or on the first Gemm, and reused from then on.
+inline CachePolicy DefaultCachePolicy(bool is_constant_data)
+{
+  return is_constant_data ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+}
+
 // MatrixParams encapsulates the parameters that Gemm needs about each
 // matrix, besides the buffer data pointer.
 // Compare to ruy::Matrix, which also encapsulates the data pointer.
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_TENSOR_UTILS_H__
+#define __NNFW_CKER_X86_TENSOR_UTILS_H__
+
+#include "cker/PortableTensorUtils.h"
+#include "cker/Types.h"
+#include "cker/x86/x86_check.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+
+inline int32_t X86HorizontalSum(__m128i v)
+{
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(v);
+}
+
+inline float X86HorizontalSum(__m128 v)
+{
+  v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  v = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtss_f32(v);
+}
+
+// Rounds half away from zero like std::round, while _mm_round_ps rounds half to even
+inline __m128 X86Round(__m128 v)
+{
+  const __m128 truncated = _mm_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  const __m128 sign_mask = _mm_set1_ps(-0.f);
+  const __m128 fraction = _mm_andnot_ps(sign_mask, _mm_sub_ps(v, truncated));
+  const __m128 one = _mm_or_ps(_mm_and_ps(v, sign_mask), _mm_set1_ps(1.f));
+  const __m128 round_up = _mm_cmpge_ps(fraction, _mm_set1_ps(0.5f));
+  return _mm_add_ps(truncated, _mm_and_ps(round_up, one));
+}
+
+CKER_X86_TARGET_AVX2 inline bool Avx2IsZeroVector(const float *vector, int v_size)
+{
+  int i = 0;
+  const __m256 zero = _mm256_setzero_ps();
+  for (; i <= v_size - 8; i += 8)
+  {
+    const __m256 not_zero = _mm256_cmp_ps(_mm256_loadu_ps(vector + i), zero, _CMP_NEQ_UQ);
+    if (_mm256_movemask_ps(not_zero))
+      return false;
+  }
+  return PortableIsZeroVector(vector + i, v_size - i);
+}
+
+inline bool X86IsZeroVector(const float *vector, int v_size)
+{
+  if (GetX86CpuFeatures().avx2)
+    return Avx2IsZeroVector(vector, v_size);
+
+  int i = 0;
+  const __m128 zero = _mm_setzero_ps();
+  for (; i <= v_size - 4; i += 4)
+  {
+    if (_mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(vector + i), zero)))
+      return false;
+  }
+  return PortableIsZeroVector(vector + i, v_size - i);
+}
+
+inline void X86SymmetricQuantizeFloats(const float *values, const int size,
+                                       int8_t *quantized_values, float *min_value,
+                                       float *max_value, float *scaling_factor)
+{
+  int i = 0;
+  __m128 min_vec = _mm_set1_ps(size > 0 ? values[0] : 0.f);
+  __m128 max_vec = min_vec;
+  for (; i <= size - 4; i += 4)
+  {
+    const __m128 v = _mm_loadu_ps(values + i);
+    min_vec = _mm_min_ps(min_vec, v);
+    max_vec = _mm_max_ps(max_vec, v);
+  }
+  float mins[4], maxs[4];
+  _mm_storeu_ps(mins, min_vec);
+  _mm_storeu_ps(maxs, max_vec);
+  *min_value = *std::min_element(mins, mins + 4);
+  *max_value = *std::max_element(maxs, maxs + 4);
+  for (; i < size; ++i)
+  {
+    *min_value = std::min(*min_value, values[i]);
+    *max_value = std::max(*max_value, values[i]);
+  }
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(*min_value), std::abs(*max_value));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  i = 0;
+  const __m128 scale_vec = _mm_set1_ps(scaling_factor_inv);
+  const __m128 lower_bound = _mm_set1_ps(-kScale);
+  const __m128 upper_bound = _mm_set1_ps(kScale);
+  for (; i <= size - 8; i += 8)
+  {
+    __m128 v0 = X86Round(_mm_mul_ps(_mm_loadu_ps(values + i), scale_vec));
+    __m128 v1 = X86Round(_mm_mul_ps(_mm_loadu_ps(values + i + 4), scale_vec));
+    v0 = _mm_min_ps(upper_bound, _mm_max_ps(lower_bound, v0));
+    v1 = _mm_min_ps(upper_bound, _mm_max_ps(lower_bound, v1));
+    const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(v0), _mm_cvtps_epi32(v1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(quantized_values + i),
+                     _mm_packs_epi16(packed, packed));
+  }
+  for (; i < size; ++i)
+  {
+    const int32_t quantized_value =
+        static_cast<int32_t>(std::round(values[i] * scaling_factor_inv));
+    quantized_values[i] = std::min(kScale, std::max(-kScale, quantized_value));
+  }
+}
+
+// Dot product of int8 vectors, which returns the number of elements computed
+CKER_X86_TARGET_AVX512 inline int Avx512DotProduct(const int8_t *a, const int8_t *b, int size,
+                                                   int32_t *dotprod)
+{
+  int i = 0;
+  __m512i acc = _mm512_setzero_si512();
+  for (; i <= size - 32; i += 32)
+  {
+    const __m512i a16 =
+        _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)));
+    const __m512i b16 =
+        _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)));
+    acc = _mm512_add_epi32(acc, _mm512_madd_epi16(a16, b16));
+  }
+  // _mm512_reduce_add_epi32, the unmasked extracts and even _mm512_castsi512_si256 are built on
+  // _mm256_undefined_*, which trips -Werror=uninitialized on GCC 12, so halve the vector with
+  // zero-masked extracts and reduce the rest in AVX2
+  const __m256i sum256 = _mm256_add_epi32(_mm512_maskz_extracti64x4_epi64(0xff, acc, 0),
+                                          _mm512_maskz_extracti64x4_epi64(0xff, acc, 1));
+  *dotprod = X86HorizontalSum(
+      _mm_add_epi32(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1)));
+  return i;
+}
+
+CKER_X86_TARGET_AVX2 inline int Avx2DotProduct(const int8_t *a, const int8_t *b, int size,
+                                               int32_t *dotprod)
+{
+  int i = 0;
+  __m256i acc = _mm256_setzero_si256();
+  for (; i <= size - 16; i += 16)
+  {
+    const __m256i a16 =
+        _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)));
+    const __m256i b16 =
+        _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)));
+    acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a16, b16));
+  }
+  *dotprod = X86HorizontalSum(
+      _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1)));
+  return i;
+}
+
+inline int Sse41DotProduct(const int8_t *a, const int8_t *b, int size, int32_t *dotprod)
+{
+  int i = 0;
+  __m128i acc = _mm_setzero_si128();
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i a16 =
+        _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(a + i)));
+    const __m128i b16 =
+        _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(b + i)));
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(a16, b16));
+  }
+  *dotprod = X86HorizontalSum(acc);
+  return i;
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   float *__restrict__ result, int result_stride)
+{
+  const X86CpuFeatures &features = GetX86CpuFeatures();
+  int (*dot_product)(const int8_t *, const int8_t *, int, int32_t *) = Sse41DotProduct;
+  if (features.avx512)
+    dot_product = Avx512DotProduct;
+  else if (features.avx2)
+    dot_product = Avx2DotProduct;
+
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      int32_t dotprod = 0;
+      int col = dot_product(row_ptr, vectors, m_cols, &dotprod);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   int32_t *, float *__restrict__ result,
+                                                   int result_stride, ruy::Context *)
+{
+  X86MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                         n_batch, result, result_stride);
+}
+
+// Dot product of float vectors, which returns the number of elements computed
+CKER_X86_TARGET_AVX512 inline int Avx512DotProduct(const float *a, const float *b, int size,
+                                                   float *dotprod)
+{
+  int i = 0;
+  __m512 acc = _mm512_setzero_ps();
+  for (; i <= size - 16; i += 16)
+  {
+    acc = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc);
+  }
+  // Halved by hand for the same reason as the int8 version
+  const __m512d acc_pd = _mm512_castps_pd(acc);
+  const __m256 low = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xff, acc_pd, 0));
+  const __m256 high = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xff, acc_pd, 1));
+  const __m256 sum256 = _mm256_add_ps(low, high);
+  *dotprod = X86HorizontalSum(
+      _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1)));
+  return i;
+}
+
+CKER_X86_TARGET_AVX2 inline int Avx2DotProduct(const float *a, const float *b, int size,
+                                               float *dotprod)
+{
+  int i = 0;
+  __m256 acc = _mm256_setzero_ps();
+  for (; i <= size - 8; i += 8)
+  {
+    acc = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc);
+  }
+  *dotprod =
+      X86HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)));
+  return i;
+}
+
+inline int Sse41DotProduct(const float *a, const float *b, int size, float *dotprod)
+{
+  int i = 0;
+  __m128 acc = _mm_setzero_ps();
+  for (; i <= size - 4; i += 4)
+  {
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  }
+  *dotprod = X86HorizontalSum(acc);
+  return i;
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                   const float *vector, int n_batch, float *result,
+                                                   int result_stride)
+{
+  const X86CpuFeatures &features = GetX86CpuFeatures();
+  int (*dot_product)(const float *, const float *, int, float *) = Sse41DotProduct;
+  if (features.avx512)
+    dot_product = Avx512DotProduct;
+  else if (features.avx2)
+    dot_product = Avx2DotProduct;
+
+  for (int b = 0; b < n_batch; ++b, vector += m_cols)
+  {
+    const float *row_ptr = matrix;
+    for (int r = 0; r < m_rows; ++r, row_ptr += m_cols, result += result_stride)
+    {
+      float dot_prod = 0.f;
+      int c = dot_product(row_ptr, vector, m_cols, &dot_prod);
+      for (; c < m_cols; ++c)
+      {
+        dot_prod += row_ptr[c] * vector[c];
+      }
+      *result += dot_prod;
+    }
+  }
+}
+
+// Clamps values to [min, max], which returns the number of elements computed
+CKER_X86_TARGET_AVX2 inline int Avx2Clamp(const float *vector, int v_size, float min, float max,
+                                          float *result)
+{
+  int i = 0;
+  const __m256 min_vec = _mm256_set1_ps(min);
+  const __m256 max_vec = _mm256_set1_ps(max);
+  for (; i <= v_size - 8; i += 8)
+  {
+    const __m256 v = _mm256_min_ps(max_vec, _mm256_loadu_ps(vector + i));
+    _mm256_storeu_ps(result + i, _mm256_max_ps(v, min_vec));
+  }
+  return i;
+}
+
+inline int Sse41Clamp(const float *vector, int v_size, float min, float max, float *result)
+{
+  int i = 0;
+  const __m128 min_vec = _mm_set1_ps(min);
+  const __m128 max_vec = _mm_set1_ps(max);
+  for (; i <= v_size - 4; i += 4)
+  {
+    const __m128 v = _mm_min_ps(max_vec, _mm_loadu_ps(vector + i));
+    _mm_storeu_ps(result + i, _mm_max_ps(v, min_vec));
+  }
+  return i;
+}
+
+inline void X86ApplyActivationToVector(const float *vector, int v_size,
+                                       FusedActivationFunctionType activation, float *result)
+{
+  float min = 0.f;
+  float max = 0.f;
+  switch (activation)
+  {
+    case FusedActivationFunctionType::kRelu:
+      min = 0.f;
+      max = std::numeric_limits<float>::infinity();
+      break;
+    case FusedActivationFunctionType::kRelu1:
+      min = -1.f;
+      max = 1.f;
+      break;
+    case FusedActivationFunctionType::kRelu6:
+      min = 0.f;
+      max = 6.f;
+      break;
+    default:
+      // Transcendental activations are computed by portable code
+      PortableApplyActivationToVector(vector, v_size, activation, result);
+      return;
+  }
+
+  const int i = GetX86CpuFeatures().avx2 ? Avx2Clamp(vector, v_size, min, max, result)
+                                         : Sse41Clamp(vector, v_size, min, max, result);
+  PortableApplyActivationToVector(vector + i, v_size - i, activation, result + i);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_TENSOR_UTILS_H__
@@ -82,16 +82,19 @@ private:
   std::unique_ptr<Eigen::ThreadPool> pool_;
 };
 
+// EigenContext can also be owned by users of cker (e.g. runtime) to limit the number of threads
+// that Eigen kernels use. Kernels use the global context if no device is given.
 struct EigenContext
 {
   constexpr static int default_num_threadpool_threads = 4;
   std::unique_ptr<Eigen::ThreadPoolInterface> thread_pool_wrapper;
   std::unique_ptr<Eigen::ThreadPoolDevice> device;
 
-  EigenContext()
+  EigenContext() : EigenContext(std::thread::hardware_concurrency()) {}
+
+  explicit EigenContext(int num_threads)
   {
-    int num_threads = std::thread::hardware_concurrency();
-    if (num_threads == 0)
+    if (num_threads <= 0)
     {
       num_threads = default_num_threadpool_threads;
     }
@@ -100,6 +103,14 @@ struct EigenContext
     device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
   }
 
+  // Runs kernels on a thread pool of the user
+  explicit EigenContext(std::unique_ptr<Eigen::ThreadPoolInterface> &&thread_pool)
+      : thread_pool_wrapper(std::move(thread_pool))
+  {
+    device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(),
+                                             thread_pool_wrapper->NumThreads()));
+  }
+
   static inline EigenContext &GetEigenContext()
   {
     static EigenContext instance;
@@ -37,14 +37,15 @@
 #endif
 
 // NEON_OR_PORTABLE(SomeFunc, args) calls NeonSomeFunc(args) if USE_NEON is
-// defined, PortableSomeFunc(args) otherwise.
+// defined, X86SomeFunc(args) if USE_X86_SIMD is defined, PortableSomeFunc(args) otherwise.
 #ifdef USE_NEON
 // Always use Neon code
 #define NEON_OR_PORTABLE(funcname, ...) Neon##funcname(__VA_ARGS__)
 
 #else
-// No NEON available: Use Portable code
-#define NEON_OR_PORTABLE(funcname, ...) Portable##funcname(__VA_ARGS__)
+// No NEON available: Use x86 SIMD code if available, Portable code otherwise
+#include "cker/x86/x86_check.h"
+#define NEON_OR_PORTABLE(funcname, ...) X86_OR_PORTABLE(funcname, __VA_ARGS__)
 
 #endif // defined(USE_NEON)
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+#define __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/operation/Helper/BCQ.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief FullyConnected of BCQ weights of shape [rows, hidden_size], which runs on binary planes
+ *        without decoding weights
+ *
+ * For each batch, partial sums of every 8 inputs are tabulated for all 256 combinations of signs.
+ * Then a dot product of a binary plane and the input is a lookup per byte of the plane, so a row
+ * of qbits planes costs qbits * hidden_size / 8 lookups instead of hidden_size multiplications.
+ * Rows are split across threads.
+ *
+ * For now this only saves memory. It is not faster than a dense float GEMV of the same shape,
+ * which is why an external bcq backend is preferred when one is loaded.
+ *
+ * Input is [hidden_size, batches] and output is [rows, batches].
+ */
+class BCQFullyConnected
+{
+public:
+  BCQFullyConnected() : _layout(), _lookup_table()
+  {
+    // DO NOTHING
+  }
+
+  /**
+   * @brief Prepare the layout of weights, which must be done again if clusters change
+   */
+  void prepare(const int32_t *clusters_data, int num_clusters, int hidden_size)
+  {
+    _layout.prepare(clusters_data, num_clusters, hidden_size);
+  }
+
+  const BCQLayout &layout() const { return _layout; }
+
+  void operator()(const FullyConnectedParams &params, const float *scales_data,
+                  const int32_t *binary_data, const Shape &input_shape, const float *input_data,
+                  const float *bias_data, const Shape &output_shape, float *output_data,
+                  const Eigen::ThreadPoolDevice *eigen_device = nullptr)
+  {
+    const int rows = _layout.rows();
+    const int hidden_size = _layout.hidden_size();
+    const int words = _layout.words_per_plane();
+    const int batches = input_shape.FlatSize() / hidden_size;
+    UNUSED_RELEASE(output_shape);
+    assert(output_shape.FlatSize() == rows * batches);
+
+    const Eigen::ThreadPoolDevice &device =
+        eigen_device ? *eigen_device : *eigen_support::GetThreadPoolDevice();
+    const double row_cost = 4.0 * words * _layout.num_planes() / std::max(rows, 1);
+
+    _lookup_table.resize(words * 4 * 256);
+    for (int b = 0; b < batches; ++b)
+    {
+      buildLookupTable(input_data + b, batches, hidden_size, words);
+
+      auto compute_rows = [&](Eigen::Index first, Eigen::Index last) {
+        for (Eigen::Index row = first; row < last; ++row)
+        {
+          float acc = bias_data ? bias_data[row] : 0.f;
+          for (int i = 0; i < _layout.qbits(row); ++i)
+          {
+            const int plane = _layout.first_plane(row) + i * _layout.plane_stride(row);
+            acc += scales_data[plane] * dotPlane(binary_data + plane * words, words);
+          }
+          output_data[row * batches + b] = ActivationFunctionWithMinMax(
+              acc, params.float_activation_min, params.float_activation_max);
+        }
+      };
+      device.parallelFor(rows, Eigen::TensorOpCost(row_cost, sizeof(float), row_cost),
+                         compute_rows);
+    }
+  }
+
+private:
+  // Tabulate sums of +-x for every 8 inputs of a batch, whose elements are apart by stride
+  void buildLookupTable(const float *input, int stride, int hidden_size, int words)
+  {
+    for (int g = 0; g < words * 4; ++g)
+    {
+      float *table = _lookup_table.data() + g * 256;
+      float sum = 0.f;
+      float x[8];
+      for (int j = 0; j < 8; ++j)
+      {
+        const int h = g * 8 + j;
+        x[j] = h < hidden_size ? input[h * stride] : 0.f;
+        sum += x[j];
+      }
+      // All bits clear is -sum, and setting bit j adds 2 * x[j]
+      table[0] = -sum;
+      for (int j = 0; j < 8; ++j)
+      {
+        const int half = 1 << j;
+        for (int k = 0; k < half; ++k)
+        {
+          table[half + k] = table[k] + 2.f * x[j];
+        }
+      }
+    }
+  }
+
+  float dotPlane(const int32_t *plane, int words) const
+  {
+    const float *table = _lookup_table.data();
+    float dot = 0.f;
+    for (int w = 0; w < words; ++w, table += 4 * 256)
+    {
+      const uint32_t bits = static_cast<uint32_t>(plane[w]);
+      dot += table[bits & 0xff] + table[256 + ((bits >> 8) & 0xff)] +
+             table[512 + ((bits >> 16) & 0xff)] + table[768 + (bits >> 24)];
+    }
+    return dot;
+  }
+
+private:
+  BCQLayout _layout;
+  std::vector<float> _lookup_table;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
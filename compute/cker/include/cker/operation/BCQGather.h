@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_GATHER_H__
+#define __NNFW_CKER_BCQ_GATHER_H__
+
+#include "cker/operation/Helper/BCQ.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Gather of BCQ weights of shape [rows, hidden_size], which are decoded only for gathered
+ *        rows or columns
+ */
+class BCQGather
+{
+public:
+  BCQGather() : _layout()
+  {
+    // DO NOTHING
+  }
+
+  /**
+   * @brief Prepare the layout of weights, which must be done again if clusters change
+   */
+  void prepare(const int32_t *clusters_data, int num_clusters, int hidden_size)
+  {
+    _layout.prepare(clusters_data, num_clusters, hidden_size);
+  }
+
+  const BCQLayout &layout() const { return _layout; }
+
+  /**
+   * @param axis 0 to gather rows into [indices..., hidden_size], or 1 to gather columns into
+   *             [rows, indices...]
+   */
+  template <typename IndexT>
+  void operator()(int axis, const float *scales_data, const int32_t *binary_data,
+                  const Shape &indices_shape, const IndexT *indices_data,
+                  const Shape &output_shape, float *output_data)
+  {
+    const int rows = _layout.rows();
+    const int hidden_size = _layout.hidden_size();
+    const int words = _layout.words_per_plane();
+    const int num_indices = indices_shape.FlatSize();
+    UNUSED_RELEASE(output_shape);
+
+    if (axis == 0)
+    {
+      assert(output_shape.FlatSize() == num_indices * hidden_size);
+      for (int i = 0; i < num_indices; ++i)
+      {
+        const int row = static_cast<int>(indices_data[i]);
+        if (row < 0 || row >= rows)
+          throw std::runtime_error{"BCQGather: index out of range"};
+        float *output = output_data + i * hidden_size;
+        std::fill(output, output + hidden_size, 0.f);
+        for (int b = 0; b < _layout.qbits(row); ++b)
+        {
+          const int plane = _layout.first_plane(row) + b * _layout.plane_stride(row);
+          BCQAccumulatePlane(binary_data + plane * words, scales_data[plane], hidden_size, output);
+        }
+      }
+    }
+    else
+    {
+      assert(axis == 1);
+      assert(output_shape.FlatSize() == rows * num_indices);
+      for (int i = 0; i < num_indices; ++i)
+      {
+        if (indices_data[i] < 0 || indices_data[i] >= hidden_size)
+          throw std::runtime_error{"BCQGather: index out of range"};
+      }
+      for (int row = 0; row < rows; ++row)
+      {
+        float *output = output_data + row * num_indices;
+        for (int i = 0; i < num_indices; ++i)
+        {
+          output[i] = BCQValue(_layout, scales_data, binary_data, row,
+                               static_cast<int>(indices_data[i]));
+        }
+      }
+    }
+  }
+
+private:
+  BCQLayout _layout;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_GATHER_H__
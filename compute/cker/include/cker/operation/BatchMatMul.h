@@ -18,126 +18,148 @@
 #ifndef __NNFW_CKER_BATCH_MATMUL_H__
 #define __NNFW_CKER_BATCH_MATMUL_H__
 
-#include "Transpose.h"
-
-#include "cker/Types.h"
 #include "cker/Shape.h"
+#include "cker/Types.h"
 #include "cker/Utils.h"
-#include "cker/operation/reference/BatchMatMul.h"
+#include "cker/operation/Helper/MatmulBCast.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
 
-#include <vector>
+#include <memory>
+#include <stdexcept>
 
 namespace nnfw
 {
 namespace cker
 {
 
+/**
+ * @brief Batched matrix multiplication with ruy
+ *
+ * Each output batch is a ruy GEMM of the corresponding (possibly broadcast) batches of lhs and
+ * rhs. adj_x and adj_y are handled by the storage order given to ruy, not by transposing inputs.
+ * ruy computes the transposed output, rhs^T * lhs^T, so that rhs, which is often constant
+ * weights, is the lhs of ruy whose packing ruy is able to cache.
+ */
 class BatchMatMul
 {
 public:
-  BatchMatMul()
+  BatchMatMul() : _bcast(nullptr), _rhs_cache_policy(CachePolicy::kNeverCache)
   {
     // DO NOTHING
   }
 
   /**
-   * @brief   Prepare temporary area for calculation
+   * @brief   Prepare broadcasting of batch dimensions, which must be done again if shapes change
    */
-  void prepare(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y)
+  void prepare(const Shape &lhs_shape, const Shape &rhs_shape)
   {
-    if (adj_x)
+    _bcast = std::make_unique<MatMulBCast>(lhs_shape, rhs_shape);
+    if (!_bcast->IsValid())
     {
-      int32_t rank = lhs_shape.DimensionsCount();
-      _temp_lhs_shape.Resize(rank);
+      throw std::runtime_error{"BatchMatMul: invalid broadcasting of batch dimensions"};
+    }
+  }
 
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_lhs_shape.SetDim(i, lhs_shape.Dims(i));
-      }
-      _temp_lhs_shape.SetDim(rank - 2, lhs_shape.Dims(rank - 1));
-      _temp_lhs_shape.SetDim(rank - 1, lhs_shape.Dims(rank - 2));
+  /**
+   * @brief Pack all batches of constant rhs into the cache of @c ruy_context
+   * @note  From then on, rhs of the same address is not packed again, so it must not change
+   */
+  void prepackRhs(const Shape &rhs_shape, const float *rhs_data, bool adj_y,
+                  ruy::Context *ruy_context)
+  {
+    const int rhs_rank = rhs_shape.DimensionsCount();
+    const int depth = rhs_shape.Dims(rhs_rank - (adj_y ? 1 : 2));
+    const int cols = rhs_shape.Dims(rhs_rank - (adj_y ? 2 : 1));
+    const int rhs_batch_size = rhs_shape.FlatSize() / (depth * cols);
 
-      _temp_lhs.resize(_temp_lhs_shape.FlatSize());
-    }
+    MatrixParams<float> lhs_params = transposedRhsParams(depth, cols, adj_y);
 
-    if (!adj_y)
-    {
-      int32_t rank = rhs_shape.DimensionsCount();
-      _temp_rhs_shape.Resize(rank);
+    MatrixParams<float> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = depth;
 
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_rhs_shape.SetDim(i, rhs_shape.Dims(i));
-      }
-      _temp_rhs_shape.SetDim(rank - 2, rhs_shape.Dims(rank - 1));
-      _temp_rhs_shape.SetDim(rank - 1, rhs_shape.Dims(rank - 2));
+    MatrixParams<float> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = cols;
 
-      _temp_rhs.resize(_temp_rhs_shape.FlatSize());
+    for (int b = 0; b < rhs_batch_size; ++b)
+    {
+      ruy_support::PrepackLhs(lhs_params, rhs_data + b * depth * cols, rhs_params, dst_params,
+                              GemmParams<float, float>(), ruy_context);
     }
+    _rhs_cache_policy = CachePolicy::kAlwaysCache;
   }
 
   void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
                   const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context)
   {
-    // Assume lhs and rhs is not constant
-    // TODO Handle constant input
+    assert(_bcast != nullptr);
+    UNUSED_RELEASE(output_shape);
 
-    if (!adj_y)
+    const int lhs_rank = lhs_shape.DimensionsCount();
+    const int rhs_rank = rhs_shape.DimensionsCount();
+    const int rows = lhs_shape.Dims(lhs_rank - (adj_x ? 1 : 2));
+    const int depth = lhs_shape.Dims(lhs_rank - (adj_x ? 2 : 1));
+    const int cols = rhs_shape.Dims(rhs_rank - (adj_y ? 2 : 1));
+    assert(depth == rhs_shape.Dims(rhs_rank - (adj_y ? 1 : 2)));
+
+    const int output_batch_size = _bcast->output_batch_size();
+    assert(output_shape.FlatSize() == output_batch_size * rows * cols);
+
+    // A row-major matrix is a column-major matrix of its transpose
+    MatrixParams<float> lhs_params = transposedRhsParams(depth, cols, adj_y);
+    lhs_params.cache_policy = _rhs_cache_policy;
+
+    MatrixParams<float> rhs_params;
+    rhs_params.order = adj_x ? Order::kRowMajor : Order::kColMajor;
+    rhs_params.rows = depth;
+    rhs_params.cols = rows;
+
+    MatrixParams<float> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = cols;
+    dst_params.cols = rows;
+
+    GemmParams<float, float> gemm_params;
+
+    if (_bcast->y_batch_size() == 1 && !adj_x)
     {
-      transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, _temp_rhs.data());
+      // All batches of lhs are stacked into a single matrix which is multiplied by the only rhs
+      rhs_params.cols = rows * output_batch_size;
+      dst_params.cols = rows * output_batch_size;
+      ruy_support::Gemm(lhs_params, rhs_data, rhs_params, lhs_data, dst_params, output_data,
+                        gemm_params, ruy_context);
+      return;
     }
 
-    if (adj_x)
+    const bool broadcasting_required = _bcast->IsBroadcastingRequired();
+    for (int b = 0; b < output_batch_size; ++b)
     {
-      transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, _temp_lhs.data());
+      const int lhs_batch = broadcasting_required ? _bcast->x_batch_indices()[b] : b;
+      const int rhs_batch = broadcasting_required ? _bcast->y_batch_indices()[b] : b;
+      ruy_support::Gemm(lhs_params, rhs_data + rhs_batch * depth * cols, rhs_params,
+                        lhs_data + lhs_batch * rows * depth, dst_params,
+                        output_data + b * rows * cols, gemm_params, ruy_context);
     }
-
-    Shape new_lhs_shape = adj_x ? lhs_shape : swapRowColDims(lhs_shape);
-    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
-    const float *new_lhs_data = adj_x ? _temp_lhs.data() : lhs_data;
-    const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
-
-    // Note we pass RHS args first, LHS args second
-    // Check accumulative dimensions of lhs and rhs of are equal
-    assert(Shape::ExtendedShape(5, new_rhs_shape).Dims(4) ==
-           Shape::ExtendedShape(5, new_lhs_shape).Dims(3));
-    reference::BatchMatMul(new_rhs_shape, new_rhs_data, new_lhs_shape, new_lhs_data, output_shape,
-                           output_data);
   }
 
 private:
-  Shape swapRowColDims(const Shape &shape)
+  // Parameters of rhs^T, which is the lhs of ruy
+  static MatrixParams<float> transposedRhsParams(int depth, int cols, bool adj_y)
   {
-    Shape swapped_shape(shape);
-    const uint32_t dims = shape.DimensionsCount();
-    swapped_shape.SetDim(dims - 2, shape.Dims(dims - 1));
-    swapped_shape.SetDim(dims - 1, shape.Dims(dims - 2));
-
-    return swapped_shape;
-  }
-
-  void transposeRowsCols(const Shape &input_shape, const float *input_data,
-                         const Shape &output_shape, float *output_data)
-  {
-    TransposeParams params;
-    int rank = input_shape.DimensionsCount();
-    params.perm_count = rank;
-    for (int i = 0; i < 2; i++)
-    {
-      params.perm[i] = i;
-    }
-    params.perm[rank - 2] = rank - 1;
-    params.perm[rank - 1] = rank - 2;
-
-    Transpose<float>(params, input_shape, input_data, output_shape, output_data);
+    MatrixParams<float> params;
+    params.order = adj_y ? Order::kRowMajor : Order::kColMajor;
+    params.rows = cols;
+    params.cols = depth;
+    return params;
   }
 
 private:
-  std::vector<float> _temp_lhs;
-  Shape _temp_lhs_shape;
-  std::vector<float> _temp_rhs;
-  Shape _temp_rhs_shape;
+  std::unique_ptr<MatMulBCast> _bcast;
+  CachePolicy _rhs_cache_policy;
 };
 
 } // namespace cker
@@ -23,6 +23,8 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/WinogradConv.h"
+#include <ruy/context.h>
 #include <iostream>
 #include <vector>
 
@@ -55,15 +57,38 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+      : _modified_filter_data(), _winograd_filter_data(), _int8_im2col_data(), _im2col_shape(4),
+        _need_im2col(false), _prepared(false), _winograd_enabled(true), _winograd_output_tile(0),
+        _prepared_filter(nullptr), _prepared_filter_size(0), _eigen_device(nullptr)
+  {
+  }
+
+  /**
+   * @brief Set Eigen device that multithreaded kernel runs on
+   * @note  If it is not set or set to nullptr, the global device of cker is used
+   */
+  void setEigenDevice(const Eigen::ThreadPoolDevice *device) { _eigen_device = device; }
+
+  /**
+   * @brief Enable or disable Winograd for 3x3 float convolutions, which is enabled by default
+   * @note  Winograd loses a little accuracy by its transforms. It must be set before prepare().
+   */
+  void setWinogradEnabled(bool enabled) { _winograd_enabled = enabled; }
 
-  void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
-               bool &is_replaced_weights, uint32_t dilationWidthFactor,
-               uint32_t dilationHeightFactor)
+  void prepare(const Shape &filter_shape, const float *filter_data, const Shape &output_shape,
+               PaddingType padding_type, uint32_t strideWidth, uint32_t strideHeight,
+               uint32_t dilationWidthFactor, uint32_t dilationHeightFactor,
+               bool &is_replaced_weights)
   {
     if (!_prepared)
     {
-      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      if (usableWinograd(filter_shape, strideWidth, strideHeight, dilationWidthFactor,
+                         dilationHeightFactor))
+      {
+        transformFilterForWinograd(filter_shape, filter_data, output_shape, is_replaced_weights);
+      }
+      else if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
       {
         transposeFilter(filter_shape, filter_data, is_replaced_weights);
       }
@@ -71,6 +96,54 @@ public:
     }
   }
 
+  /**
+   * @brief Prepare with a filter that prepare() produced before, instead of preparing it again
+   * @param prepared_filter Data of preparedFilter() of a Conv prepared with the same arguments.
+   *                        It must outlive this object.
+   * @return true if @c prepared_filter is used, false if it does not fit and nothing is done
+   */
+  bool prepareWithFilter(const Shape &filter_shape, const float *prepared_filter,
+                         size_t prepared_filter_size, const Shape &output_shape,
+                         PaddingType padding_type, uint32_t strideWidth, uint32_t strideHeight,
+                         uint32_t dilationWidthFactor, uint32_t dilationHeightFactor)
+  {
+    if (_prepared)
+      return false;
+
+    size_t expected_size = 0;
+    int output_tile = 0;
+    if (usableWinograd(filter_shape, strideWidth, strideHeight, dilationWidthFactor,
+                       dilationHeightFactor))
+    {
+      output_tile = optimized::WinogradOutputTile(output_shape);
+      const int alpha = optimized::GetWinogradTransformMatrices(output_tile).input_tile;
+      expected_size = alpha * alpha * filter_shape.Dims(0) * filter_shape.Dims(3);
+    }
+    else if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+    {
+      expected_size = filter_shape.FlatSize();
+    }
+
+    if (expected_size == 0 || prepared_filter_size != expected_size)
+      return false;
+
+    _winograd_output_tile = output_tile;
+    _prepared_filter = prepared_filter;
+    _prepared_filter_size = prepared_filter_size;
+    _prepared = true;
+    return true;
+  }
+
+  /**
+   * @brief Get the filter that prepare() transformed
+   * @return The filter, or nullptr if the original filter is used as it is
+   */
+  const float *preparedFilter(size_t &size) const
+  {
+    size = _prepared_filter_size;
+    return _prepared_filter;
+  }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height)
   {
@@ -81,11 +154,57 @@ public:
     }
   }
 
+  /**
+   * @brief Pack constant int8 filter into the cache of @c ruy_context, so that the per-channel
+   *        quantized Conv with params.lhs_cacheable does not pack it on every run
+   */
+  void prepackQuant(const ConvParams &params, const int32_t *output_multiplier,
+                    const int32_t *output_shift, const Shape &filter_shape,
+                    const int8_t *filter_data, ruy::Context *ruy_context)
+  {
+    MatrixParams<int8_t> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = filter_shape.Dims(0);
+    lhs_params.cols = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+
+    MatrixParams<int8_t> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = lhs_params.cols;
+    rhs_params.zero_point = -params.input_offset;
+
+    MatrixParams<int8_t> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = lhs_params.rows;
+    dst_params.zero_point = params.output_offset;
+
+    GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+    gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+    gemm_params.multiplier_exponent_perchannel = output_shift;
+
+    ruy_support::PrepackLhs(lhs_params, filter_data, rhs_params, dst_params, gemm_params,
+                            ruy_context);
+  }
+
   void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
+    if (usableWinograd(filter_shape, params.stride_width, params.stride_height,
+                       params.dilation_width_factor, params.dilation_height_factor))
+    {
+      bool transformed_in_execution = false;
+      if (!_prepared)
+      {
+        // This means that filter is not constant
+        transformFilterForWinograd(filter_shape, filter_data, output_shape,
+                                   transformed_in_execution);
+      }
+      const Eigen::ThreadPoolDevice &device =
+          _eigen_device ? *_eigen_device : *eigen_support::GetThreadPoolDevice();
+      optimized::WinogradConv(device, params, _winograd_output_tile, input_shape, input_data,
+                              _prepared_filter, bias_shape, bias_data, output_shape, output_data);
+    }
+    else if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
                             params.dilation_height_factor))
     {
       bool transposed_in_execution = false;
@@ -96,7 +215,9 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      const Eigen::ThreadPoolDevice &device =
+          _eigen_device ? *_eigen_device : *eigen_support::GetThreadPoolDevice();
+      multithreaded::Conv(device, params, input_shape, input_data, filter_shape, _prepared_filter,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -135,7 +256,37 @@ public:
     }
   }
 
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int32_t *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+                  ruy::Context *ruy_context)
+  {
+    if (!_prepared)
+    {
+      // This means that input or output are dynamic or filter is not constant
+      IsRequiredIm2col(input_shape, filter_shape, output_shape, params.stride_width,
+                       params.stride_height);
+    }
+
+    if (_need_im2col)
+    {
+      _int8_im2col_data.resize(_im2col_shape.FlatSize());
+    }
+    optimized::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                              filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                              output_data, _im2col_shape, _int8_im2col_data.data(), ruy_context);
+  }
+
 private:
+  bool usableWinograd(const Shape &filter_shape, uint32_t stride_width, uint32_t stride_height,
+                      uint32_t dilation_width_factor, uint32_t dilation_height_factor)
+  {
+    return _winograd_enabled &&
+           optimized::IsWinogradConvSupported(filter_shape, stride_width, stride_height,
+                                              dilation_width_factor, dilation_height_factor);
+  }
+
   bool usableMultiThreaded(PaddingType padding_type, uint32_t dilation_width_factor,
                            int32_t dilation_height_factor)
   {
@@ -150,6 +301,19 @@ private:
     const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
     _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
     TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
+    _prepared_filter = _modified_filter_data.data();
+    _prepared_filter_size = _modified_filter_data.size();
+    is_replaced_weights = true;
+  }
+
+  void transformFilterForWinograd(const Shape &filter_shape, const float *filter_data,
+                                  const Shape &output_shape, bool &is_replaced_weights)
+  {
+    _winograd_output_tile = optimized::WinogradOutputTile(output_shape);
+    optimized::WinogradTransformFilter(_winograd_output_tile, filter_shape, filter_data,
+                                       _winograd_filter_data);
+    _prepared_filter = _winograd_filter_data.data();
+    _prepared_filter_size = _winograd_filter_data.size();
     is_replaced_weights = true;
   }
 
@@ -169,9 +333,18 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  // Filter transformed for Winograd of _winograd_output_tile x _winograd_output_tile output tiles
+  std::vector<float> _winograd_filter_data;
+  std::vector<int8_t> _int8_im2col_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  bool _winograd_enabled;
+  int _winograd_output_tile;
+  // Filter used by float kernels, which points either of the vectors above or external data
+  const float *_prepared_filter;
+  size_t _prepared_filter_size;
+  const Eigen::ThreadPoolDevice *_eigen_device;
 };
 } // namespace cker
 } // namespace nnfw
@@ -18,8 +18,8 @@
 #ifndef __NNFW_CKER_EINSUM_H__
 #define __NNFW_CKER_EINSUM_H__
 
-#include "cker/Types.h"
 #include "cker/Shape.h"
+#include "cker/Types.h"
 #include "cker/Utils.h"
 
 #include "cker/operation/Helper/Tensor.h"
@@ -28,6 +28,8 @@
 #include "Transpose.h"
 #include "BatchMatMul.h"
 
+#include <ruy/context.h>
+
 #include <string>
 #include <vector>
 #include <map>
@@ -201,7 +203,7 @@ public:
 
   void operator()(std::string &equation, const std::vector<Shape> &input_shapes,
                   const std::vector<const float *> &input_data, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context)
   {
     if (!_prepared)
     {
@@ -247,7 +249,8 @@ public:
     // contraction. If num_inputs is 1, the reduced input is simply forwarded to
     // the output.
     Tensor contraction_output_reshaped;
-    contractOperands(inputs_reduced, swap_free_and_contract, &contraction_output_reshaped);
+    contractOperands(inputs_reduced, swap_free_and_contract, &contraction_output_reshaped,
+                     ruy_context);
 
     // Copy the batch labels from the contraction output. Recover the batch
     // shape, which may have been broadcasted.
@@ -854,7 +857,7 @@ private:
   // very inefficient. The functor should detect if this is the case and perform
   // componentwise multiplication functor instead.
   void contractOperands(std::vector<Tensor> &inputs, std::vector<bool> &swap_free_and_contract,
-                        Tensor *output)
+                        Tensor *output, ruy::Context *ruy_context)
   {
     if (inputs.size() == 1)
       return copyFrom(inputs[0], inputs[0].shape, output);
@@ -902,9 +905,9 @@ private:
 
     // LaunchBatchMatMul::Launch(lhs, rhs, adj_x, adj_y, bcast, &output_reshaped);
     BatchMatMul batchMatMul;
-    batchMatMul.prepare(lhs.shape, rhs.shape, adj_x, adj_y);
+    batchMatMul.prepare(lhs.shape, rhs.shape);
     batchMatMul(lhs.shape, lhs.base<float>(), rhs.shape, rhs.base<float>(), adj_x, adj_y,
-                output_reshaped.shape, output_reshaped.base<float>());
+                output_reshaped.shape, output_reshaped.base<float>(), ruy_context);
   }
 
   void reshapeToRank3(const Tensor &input, int batch_size, Tensor *output)
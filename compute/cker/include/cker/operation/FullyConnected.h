@@ -19,11 +19,12 @@
 #define __NNFW_CKER_FULLY_CONNECTED_H__
 
 #include <ruy/context.h>
-#include "cker/operation/FullyConnectedSparse16x1.h"
+#include "cker/operation/FullyConnectedSparse.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
+#include "cker/ruy/RuySupport.h"
 
 namespace nnfw
 {
@@ -87,6 +88,71 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+/**
+ * @brief Float fully connected computed by ruy
+ * @note  Packing of weights is cached in @c ruy_context if params.lhs_cacheable is set
+ */
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const float *input_data, const Shape &weights_shape,
+                           const float *weights_data, const Shape &, const float *bias_data,
+                           const Shape &, float *output_data, ruy::Context *ruy_context)
+{
+  const int total_input_size = input_shape.FlatSize();
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = total_input_size / input_size;
+  const int num_units = weights_shape.Dims(0);
+
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = num_units;
+  lhs_params.cols = input_size;
+  lhs_params.cache_policy = DefaultCachePolicy(params.lhs_cacheable);
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_size;
+  rhs_params.cols = batch_size;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = num_units;
+  dst_params.cols = batch_size;
+
+  GemmParams<float, float> gemm_params;
+  gemm_params.bias = bias_data;
+
+  ruy_support::Gemm(lhs_params, weights_data, rhs_params, input_data, dst_params, output_data,
+                    gemm_params, ruy_context);
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+  }
+}
+
+/**
+ * @brief Pack constant float weights into the cache of @c ruy_context for FullyConnected with ruy
+ */
+inline void PrepackFullyConnected(const Shape &weights_shape, const float *weights_data,
+                                  ruy::Context *ruy_context)
+{
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = weights_shape.Dims(0);
+  lhs_params.cols = weights_shape.Dims(1);
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = lhs_params.cols;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = lhs_params.rows;
+
+  ruy_support::PrepackLhs(lhs_params, weights_data, rhs_params, dst_params,
+                          GemmParams<float, float>(), ruy_context);
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const uint8_t *input_data, const Shape &filter_shape,
                            const uint8_t *filter_data, const Shape &bias_shape,
@@ -141,6 +207,98 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+/**
+ * @brief Int8 fully connected whose weights are quantized symmetrically per output unit
+ * @note  output_multiplier and output_shift have a value per output unit
+ */
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier,
+                                     const int32_t *output_shift, const Shape &input_shape,
+                                     const int8_t *input_data, const Shape &filter_shape,
+                                     const int8_t *filter_data, const Shape &bias_shape,
+                                     const int32_t *bias_data, const Shape &output_shape,
+                                     int8_t *output_data, ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+      MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = 0; // weights are quantized symmetrically
+  lhs_params.cache_policy = DefaultCachePolicy(params.lhs_cacheable);
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = -input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = output_activation_min;
+  gemm_params.clamp_max = output_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  ruy_support::Gemm(lhs_params, filter_data, rhs_params, input_data, dst_params, output_data,
+                    gemm_params, ruy_context);
+}
+
+/**
+ * @brief Pack constant int8 weights into the cache of @c ruy_context for FullyConnectedPerChannel
+ */
+inline void PrepackFullyConnectedPerChannel(const FullyConnectedParams &params,
+                                            const int32_t *output_multiplier,
+                                            const int32_t *output_shift, const Shape &filter_shape,
+                                            const int8_t *filter_data, ruy::Context *ruy_context)
+{
+  const int filter_dim_count = filter_shape.DimensionsCount();
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = filter_shape.Dims(filter_dim_count - 2);
+  lhs_params.cols = filter_shape.Dims(filter_dim_count - 1);
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = lhs_params.cols;
+  rhs_params.zero_point = -params.input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = lhs_params.rows;
+  dst_params.zero_point = params.output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  ruy_support::PrepackLhs(lhs_params, filter_data, rhs_params, dst_params, gemm_params,
+                          ruy_context);
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
@@ -209,55 +367,6 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   return;
 }
 
-inline void FullyConnectedSparseWeightRandom(const FullyConnectedParams &params,
-                                             const Shape &input_shape, const float *input_data,
-                                             const Shape &weights_shape, const float *weights_data,
-                                             const Shape &bias_shape, const float *bias_data,
-                                             const Shape &output_shape, float *output_data,
-                                             const uint16_t *w1_segments,
-                                             const uint16_t *w1_indices)
-{
-  UNUSED_RELEASE(params);
-  UNUSED_RELEASE(input_shape);
-
-  assert(weights_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-
-  const int output_dims_count = output_shape.DimensionsCount();
-  const int weights_dims_count = weights_shape.DimensionsCount();
-  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
-  const int output_depth =
-      MatchingDim(weights_shape, weights_dims_count - 2, output_shape, output_dims_count - 1);
-  const int accum_depth = weights_shape.Dims(weights_dims_count - 1);
-
-  UNUSED_RELEASE(bias_shape);
-  if (bias_data)
-  {
-    VectorBatchVectorAssign(bias_data, output_depth, batches, output_data);
-  }
-  else
-  {
-    ZeroVector(output_data, batches * output_depth);
-  }
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int idx_0 = 0; idx_0 < output_depth; ++idx_0)
-    {
-      for (int pw1 = w1_segments[idx_0]; pw1 < w1_segments[idx_0 + 1]; ++pw1)
-      {
-        int idx_1 = w1_indices[pw1];
-        output_data[b * output_depth + idx_0] +=
-            weights_data[pw1] * input_data[b * accum_depth + idx_1];
-      }
-    }
-  }
-  if (params.activation != FusedActivationFunctionType::kNone)
-  {
-    // Apply activation function
-    ApplyActivationToVector(output_data, batches * output_depth, params.activation, output_data);
-  }
-}
-
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_SPARSE_H__
+#define __NNFW_CKER_FULLY_CONNECTED_SPARSE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/TensorUtils.h"
+
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Accumulate products of a row of sparse blocks and input to kBlockRows outputs
+ *
+ * Each block of kBlockRows x kBlockCols weights is stored in row-major order, and its column of
+ * blocks is given by @c indices. Products are accumulated by Eigen packets of a whole block, which
+ * are reduced to outputs only once per row of blocks.
+ */
+template <int kBlockRows, int kBlockCols>
+inline void SparseBlockRowMultiplyAccumulate(const float *weights, const uint16_t *indices_begin,
+                                             const uint16_t *indices_end, const float *input,
+                                             float *output)
+{
+  // Eigen requires column vectors to be column-major
+  using Block = Eigen::Matrix<float, kBlockRows, kBlockCols,
+                              (kBlockCols == 1 && kBlockRows != 1) ? Eigen::ColMajor
+                                                                   : Eigen::RowMajor>;
+  using InputBlock = Eigen::Matrix<float, 1, kBlockCols, Eigen::RowMajor>;
+
+  Block acc = Block::Zero();
+  for (const uint16_t *index = indices_begin; index != indices_end; ++index)
+  {
+    Eigen::Map<const Block> w(weights);
+    Eigen::Map<const InputBlock> x(input + *index * kBlockCols);
+    acc.array() += w.array().rowwise() * x.array();
+    weights += kBlockRows * kBlockCols;
+  }
+  Eigen::Map<Eigen::Matrix<float, kBlockRows, 1>> y(output);
+  y += acc.rowwise().sum();
+}
+
+// Same as SparseBlockRowMultiplyAccumulate for block sizes which are not instantiated
+inline void SparseBlockRowMultiplyAccumulate(int block_rows, int block_cols, const float *weights,
+                                             const uint16_t *indices_begin,
+                                             const uint16_t *indices_end, const float *input,
+                                             float *output)
+{
+  for (const uint16_t *index = indices_begin; index != indices_end; ++index)
+  {
+    const float *x = input + *index * block_cols;
+    for (int r = 0; r < block_rows; ++r)
+    {
+      float sum = 0.f;
+      for (int c = 0; c < block_cols; ++c)
+      {
+        sum += weights[r * block_cols + c] * x[c];
+      }
+      output[r] += sum;
+    }
+    weights += block_rows * block_cols;
+  }
+}
+
+using SparseBlockRowKernel = void (*)(const float *, const uint16_t *, const uint16_t *,
+                                      const float *, float *);
+
+/**
+ * @brief Returns the kernel specialized for the block size
+ * @return Kernel function, or nullptr if there is no specialized kernel for the block size
+ */
+inline SparseBlockRowKernel GetSparseBlockRowKernel(int block_rows, int block_cols)
+{
+  if (block_rows == 1 && block_cols == 1)
+    return SparseBlockRowMultiplyAccumulate<1, 1>;
+  if (block_rows == 1 && block_cols == 4)
+    return SparseBlockRowMultiplyAccumulate<1, 4>;
+  if (block_rows == 1 && block_cols == 8)
+    return SparseBlockRowMultiplyAccumulate<1, 8>;
+  if (block_rows == 1 && block_cols == 16)
+    return SparseBlockRowMultiplyAccumulate<1, 16>;
+  if (block_rows == 4 && block_cols == 1)
+    return SparseBlockRowMultiplyAccumulate<4, 1>;
+  if (block_rows == 8 && block_cols == 1)
+    return SparseBlockRowMultiplyAccumulate<8, 1>;
+  if (block_rows == 16 && block_cols == 1)
+    return SparseBlockRowMultiplyAccumulate<16, 1>;
+  if (block_rows == 2 && block_cols == 2)
+    return SparseBlockRowMultiplyAccumulate<2, 2>;
+  if (block_rows == 4 && block_cols == 4)
+    return SparseBlockRowMultiplyAccumulate<4, 4>;
+  if (block_rows == 8 && block_cols == 8)
+    return SparseBlockRowMultiplyAccumulate<8, 8>;
+  return nullptr;
+}
+
+/**
+ * @brief FullyConnected of sparse weights in block CSR format
+ *
+ * Weights of shape [output_depth, accum_depth] are split into blocks of block_rows x block_cols.
+ * Nonzero blocks of the i-th row of blocks are w1_segments[i] to w1_segments[i + 1] in
+ * weights_data, and w1_indices has their columns of blocks. Random sparsity is 1x1 blocks. Rows of
+ * blocks are split across threads.
+ *
+ * @param eigen_device Device that rows run on, which is the global device of cker if nullptr
+ */
+inline void FullyConnectedSparseWeight(const FullyConnectedParams &params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &weights_shape, const float *weights_data,
+                                       const Shape &bias_shape, const float *bias_data,
+                                       const Shape &output_shape, float *output_data,
+                                       const uint16_t *w1_segments, const uint16_t *w1_indices,
+                                       int block_rows, int block_cols,
+                                       const Eigen::ThreadPoolDevice *eigen_device = nullptr)
+{
+  UNUSED_RELEASE(input_shape);
+
+  assert(weights_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int weights_dims_count = weights_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth =
+      MatchingDim(weights_shape, weights_dims_count - 2, output_shape, output_dims_count - 1);
+  const int accum_depth = weights_shape.Dims(weights_dims_count - 1);
+  assert(output_depth % block_rows == 0 && accum_depth % block_cols == 0);
+  const int block_size = block_rows * block_cols;
+  const int num_block_rows = output_depth / block_rows;
+
+  UNUSED_RELEASE(bias_shape);
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, output_depth, batches, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batches * output_depth);
+  }
+
+  const SparseBlockRowKernel kernel = GetSparseBlockRowKernel(block_rows, block_cols);
+  auto compute_rows = [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index i = first; i < last; ++i)
+    {
+      const float *weights = weights_data + w1_segments[i] * block_size;
+      const uint16_t *indices_begin = w1_indices + w1_segments[i];
+      const uint16_t *indices_end = w1_indices + w1_segments[i + 1];
+      // Weights of a row of blocks stay in cache across batches
+      for (int b = 0; b < batches; ++b)
+      {
+        const float *input = input_data + b * accum_depth;
+        float *output = output_data + b * output_depth + i * block_rows;
+        if (kernel)
+        {
+          kernel(weights, indices_begin, indices_end, input, output);
+        }
+        else
+        {
+          SparseBlockRowMultiplyAccumulate(block_rows, block_cols, weights, indices_begin,
+                                           indices_end, input, output);
+        }
+      }
+    }
+  };
+
+  const Eigen::ThreadPoolDevice &device =
+      eigen_device ? *eigen_device : *eigen_support::GetThreadPoolDevice();
+  const double nonzeros_per_row =
+      static_cast<double>(w1_segments[num_block_rows]) * block_size / num_block_rows;
+  device.parallelFor(num_block_rows,
+                     Eigen::TensorOpCost(nonzeros_per_row * (1 + batches) * sizeof(float),
+                                         batches * block_rows * sizeof(float),
+                                         2 * nonzeros_per_row * batches),
+                     compute_rows);
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, batches * output_depth, params.activation, output_data);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_SPARSE_H__
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HELPER_BCQ_H__
+#define __NNFW_CKER_HELPER_BCQ_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Layout of weights in BCQ (binary-coded quantization)
+ *
+ * Rows of weights are split into clusters, each of which is given as a pair of (qbits, size).
+ * A row of a cluster is sum(alpha_i * b_i) for i < qbits, where b_i is a binary plane of
+ * hidden_size values which are +1 for set bits and -1 otherwise. Planes of a cluster are ordered
+ * by bit and then by row, and each plane is packed into 32-bit words from the least significant
+ * bit. There is a scale alpha for each plane in the same order.
+ */
+class BCQLayout
+{
+public:
+  BCQLayout() : _qbits(), _first_plane(), _plane_stride(), _hidden_size(0), _num_planes(0)
+  {
+    // DO NOTHING
+  }
+
+  void prepare(const int32_t *clusters_data, int num_clusters, int hidden_size)
+  {
+    if (hidden_size <= 0)
+      throw std::runtime_error{"BCQ: invalid hidden size"};
+    _qbits.clear();
+    _first_plane.clear();
+    _plane_stride.clear();
+    _hidden_size = hidden_size;
+    _num_planes = 0;
+    for (int c = 0; c < num_clusters; ++c)
+    {
+      const int qbits = clusters_data[c * 2];
+      const int size = clusters_data[c * 2 + 1];
+      if (qbits <= 0 || size < 0)
+        throw std::runtime_error{"BCQ: invalid clusters"};
+      for (int r = 0; r < size; ++r)
+      {
+        _qbits.push_back(qbits);
+        _first_plane.push_back(_num_planes + r);
+        _plane_stride.push_back(size);
+      }
+      _num_planes += qbits * size;
+    }
+  }
+
+  int rows() const { return static_cast<int>(_qbits.size()); }
+  int hidden_size() const { return _hidden_size; }
+  int num_planes() const { return _num_planes; }
+  int words_per_plane() const { return (_hidden_size + 31) / 32; }
+
+  // Planes of a row are first_plane(row) + i * plane_stride(row) for i < qbits(row)
+  int qbits(int row) const { return _qbits[row]; }
+  int first_plane(int row) const { return _first_plane[row]; }
+  int plane_stride(int row) const { return _plane_stride[row]; }
+
+private:
+  std::vector<int32_t> _qbits;
+  std::vector<int32_t> _first_plane;
+  std::vector<int32_t> _plane_stride;
+  int _hidden_size;
+  int _num_planes;
+};
+
+/**
+ * @brief Add scale * b to output, where b is +1 or -1 by bits of the plane
+ */
+inline void BCQAccumulatePlane(const int32_t *plane, float scale, int hidden_size, float *output)
+{
+  for (int h = 0; h < hidden_size; h += 32)
+  {
+    const uint32_t bits = static_cast<uint32_t>(plane[h / 32]);
+    const int count = std::min(32, hidden_size - h);
+    for (int j = 0; j < count; ++j)
+    {
+      output[h + j] += ((bits >> j) & 1) ? scale : -scale;
+    }
+  }
+}
+
+/**
+ * @brief Returns the value of a row at hidden index h
+ */
+inline float BCQValue(const BCQLayout &layout, const float *scales, const int32_t *binary, int row,
+                      int h)
+{
+  const int words = layout.words_per_plane();
+  float value = 0.f;
+  for (int i = 0; i < layout.qbits(row); ++i)
+  {
+    const int plane = layout.first_plane(row) + i * layout.plane_stride(row);
+    const uint32_t word = static_cast<uint32_t>(binary[plane * words + h / 32]);
+    value += ((word >> (h % 32)) & 1) ? scales[plane] : -scales[plane];
+  }
+  return value;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HELPER_BCQ_H__
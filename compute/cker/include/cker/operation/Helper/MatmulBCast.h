@@ -38,7 +38,7 @@ namespace cker
 class MatMulBCast
 {
 public:
-  MatMulBCast(Shape &shape_x, Shape &shape_y)
+  MatMulBCast(const Shape &shape_x, const Shape &shape_y)
   {
     if (shape_x.DimensionsCount() < 2 || shape_y.DimensionsCount() < 2)
       return;
@@ -58,7 +58,7 @@ public:
       y[i] = shape_y.Dims(i);
     }
 
-    _batch_bcast = std::make_unique<BCast>(std::move(x), std::move(y));
+    _batch_bcast = std::make_unique<BCast>(std::move(x), std::move(y), true, true);
     if (!_batch_bcast->IsValid())
       return;
 
@@ -68,7 +68,7 @@ public:
 
     _x_batch_size = std::accumulate(x_reshaped.cbegin(), x_reshaped.cend(), INT32_C(1),
                                     std::multiplies<int32_t>());
-    _y_batch_size = std::accumulate(x_reshaped.cbegin(), x_reshaped.cend(), INT32_C(1),
+    _y_batch_size = std::accumulate(y_reshaped.cbegin(), y_reshaped.cend(), INT32_C(1),
                                     std::multiplies<int32_t>());
     _output_shape.ReplaceWith(output_shape.size(), output_shape.data());
     _output_batch_size = _output_shape.FlatSize();
@@ -80,6 +80,12 @@ public:
   int32_t output_batch_size() const { return _output_batch_size; }
   const Shape &output_batch_shape() const { return _output_shape; }
 
+  // Mappings from flattened output batch indices to flattened batch indices of x and y, which
+  // are empty if broadcasting is not required
+  bool IsBroadcastingRequired() const { return _batch_bcast->IsBroadcastingRequired(); }
+  const std::vector<int32_t> &x_batch_indices() const { return _batch_bcast->x_batch_indices(); }
+  const std::vector<int32_t> &y_batch_indices() const { return _batch_bcast->y_batch_indices(); }
+
 private:
   std::unique_ptr<BCast> _batch_bcast;
 
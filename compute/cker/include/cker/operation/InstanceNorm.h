@@ -21,6 +21,8 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <Eigen/Core>
+
 #include <cmath>
 
 namespace nnfw
@@ -28,6 +30,10 @@ namespace nnfw
 namespace cker
 {
 
+/**
+ * @brief InstanceNorm of NHWC data, which runs on a [channels, height * width] matrix per batch so
+ *        that statistics of all channels are accumulated together in one pass over contiguous data
+ */
 inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_shape,
                          const float *input_data, const Shape &gamma_shape, const float *gamma_data,
                          const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
@@ -44,45 +50,34 @@ inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_sh
   UNUSED_RELEASE(beta_shape);
   assert(output_activation_min <= output_activation_max);
 
+  const int32_t size = heights * widths;
+  const auto gamma = Eigen::Map<const Eigen::ArrayXf>(gamma_data, channels).cast<double>();
+  const auto beta = Eigen::Map<const Eigen::ArrayXf>(beta_data, channels).cast<double>();
+
   for (int32_t batch = 0; batch < batches; batch++)
   {
-    for (int32_t channel = 0; channel < channels; channel++)
-    {
-      double sum = 0.0f;
-      double square_sum = 0.0f;
-      int32_t size = heights * widths;
+    const Eigen::Map<const Eigen::ArrayXXf> input(input_data + batch * size * channels, channels,
+                                                  size);
+    Eigen::Map<Eigen::ArrayXXf> output(output_data + batch * size * channels, channels, size);
 
-      for (int32_t height = 0; height < heights; height++)
-      {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-          sum += input_val;
-          square_sum += (input_val * input_val);
-        }
-      }
-
-      double mean = sum / size;
-      double var = square_sum / size - mean * mean;
+    // Accumulate in double as the variance is derived from the sum of squares
+    Eigen::ArrayXd sum = Eigen::ArrayXd::Zero(channels);
+    Eigen::ArrayXd square_sum = Eigen::ArrayXd::Zero(channels);
+    for (int32_t i = 0; i < size; i++)
+    {
+      sum += input.col(i).cast<double>();
+      square_sum += input.col(i).cast<double>().square();
+    }
 
-      double gamma = gamma_data[channel];
-      double beta = beta_data[channel];
+    const Eigen::ArrayXd mean = sum / size;
+    const Eigen::ArrayXd var = square_sum / size - mean * mean;
 
-      double a = gamma / (std::sqrt(var + params.epsilon));
-      double b = -mean * a + beta;
+    const Eigen::ArrayXf a = (gamma / (var + params.epsilon).sqrt()).cast<float>();
+    const Eigen::ArrayXf b = (beta - mean * a.cast<double>()).cast<float>();
 
-      for (int32_t height = 0; height < heights; height++)
-      {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_value = input_data[Offset(output_shape, batch, height, width, channel)];
-          double output_value = input_value * a + b;
-          output_data[Offset(output_shape, batch, height, width, channel)] =
-              ActivationFunctionWithMinMax((float)output_value, output_activation_min,
-                                           output_activation_max);
-        }
-      }
-    }
+    output = ((input.colwise() * a).colwise() + b)
+                 .cwiseMax(output_activation_min)
+                 .cwiseMin(output_activation_max);
   }
 }
 
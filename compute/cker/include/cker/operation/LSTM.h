@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LSTM_H__
+#define __NNFW_CKER_LSTM_H__
+
+#include "cker/operation/RecurrentGates.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+struct LSTMParams
+{
+  FusedActivationFunctionType activation;
+  // Clipping is disabled if the threshold is not positive
+  float cell_clip;
+  float proj_clip;
+  CachePolicy projection_cache_policy = CachePolicy::kNeverCache;
+};
+
+class LSTMTempArena
+{
+public:
+  LSTMTempArena(void) : gates(), hidden()
+  {
+    // DO NOTHING
+  }
+
+  // The number of batches may change if the input is dynamic
+  void prepare(int n_batch, int n_gates, int n_cell)
+  {
+    gates.resize(n_batch * n_gates * n_cell);
+    hidden.resize(n_batch * n_cell);
+  }
+
+public:
+  std::vector<float> gates;
+  std::vector<float> hidden;
+};
+
+/**
+ * @brief Pack constant projection weights into the cache of @c ruy_context for LSTM with
+ *        CachePolicy::kAlwaysCache as params.projection_cache_policy
+ */
+inline void PrepackLSTMProjection(int n_cell, int n_output, const float *projection_weights,
+                                  ruy::Context *ruy_context)
+{
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = n_output;
+  lhs_params.cols = n_cell;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = n_cell;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = n_output;
+
+  ruy_support::PrepackLhs(lhs_params, projection_weights, rhs_params, dst_params,
+                          GemmParams<float, float>(), ruy_context);
+}
+
+/**
+ * @brief Run a step of LSTM for all batches
+ *
+ * @param gate_weights Weights of gates packed in the order of input, forget, cell and output gate.
+ *                     The input gate is omitted if input and forget gates are coupled (CIFG).
+ * @param cell_to_input_weights Peephole weights, which are nullptr if there is no peephole
+ * @param projection_weights Projection weights, which are nullptr if there is no projection
+ * @note  Output of the step is written to both @c output_state_out and @c output_data. States may
+ *        be updated in place.
+ */
+inline void LSTM(const LSTMParams &params, int n_batch, int n_cell, int n_output,
+                 const float *input_data, RecurrentGates &gate_weights,
+                 const float *cell_to_input_weights, const float *cell_to_forget_weights,
+                 const float *cell_to_output_weights, const float *projection_weights,
+                 const float *projection_bias, const float *output_state_in,
+                 const float *cell_state_in, float *output_state_out, float *cell_state_out,
+                 float *output_data, LSTMTempArena &temp_arena, ruy::Context *ruy_context)
+{
+  const int n_gates = gate_weights.n_gates;
+  assert(n_gates == 3 || n_gates == 4);
+  const bool use_cifg = n_gates == 3;
+  temp_arena.prepare(n_batch, n_gates, n_cell);
+
+  // Compute W * input + R * output_state + bias of all gates at once
+  gate_weights.compute(n_batch, input_data, output_state_in, temp_arena.gates.data(),
+                       ruy_context);
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    float *input_gate = temp_arena.gates.data() + b * n_gates * n_cell;
+    float *forget_gate = input_gate + (use_cifg ? 0 : n_cell);
+    float *cell_gate = forget_gate + n_cell;
+    float *output_gate = cell_gate + n_cell;
+    const float *cell_state_prev = cell_state_in + b * n_cell;
+    float *cell_state = cell_state_out + b * n_cell;
+    float *hidden = temp_arena.hidden.data() + b * n_cell;
+
+    if (use_cifg)
+    {
+      // The hidden buffer is free until the output gate is applied
+      input_gate = hidden;
+    }
+    else
+    {
+      if (cell_to_input_weights != nullptr)
+      {
+        VectorVectorCwiseProductAccumulate(cell_to_input_weights, cell_state_prev, n_cell,
+                                           input_gate);
+      }
+      ApplyActivationToVector(input_gate, n_cell, FusedActivationFunctionType::kSigmoid,
+                              input_gate);
+    }
+
+    if (cell_to_forget_weights != nullptr)
+    {
+      VectorVectorCwiseProductAccumulate(cell_to_forget_weights, cell_state_prev, n_cell,
+                                         forget_gate);
+    }
+    ApplyActivationToVector(forget_gate, n_cell, FusedActivationFunctionType::kSigmoid,
+                            forget_gate);
+    if (use_cifg)
+    {
+      Sub1Vector(forget_gate, n_cell, input_gate);
+    }
+
+    // cell_state = forget_gate * cell_state_prev + input_gate * activation(cell_gate)
+    ApplyActivationToVector(cell_gate, n_cell, params.activation, cell_gate);
+    VectorVectorCwiseProduct(forget_gate, cell_state_prev, n_cell, cell_state);
+    VectorVectorCwiseProductAccumulate(input_gate, cell_gate, n_cell, cell_state);
+    if (params.cell_clip > 0.0f)
+    {
+      CwiseClipping(cell_state, n_cell, params.cell_clip);
+    }
+
+    if (cell_to_output_weights != nullptr)
+    {
+      VectorVectorCwiseProductAccumulate(cell_to_output_weights, cell_state, n_cell,
+                                         output_gate);
+    }
+    ApplyActivationToVector(output_gate, n_cell, FusedActivationFunctionType::kSigmoid,
+                            output_gate);
+    ApplyActivationToVector(cell_state, n_cell, params.activation, hidden);
+    VectorVectorCwiseProduct(output_gate, hidden, n_cell, hidden);
+  }
+
+  if (projection_weights != nullptr)
+  {
+    MatrixParams<float> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = n_output;
+    lhs_params.cols = n_cell;
+    lhs_params.cache_policy = params.projection_cache_policy;
+
+    MatrixParams<float> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = n_cell;
+    rhs_params.cols = n_batch;
+
+    MatrixParams<float> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = n_output;
+    dst_params.cols = n_batch;
+
+    GemmParams<float, float> gemm_params;
+    gemm_params.bias = projection_bias;
+    if (params.proj_clip > 0.0f)
+    {
+      gemm_params.clamp_min = -params.proj_clip;
+      gemm_params.clamp_max = params.proj_clip;
+    }
+
+    ruy_support::Gemm(lhs_params, projection_weights, rhs_params, temp_arena.hidden.data(),
+                      dst_params, output_data, gemm_params, ruy_context);
+  }
+  else
+  {
+    assert(n_output == n_cell);
+    memcpy(output_data, temp_arena.hidden.data(), n_batch * n_output * sizeof(float));
+  }
+
+  if (output_state_out != output_data)
+  {
+    memcpy(output_state_out, output_data, n_batch * n_output * sizeof(float));
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LSTM_H__
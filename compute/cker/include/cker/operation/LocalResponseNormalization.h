@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+#define __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief LocalResponseNormalization across depth of float data
+ *
+ * Sums of squares over a window are kept by sliding the window along depth, so that each pixel
+ * costs O(depth) regardless of the range. pow() is avoided for the common betas of 0.5, 0.75 and 1.
+ */
+inline void LocalResponseNormalization(const LocalResponseNormalizationParams &params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &output_shape, float *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int range = params.range;
+  const float bias = static_cast<float>(params.bias);
+  const float alpha = static_cast<float>(params.alpha);
+  const float beta = static_cast<float>(params.beta);
+
+  std::vector<float> squares(depth);
+  for (int i = 0; i < outer_size; ++i)
+  {
+    const float *input = input_data + i * depth;
+    float *output = output_data + i * depth;
+
+    for (int c = 0; c < depth; ++c)
+    {
+      squares[c] = input[c] * input[c];
+    }
+
+    // Window of c is [c - range, c + range] clipped to depth
+    double accum = 0.0;
+    for (int c = 0; c < std::min(range, depth); ++c)
+    {
+      accum += squares[c];
+    }
+    for (int c = 0; c < depth; ++c)
+    {
+      if (c + range < depth)
+        accum += squares[c + range];
+      if (c - range - 1 >= 0)
+        accum -= squares[c - range - 1];
+
+      const float base = bias + alpha * static_cast<float>(std::max(accum, 0.0));
+      float multiplier;
+      if (beta == 0.5f)
+        multiplier = 1.f / std::sqrt(base);
+      else if (beta == 0.75f)
+        multiplier = 1.f / (std::sqrt(base) * std::sqrt(std::sqrt(base)));
+      else if (beta == 1.f)
+        multiplier = 1.f / base;
+      else
+        multiplier = std::pow(base, -beta);
+      output[c] = input[c] * multiplier;
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_PRELU_H__
+#define __NNFW_CKER_PRELU_H__
+
+#include "cker/operation/BinaryArithmeticOps.h"
+#include "cker/operation/optimized/BinaryArithmeticOps.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace prelu
+{
+
+inline void PReLUElementwise(int size, const float *input_data, const float *alpha_data,
+                             float *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    const float input = input_data[i];
+    output_data[i] = input >= 0.f ? input : input * alpha_data[i];
+  }
+}
+
+inline void PReLUScalarAlpha(int size, const float *input_data, float alpha, float *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    const float input = input_data[i];
+    output_data[i] = input >= 0.f ? input : input * alpha;
+  }
+}
+
+inline void PReLUScalarInput(int size, float input, const float *alpha_data, float *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = input >= 0.f ? input : input * alpha_data[i];
+  }
+}
+
+} // namespace prelu
+
+/**
+ * @brief PReLU of float data, where alpha is broadcast to input
+ *
+ * Broadcasting reuses the shape processing of binary arithmetic operations, so that the common
+ * cases of alpha per channel or a scalar alpha run on contiguous segments instead of per element.
+ */
+inline void PReLU(const Shape &input_shape, const float *input_data, const Shape &alpha_shape,
+                  const float *alpha_data, const Shape &output_shape, float *output_data)
+{
+  BinaryArithmeticOpParam params;
+  if (!ProcessBroadcastShapes(input_shape, alpha_shape, &params))
+  {
+    const int size = MatchingElementsSize(input_shape, alpha_shape, output_shape);
+    prelu::PReLUElementwise(size, input_data, alpha_data, output_data);
+    return;
+  }
+
+  if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
+  {
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    const std::function<float(const float &, const float &)> fn =
+        [](const float &input, const float &alpha) -> float {
+      return input >= 0.f ? input : input * alpha;
+    };
+    reference::BroadcastBinaryArithmeticOpSlow(params, input_shape, input_data, alpha_shape,
+                                               alpha_data, output_shape, output_data, fn);
+    return;
+  }
+
+  // BinaryBroadcastFiveFold gives the input which broadcasts fast as the first argument of
+  // callbacks
+  if (params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast)
+  {
+    optimized::BinaryBroadcastFiveFold(
+        params, input_shape, input_data, alpha_shape, alpha_data, output_shape, output_data,
+        [](int size, const BinaryArithmeticOpParam &, const float *input, const float *alpha,
+           float *output) { prelu::PReLUElementwise(size, input, alpha, output); },
+        [](int size, const BinaryArithmeticOpParam &, float input, const float *alpha,
+           float *output) { prelu::PReLUScalarInput(size, input, alpha, output); });
+  }
+  else
+  {
+    optimized::BinaryBroadcastFiveFold(
+        params, input_shape, input_data, alpha_shape, alpha_data, output_shape, output_data,
+        [](int size, const BinaryArithmeticOpParam &, const float *alpha, const float *input,
+           float *output) { prelu::PReLUElementwise(size, input, alpha, output); },
+        [](int size, const BinaryArithmeticOpParam &, float alpha, const float *input,
+           float *output) { prelu::PReLUScalarAlpha(size, input, alpha, output); });
+  }
+}
+
+/**
+ * @brief PReLU of uint8 data, where alpha is broadcast to input
+ *
+ * Positive inputs are rescaled by output_multiplier_1 (input_scale / output_scale) and negative
+ * inputs by output_multiplier_2 (input_scale * alpha_scale / output_scale), as in tflite.
+ */
+inline void PReLU(const PReLUParams &params, const Shape &input_shape, const uint8_t *input_data,
+                  const Shape &alpha_shape, const uint8_t *alpha_data, const Shape &output_shape,
+                  uint8_t *output_data)
+{
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input_shape, alpha_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const int32_t input_value =
+              params.input_offset + input_data[SubscriptToIndex(desc1, b, y, x, c)];
+          int32_t output_value;
+          if (input_value >= 0)
+          {
+            output_value = MultiplyByQuantizedMultiplier(input_value, params.output_multiplier_1,
+                                                         params.output_shift_1);
+          }
+          else
+          {
+            const int32_t alpha_value =
+                params.alpha_offset + alpha_data[SubscriptToIndex(desc2, b, y, x, c)];
+            output_value = MultiplyByQuantizedMultiplier(
+                input_value * alpha_value, params.output_multiplier_2, params.output_shift_2);
+          }
+          output_value += params.output_offset;
+          output_value = std::min<int32_t>(std::max<int32_t>(output_value, 0), 255);
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+              static_cast<uint8_t>(output_value);
+        }
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PRELU_H__
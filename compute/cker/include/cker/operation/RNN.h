@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/operation/RecurrentGates.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+
+#include <ruy/context.h>
+
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Run a step of basic RNN, output = activation(W * input + R * hidden_state + bias)
+ *
+ * @param weights Weights packed as a single gate
+ * @note  Output of the step is written to both @c hidden_state_out and @c output_data
+ */
+inline void RNN(FusedActivationFunctionType activation, int n_batch, int n_unit,
+                const float *input_data, RecurrentGates &weights, const float *hidden_state_in,
+                float *hidden_state_out, float *output_data, ruy::Context *ruy_context)
+{
+  assert(weights.n_gates == 1 && weights.n_unit == n_unit);
+
+  weights.compute(n_batch, input_data, hidden_state_in, output_data, ruy_context);
+  ApplyActivationToVector(output_data, n_batch * n_unit, activation, output_data);
+
+  if (hidden_state_out != output_data)
+  {
+    memcpy(hidden_state_out, output_data, n_batch * n_unit * sizeof(float));
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RECURRENT_GATES_H__
+#define __NNFW_CKER_RECURRENT_GATES_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Weights of recurrent cell gates packed to compute all gates with one GEMM
+ *
+ * For each batch, gates = W * input + R * state + bias, where W, R and bias of all gates are
+ * stacked row by row in the order of gates. Float weights are packed as a single matrix of rows
+ * [W | R] which multiplies [input | state]. Hybrid int8 weights keep W and R apart since input
+ * and state are quantized with their own scaling factors.
+ */
+class RecurrentGates
+{
+public:
+  RecurrentGates()
+      : prepared(false), hybrid(false), cache_policy(CachePolicy::kNeverCache), n_gates(0),
+        n_unit(0), n_input(0), n_state(0)
+  {
+    // DO NOTHING
+  }
+
+  /**
+   * @brief Pack float weights of gates
+   * @param input_weights Input weights of each gate, of shape [n_unit, n_input]
+   * @param recurrent_weights Recurrent weights of each gate, of shape [n_unit, n_state]
+   * @param biases Bias of each gate, of shape [n_unit]. nullptr means zero bias.
+   */
+  void pack(int gates, int unit, int input, int state, const float *const *input_weights,
+            const float *const *recurrent_weights, const float *const *biases)
+  {
+    resize(gates, unit, input, state);
+    hybrid = false;
+
+    PackedWeights *packed = ownPackedWeights();
+    const int cols = n_input + n_state;
+    packed->weights.resize(n_gates * n_unit * cols);
+    for (int g = 0; g < n_gates; ++g)
+    {
+      for (int r = 0; r < n_unit; ++r)
+      {
+        float *row = packed->weights.data() + (g * n_unit + r) * cols;
+        memcpy(row, input_weights[g] + r * n_input, n_input * sizeof(float));
+        memcpy(row + n_input, recurrent_weights[g] + r * n_state, n_state * sizeof(float));
+      }
+    }
+    packBiases(biases, packed->bias);
+    prepared = true;
+  }
+
+  /**
+   * @brief Pack symmetric int8 weights of gates, each of which has its own scale
+   */
+  void pack(int gates, int unit, int input, int state, const int8_t *const *input_weights,
+            const float *input_scales, const int8_t *const *recurrent_weights,
+            const float *recurrent_scales, const float *const *biases)
+  {
+    resize(gates, unit, input, state);
+    hybrid = true;
+
+    PackedWeights *packed = ownPackedWeights();
+    packed->input_weights.resize(n_gates * n_unit * n_input);
+    packed->recurrent_weights.resize(n_gates * n_unit * n_state);
+    for (int g = 0; g < n_gates; ++g)
+    {
+      memcpy(packed->input_weights.data() + g * n_unit * n_input, input_weights[g],
+             n_unit * n_input * sizeof(int8_t));
+      memcpy(packed->recurrent_weights.data() + g * n_unit * n_state, recurrent_weights[g],
+             n_unit * n_state * sizeof(int8_t));
+    }
+    packed->input_scales.assign(input_scales, input_scales + n_gates);
+    packed->recurrent_scales.assign(recurrent_scales, recurrent_scales + n_gates);
+    packBiases(biases, packed->bias);
+    prepared = true;
+  }
+
+  /**
+   * @brief Use weights that another RecurrentGates packed with the same arguments
+   * @note  Packed weights do not change after packing, so RecurrentGates of the same weights,
+   *        which may run concurrently, share them while keeping their own scratch buffers
+   */
+  void share(const RecurrentGates &other)
+  {
+    assert(other.prepared);
+    resize(other.n_gates, other.n_unit, other.n_input, other.n_state);
+    hybrid = other.hybrid;
+    _packed = other._packed;
+    prepared = true;
+  }
+
+  /**
+   * @brief Size of packed weights in bytes
+   */
+  size_t weights_size() const
+  {
+    return _packed->weights.size() * sizeof(float) +
+           (_packed->input_weights.size() + _packed->recurrent_weights.size()) * sizeof(int8_t);
+  }
+
+  /**
+   * @brief Address of packed weights, which is the same for RecurrentGates sharing them
+   */
+  const void *weights_data() const { return _packed.get(); }
+
+  /**
+   * @brief Pack weights into the cache of @c ruy_context, which compute() uses from then on
+   * @note  Weights must not be packed again by pack() after this
+   */
+  void prepack(ruy::Context *ruy_context)
+  {
+    assert(prepared);
+    cache_policy = CachePolicy::kAlwaysCache;
+    const int rows = n_gates * n_unit;
+
+    if (!hybrid)
+    {
+      const int cols = n_input + n_state;
+      MatrixParams<float> lhs_params;
+      lhs_params.order = Order::kRowMajor;
+      lhs_params.rows = rows;
+      lhs_params.cols = cols;
+
+      MatrixParams<float> rhs_params;
+      rhs_params.order = Order::kColMajor;
+      rhs_params.rows = cols;
+
+      MatrixParams<float> dst_params;
+      dst_params.order = Order::kColMajor;
+      dst_params.rows = rows;
+
+      ruy_support::PrepackLhs(lhs_params, _packed->weights.data(), rhs_params, dst_params,
+                              GemmParams<float, float>(), ruy_context);
+      return;
+    }
+
+    prepackInt8(n_input, _packed->input_weights.data(), ruy_context);
+    prepackInt8(n_state, _packed->recurrent_weights.data(), ruy_context);
+  }
+
+  /**
+   * @brief Compute gates of all batches
+   * @param gates_data Output of shape [n_batch, n_gates * n_unit]
+   * @note  @c gates_data may be the same as @c state_data
+   */
+  void compute(int n_batch, const float *input_data, const float *state_data, float *gates_data,
+               ruy::Context *ruy_context)
+  {
+    assert(prepared);
+    const int rows = n_gates * n_unit;
+
+    MatrixParams<float> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = rows;
+    dst_params.cols = n_batch;
+
+    if (!hybrid)
+    {
+      const int cols = n_input + n_state;
+      _concat.resize(n_batch * cols);
+      for (int b = 0; b < n_batch; ++b)
+      {
+        memcpy(_concat.data() + b * cols, input_data + b * n_input, n_input * sizeof(float));
+        memcpy(_concat.data() + b * cols + n_input, state_data + b * n_state,
+               n_state * sizeof(float));
+      }
+
+      MatrixParams<float> lhs_params;
+      lhs_params.order = Order::kRowMajor;
+      lhs_params.rows = rows;
+      lhs_params.cols = cols;
+      lhs_params.cache_policy = cache_policy;
+
+      MatrixParams<float> rhs_params;
+      rhs_params.order = Order::kColMajor;
+      rhs_params.rows = cols;
+      rhs_params.cols = n_batch;
+
+      GemmParams<float, float> gemm_params;
+      gemm_params.bias = _packed->bias.data();
+
+      ruy_support::Gemm(lhs_params, _packed->weights.data(), rhs_params, _concat.data(), dst_params,
+                        gates_data, gemm_params, ruy_context);
+      return;
+    }
+
+    quantize(n_batch, n_input, input_data, _input_quantized, _input_scaling_factors);
+    quantize(n_batch, n_state, state_data, _state_quantized, _state_scaling_factors);
+    _input_accum.resize(rows * n_batch);
+    _state_accum.resize(rows * n_batch);
+    multiply(n_batch, n_input, _packed->input_weights.data(), _input_quantized.data(),
+             _input_accum.data(), ruy_context);
+    multiply(n_batch, n_state, _packed->recurrent_weights.data(), _state_quantized.data(),
+             _state_accum.data(), ruy_context);
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      for (int g = 0; g < n_gates; ++g)
+      {
+        const float input_scale = _input_scaling_factors[b] * _packed->input_scales[g];
+        const float state_scale = _state_scaling_factors[b] * _packed->recurrent_scales[g];
+        const int offset = b * rows + g * n_unit;
+        for (int i = 0; i < n_unit; ++i)
+        {
+          gates_data[offset + i] = _packed->bias[g * n_unit + i] +
+                                   _input_accum[offset + i] * input_scale +
+                                   _state_accum[offset + i] * state_scale;
+        }
+      }
+    }
+  }
+
+private:
+  struct PackedWeights
+  {
+    std::vector<float> weights;
+    std::vector<float> bias;
+    std::vector<int8_t> input_weights;
+    std::vector<int8_t> recurrent_weights;
+    std::vector<float> input_scales;
+    std::vector<float> recurrent_scales;
+  };
+
+  void resize(int gates, int unit, int input, int state)
+  {
+    n_gates = gates;
+    n_unit = unit;
+    n_input = input;
+    n_state = state;
+  }
+
+  // Weights are packed again on each run if they are not constant, into the same buffers unless
+  // other RecurrentGates share them
+  PackedWeights *ownPackedWeights()
+  {
+    if (!_packed || _packed.use_count() > 1)
+      _packed = std::make_shared<PackedWeights>();
+    return _packed.get();
+  }
+
+  void packBiases(const float *const *biases, std::vector<float> &bias) const
+  {
+    bias.assign(n_gates * n_unit, 0.f);
+    for (int g = 0; g < n_gates; ++g)
+    {
+      if (biases[g] != nullptr)
+        memcpy(bias.data() + g * n_unit, biases[g], n_unit * sizeof(float));
+    }
+  }
+
+  static void quantize(int n_batch, int size, const float *data, std::vector<int8_t> &quantized,
+                       std::vector<float> &scaling_factors)
+  {
+    quantized.resize(n_batch * size);
+    scaling_factors.resize(n_batch);
+    float unused_min, unused_max;
+    for (int b = 0; b < n_batch; ++b)
+    {
+      SymmetricQuantizeFloats(data + b * size, size, quantized.data() + b * size, &unused_min,
+                              &unused_max, &scaling_factors[b]);
+    }
+  }
+
+  void prepackInt8(int depth, const int8_t *weights, ruy::Context *ruy_context)
+  {
+    MatrixParams<int8_t> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = n_gates * n_unit;
+    lhs_params.cols = depth;
+
+    MatrixParams<int8_t> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = depth;
+
+    MatrixParams<int32_t> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = n_gates * n_unit;
+
+    ruy_support::PrepackLhs(lhs_params, weights, rhs_params, dst_params,
+                            GemmParams<int32_t, int32_t>(), ruy_context);
+  }
+
+  void multiply(int n_batch, int depth, const int8_t *weights, const int8_t *quantized,
+                int32_t *accum, ruy::Context *ruy_context)
+  {
+    MatrixParams<int8_t> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = n_gates * n_unit;
+    lhs_params.cols = depth;
+    lhs_params.cache_policy = cache_policy;
+
+    MatrixParams<int8_t> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = depth;
+    rhs_params.cols = n_batch;
+
+    MatrixParams<int32_t> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = n_gates * n_unit;
+    dst_params.cols = n_batch;
+
+    GemmParams<int32_t, int32_t> gemm_params;
+    ruy_support::Gemm(lhs_params, weights, rhs_params, quantized, dst_params, accum, gemm_params,
+                      ruy_context);
+  }
+
+public:
+  bool prepared;
+  bool hybrid;
+  // Set this to cache packing of weights in ruy when weights never change after pack()
+  CachePolicy cache_policy;
+  int n_gates;
+  int n_unit;
+  int n_input;
+  int n_state;
+
+private:
+  std::shared_ptr<PackedWeights> _packed;
+
+  // Scratch buffers
+  std::vector<float> _concat;
+  std::vector<int8_t> _input_quantized;
+  std::vector<int8_t> _state_quantized;
+  std::vector<float> _input_scaling_factors;
+  std::vector<float> _state_scaling_factors;
+  std::vector<int32_t> _input_accum;
+  std::vector<int32_t> _state_accum;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RECURRENT_GATES_H__
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+#define __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+inline float ResizeNearestNeighborScale(int32_t input_size, int32_t output_size,
+                                        bool align_corners)
+{
+  return (align_corners && output_size > 1)
+             ? (input_size - 1) / static_cast<float>(output_size - 1)
+             : input_size / static_cast<float>(output_size);
+}
+
+inline int32_t ResizeNearestNeighborSource(int32_t out, float scale, int32_t input_size,
+                                           bool align_corners, bool half_pixel_centers)
+{
+  const float offset = half_pixel_centers ? 0.5f : 0.0f;
+  int32_t value = align_corners ? static_cast<int32_t>(std::round((out + offset) * scale))
+                                : static_cast<int32_t>(std::floor((out + offset) * scale));
+  value = std::min(value, input_size - 1);
+  if (half_pixel_centers)
+  {
+    value = std::max(0, value);
+  }
+  return value;
+}
+
+/**
+ * @brief ResizeNearestNeighbor of NHWC data
+ *
+ * Source columns are computed once for all rows. Whole depths of a pixel are copied at once, and a
+ * row of output is copied as a whole when its source row is the same as the previous one.
+ */
+template <typename T>
+inline void ResizeNearestNeighbor(const ResizeNearestNeighborParams &params,
+                                  const Shape &unextended_input_shape, const T *input_data,
+                                  const Shape &unextended_output_shape, T *output_data)
+{
+  assert(unextended_input_shape.DimensionsCount() <= 4);
+  assert(unextended_output_shape.DimensionsCount() <= 4);
+  const Shape input_shape = Shape::ExtendedShape(4, unextended_input_shape);
+  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
+
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+
+  const int32_t output_height = params.output_height;
+  const int32_t output_width = params.output_width;
+  assert(output_shape.Dims(1) == output_height);
+  assert(output_shape.Dims(2) == output_width);
+
+  const float height_scale =
+      ResizeNearestNeighborScale(input_height, output_height, params.align_corners);
+  const float width_scale =
+      ResizeNearestNeighborScale(input_width, output_width, params.align_corners);
+
+  std::vector<int32_t> in_x_offsets(output_width);
+  for (int32_t x = 0; x < output_width; ++x)
+  {
+    in_x_offsets[x] = ResizeNearestNeighborSource(x, width_scale, input_width,
+                                                  params.align_corners, params.half_pixel_centers) *
+                      depth;
+  }
+
+  const int32_t col_offset = input_width * depth;
+  const int32_t batch_offset = input_height * col_offset;
+  const int32_t output_row_size = output_width * depth;
+
+  const T *input_ptr = input_data;
+  T *output_ptr = output_data;
+  for (int32_t b = 0; b < batches; ++b)
+  {
+    int32_t prev_in_y = -1;
+    for (int32_t y = 0; y < output_height; ++y)
+    {
+      const int32_t in_y = ResizeNearestNeighborSource(
+          y, height_scale, input_height, params.align_corners, params.half_pixel_centers);
+      if (in_y == prev_in_y)
+      {
+        memcpy(output_ptr, output_ptr - output_row_size, output_row_size * sizeof(T));
+      }
+      else
+      {
+        const T *y_input_ptr = input_ptr + in_y * col_offset;
+        for (int32_t x = 0; x < output_width; ++x)
+        {
+          memcpy(output_ptr + x * depth, y_input_ptr + in_x_offsets[x], depth * sizeof(T));
+        }
+      }
+      prev_in_y = in_y;
+      output_ptr += output_row_size;
+    }
+    input_ptr += batch_offset;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TOPK_V2_H__
+#define __NNFW_CKER_TOPK_V2_H__
+
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Top k values and their indices along the last dimension, sorted by value in descending
+ *        order and by index for equal values
+ *
+ * Each row is selected by a heap of size k whose front is the worst of the selected values, so
+ * that a row of size n costs O(n log k) instead of sorting the whole row, and most values are
+ * rejected by a single comparison with the front.
+ */
+template <typename T>
+inline void TopKV2(const Shape &input_shape, const T *input_data, int32_t k, T *values_data,
+                   int32_t *indices_data)
+{
+  const int32_t row_size = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  const int32_t num_rows = row_size == 0 ? 0 : input_shape.FlatSize() / row_size;
+  assert(k >= 0 && k <= row_size);
+  if (k == 0)
+    return;
+
+  using Entry = std::pair<T, int32_t>;
+  const auto better = [](const Entry &a, const Entry &b) {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+  };
+
+  std::vector<Entry> heap;
+  heap.reserve(k);
+  for (int32_t row = 0; row < num_rows; ++row)
+  {
+    const T *input = input_data + row * row_size;
+
+    heap.clear();
+    for (int32_t i = 0; i < k; ++i)
+    {
+      heap.emplace_back(input[i], i);
+    }
+    std::make_heap(heap.begin(), heap.end(), better);
+
+    for (int32_t i = k; i < row_size; ++i)
+    {
+      // Indices only increase, so a value equal to the front is never better than it
+      if (input[i] > heap.front().first)
+      {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = Entry(input[i], i);
+        std::push_heap(heap.begin(), heap.end(), better);
+      }
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), better);
+    T *values = values_data + row * k;
+    int32_t *indices = indices_data + row * k;
+    for (int32_t i = 0; i < k; ++i)
+    {
+      values[i] = heap[i].first;
+      indices[i] = heap[i].second;
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TOPK_V2_H__
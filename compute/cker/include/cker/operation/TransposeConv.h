@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
  * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,92 +18,282 @@
 #ifndef __NNFW_CKER_TRANSPOSE_CONV_H__
 #define __NNFW_CKER_TRANSPOSE_CONV_H__
 
+#include "cker/eigen/EigenSupport.h"
+#include "cker/operation/reference/TransposeConv.h"
+#include "cker/ruy/RuySupport.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
 {
 
-inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
-                          const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+/**
+ * @brief Transpose convolution which runs as a GEMM followed by col2im
+ *
+ * The filter of shape [output_depth, filter_height, filter_width, input_depth] is reordered to
+ * [filter_height, filter_width, output_depth, input_depth] once, so that a single GEMM of it and
+ * input pixels computes contributions of every input pixel to its filter_height x filter_width
+ * window of output. Then col2im gathers the contributions into output rows, which are split
+ * across threads by batch and output row.
+ */
+class TransposeConv
 {
+public:
+  TransposeConv()
+      : _float_filter(), _quant_filter(), _float_col(), _quant_col(), _prepared(false),
+        _eigen_device(nullptr)
+  {
+  }
+
+  /**
+   * @brief Set Eigen device that col2im runs on
+   * @note  If it is not set or set to nullptr, the global device of cker is used
+   */
+  void setEigenDevice(const Eigen::ThreadPoolDevice *device) { _eigen_device = device; }
+
+  /**
+   * @brief Reorder the filter in advance, which must not change afterwards
+   */
+  void prepare(const Shape &filter_shape, const float *filter_data)
+  {
+    _float_filter = std::make_shared<std::vector<float>>();
+    transposeFilter(filter_shape, filter_data, *_float_filter);
+    _prepared = true;
+  }
+
+  void prepare(const Shape &filter_shape, const uint8_t *filter_data)
+  {
+    _quant_filter = std::make_shared<std::vector<uint8_t>>();
+    transposeFilter(filter_shape, filter_data, *_quant_filter);
+    _prepared = true;
+  }
 
-  const int stride_width = params.stride_width;
-  const int stride_height = params.stride_height;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
-
-  assert(input_shape.DimensionsCount() == 4);
-  assert(filter_shape.DimensionsCount() == 4);
-  assert(output_shape.DimensionsCount() == 4);
-
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(1);
-  const int filter_width = filter_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
-
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
+  /**
+   * @brief Use the filter that @c other reordered in prepare(), instead of reordering it again
+   */
+  void share(const TransposeConv &other)
   {
-    output_data[i] = 0.0f;
+    assert(other._prepared);
+    _float_filter = other._float_filter;
+    _quant_filter = other._quant_filter;
+    _prepared = true;
   }
 
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
+  /**
+   * @param lease_ruy_context Callable returning a holder of ruy context, whose get() returns the
+   *                          context. It is held only while the GEMM runs, not while col2im runs.
+   */
+  template <typename LeaseRuyContext>
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &output_shape, float *output_data, LeaseRuyContext lease_ruy_context)
   {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+    if (!_prepared)
+    {
+      // This means that filter is not constant
+      if (!_float_filter)
+        _float_filter = std::make_shared<std::vector<float>>();
+      transposeFilter(filter_shape, filter_data, *_float_filter);
+    }
+
+    {
+      const auto ruy_context = lease_ruy_context();
+      GemmParams<float, float> gemm_params;
+      gemm(input_shape, input_data, filter_shape, _float_filter->data(), 0.f, 0.f, gemm_params,
+           _float_col, ruy_context.get());
+    }
+
+    const int row_size = output_shape.Dims(2) * output_shape.Dims(3);
+    col2im(params, input_shape, filter_shape, output_shape, _float_col.data(),
+           [&](int batch, int out_y, const float *row) {
+             memcpy(output_data + Offset(output_shape, batch, out_y, 0, 0), row,
+                    row_size * sizeof(float));
+           });
+  }
+
+  template <typename LeaseRuyContext>
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const uint8_t *input_data, const Shape &filter_shape, const uint8_t *filter_data,
+                  const Shape &output_shape, uint8_t *output_data,
+                  LeaseRuyContext lease_ruy_context)
+  {
+    if (!_prepared)
+    {
+      // This means that filter is not constant
+      if (!_quant_filter)
+        _quant_filter = std::make_shared<std::vector<uint8_t>>();
+      transposeFilter(filter_shape, filter_data, *_quant_filter);
+    }
+
+    // Zero points are subtracted by GEMM, so that col2im only needs to sum up raw accumulators
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
+      const auto ruy_context = lease_ruy_context();
+      GemmParams<int32_t, int32_t> gemm_params;
+      gemm(input_shape, input_data, filter_shape, _quant_filter->data(),
+           static_cast<uint8_t>(-params.input_offset),
+           static_cast<uint8_t>(-params.weights_offset), gemm_params, _quant_col,
+           ruy_context.get());
+    }
+
+    const int row_size = output_shape.Dims(2) * output_shape.Dims(3);
+    col2im(params, input_shape, filter_shape, output_shape, _quant_col.data(),
+           [&](int batch, int out_y, const int32_t *row) {
+             uint8_t *output_row = output_data + Offset(output_shape, batch, out_y, 0, 0);
+             for (int i = 0; i < row_size; ++i)
+             {
+               int32_t acc = MultiplyByQuantizedMultiplier(row[i], params.output_multiplier,
+                                                           params.output_shift);
+               acc += params.output_offset;
+               acc = std::max(acc, params.quantized_activation_min);
+               acc = std::min(acc, params.quantized_activation_max);
+               output_row[i] = static_cast<uint8_t>(acc);
+             }
+           });
+  }
+
+private:
+  template <typename T>
+  void transposeFilter(const Shape &filter_shape, const T *filter_data, std::vector<T> &dst)
+  {
+    const int output_depth = filter_shape.Dims(0);
+    const int filter_size = filter_shape.Dims(1) * filter_shape.Dims(2);
+    const int input_depth = filter_shape.Dims(3);
+    dst.resize(filter_shape.FlatSize());
+    for (int o = 0; o < output_depth; ++o)
+    {
+      for (int k = 0; k < filter_size; ++k)
+      {
+        memcpy(dst.data() + (k * output_depth + o) * input_depth,
+               filter_data + (o * filter_size + k) * input_depth, input_depth * sizeof(T));
+      }
+    }
+  }
+
+  // col = filter * input, where each column of col has contributions of an input pixel
+  template <typename T, typename AccumT>
+  void gemm(const Shape &input_shape, const T *input_data, const Shape &filter_shape,
+            const T *filter_data, T input_zero_point, T filter_zero_point,
+            const GemmParams<AccumT, AccumT> &gemm_params, std::vector<AccumT> &col,
+            ruy::Context *ruy_context)
+  {
+    const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+    const int num_pixels = input_shape.FlatSize() / input_depth;
+    const int col_rows = filter_shape.FlatSize() / input_depth;
+
+    MatrixParams<T> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = col_rows;
+    lhs_params.cols = input_depth;
+    lhs_params.zero_point = filter_zero_point;
+    lhs_params.cache_policy =
+        _prepared ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
+
+    MatrixParams<T> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = input_depth;
+    rhs_params.cols = num_pixels;
+    rhs_params.zero_point = input_zero_point;
+
+    MatrixParams<AccumT> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = col_rows;
+    dst_params.cols = num_pixels;
+
+    col.resize(col_rows * num_pixels);
+    ruy_support::Gemm(lhs_params, filter_data, rhs_params, input_data, dst_params, col.data(),
+                      gemm_params, ruy_context);
+  }
+
+  // Sum up contributions to each output row and pass the row to store(batch, out_y, row)
+  template <typename AccumT, typename StoreFn>
+  void col2im(const TransposeConvParams &params, const Shape &input_shape,
+              const Shape &filter_shape, const Shape &output_shape, const AccumT *col_data,
+              StoreFn store)
+  {
+    const int stride_width = params.stride_width;
+    const int stride_height = params.stride_height;
+    const int pad_width = params.padding_values.width;
+    const int pad_height = params.padding_values.height;
+
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+    const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+    const int input_height = input_shape.Dims(1);
+    const int input_width = input_shape.Dims(2);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int output_height = output_shape.Dims(1);
+    const int output_width = output_shape.Dims(2);
+    const int row_size = output_width * output_depth;
+    const int col_size = filter_height * filter_width * output_depth;
+
+    auto compute_rows = [&](Eigen::Index first, Eigen::Index last) {
+      std::vector<AccumT> row(row_size);
+      for (Eigen::Index i = first; i < last; ++i)
       {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+        const int batch = i / output_height;
+        const int out_y = i % output_height;
+        std::fill(row.begin(), row.end(), 0);
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
         {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          const int in_y_origin = out_y + pad_height - filter_y;
+          if (in_y_origin < 0 || in_y_origin % stride_height != 0)
+            continue;
+          const int in_y = in_y_origin / stride_height;
+          if (in_y >= input_height)
+            continue;
+          for (int in_x = 0; in_x < input_width; ++in_x)
           {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            const AccumT *col =
+                col_data + ((batch * input_height + in_y) * input_width + in_x) * col_size +
+                filter_y * filter_width * output_depth;
+            const int out_x_origin = in_x * stride_width - pad_width;
+            const int filter_x_begin = std::max(0, -out_x_origin);
+            const int filter_x_end = std::min(filter_width, output_width - out_x_origin);
+            for (int filter_x = filter_x_begin; filter_x < filter_x_end; ++filter_x)
             {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+              AccumT *out = row.data() + (out_x_origin + filter_x) * output_depth;
+              const AccumT *contribution = col + filter_x * output_depth;
+              for (int c = 0; c < output_depth; ++c)
               {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                      input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value = filter_data[Offset(filter_shape, out_channel, filter_y,
-                                                          filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                      input_value * filter_value;
-                }
+                out[c] += contribution[c];
               }
             }
           }
         }
+        store(batch, out_y, row.data());
       }
-    }
+    };
+
+    const Eigen::ThreadPoolDevice &device =
+        _eigen_device ? *_eigen_device : *eigen_support::GetThreadPoolDevice();
+    const double row_cost = static_cast<double>(row_size) * filter_height / stride_height *
+                            filter_width / stride_width;
+    device.parallelFor(batches * output_height,
+                       Eigen::TensorOpCost(row_cost * sizeof(AccumT), row_size * sizeof(AccumT),
+                                           row_cost),
+                       compute_rows);
   }
-}
+
+private:
+  // Prepared filters may be shared by kernels of the same constant filter
+  std::shared_ptr<std::vector<float>> _float_filter;
+  std::shared_ptr<std::vector<uint8_t>> _quant_filter;
+  std::vector<float> _float_col;
+  std::vector<int32_t> _quant_col;
+  bool _prepared;
+  const Eigen::ThreadPoolDevice *_eigen_device;
+};
 
 } // namespace cker
 } // namespace nnfw
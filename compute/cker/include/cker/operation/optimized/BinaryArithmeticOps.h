@@ -24,6 +24,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/x86/BinaryArithmeticOps.h"
 #include "fixedpoint/fixedpoint.h"
 
 namespace nnfw
@@ -263,6 +264,10 @@ inline void AddElementwise(int size, const BinaryArithmeticOpParam &params,
     x = vminq_f32(activation_max, x);
     vst1q_f32(output_data + i, x);
   }
+#elif defined(USE_X86_SIMD)
+  i = X86BinaryElementwise<X86BinaryOp::kAdd>(size, input1_data, input2_data, output_data,
+                                              params.float_activation_min,
+                                              params.float_activation_max);
 #endif // NEON
   for (; i < size; i++)
   {
@@ -322,6 +327,10 @@ inline void AddScalarBroadcast(int size, const BinaryArithmeticOpParam &params,
         vmaxq_f32(output_activation_min_vector, vminq_f32(output_activation_max_vector, output));
     vst1q_f32(output_data + i, clamped);
   }
+#elif defined(USE_X86_SIMD)
+  i = X86BinaryScalarBroadcast<X86BinaryOp::kAdd>(size, broadcast_value, input2_data, output_data,
+                                                  params.float_activation_min,
+                                                  params.float_activation_max);
 #endif // NEON
   for (; i < size; ++i)
   {
@@ -426,6 +435,10 @@ inline void Sub(const BinaryArithmeticOpParam &params, const Shape &input1_shape
     x = vminq_f32(activation_max, x);
     vst1q_f32(output_data + i, x);
   }
+#elif defined(USE_X86_SIMD)
+  i = X86BinaryElementwise<X86BinaryOp::kSub>(size, input1_data, input2_data, output_data,
+                                              params.float_activation_min,
+                                              params.float_activation_max);
 #endif // NEON
 
   for (; i < size; i++)
@@ -560,6 +573,10 @@ inline void MulElementwise(int size, const BinaryArithmeticOpParam &params,
     x = vminq_f32(activation_max, x);
     vst1q_f32(output_data + i, x);
   }
+#elif defined(USE_X86_SIMD)
+  i = X86BinaryElementwise<X86BinaryOp::kMul>(size, input1_data, input2_data, output_data,
+                                              params.float_activation_min,
+                                              params.float_activation_max);
 #endif // NEON
 
   for (; i < size; i++)
@@ -621,6 +638,10 @@ inline void MulSimpleBroadcast(int size, const BinaryArithmeticOpParam &params,
         vmaxq_f32(output_activation_min_vector, vminq_f32(output_activation_max_vector, output));
     vst1q_f32(output_data + i, clamped);
   }
+#elif defined(USE_X86_SIMD)
+  i = X86BinaryScalarBroadcast<X86BinaryOp::kMul>(size, broadcast_value, input2_data, output_data,
+                                                  params.float_activation_min,
+                                                  params.float_activation_max);
 #endif // NEON
 
   for (; i < size; ++i)
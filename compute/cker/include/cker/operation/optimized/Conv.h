@@ -25,12 +25,14 @@
 #include "cker/gemmlowp/GEMMSupport.h"
 #include "cker/neon/neon_check.h"
 #include "cker/operation/Common.h"
+#include "cker/ruy/RuySupport.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
 #include <public/gemmlowp.h>
 #include <public/map.h>
 #include <fixedpoint/fixedpoint.h>
+#include <ruy/context.h>
 
 #include <vector>
 #include <tuple>
@@ -169,6 +171,107 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const uint8
       output_pipeline);
 }
 
+// Int8 convolution whose filter is quantized symmetrically per output channel
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int32_t *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, const Shape &im2col_shape, int8_t *im2col_data,
+                           ruy::Context *ruy_context)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int8_t *gemm_input_data = nullptr;
+  const Shape *gemm_input_shape = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  // Dilation does not matter along a dimension of which filter size is 1
+  const bool need_dilated_im2col = (dilation_width_factor != 1 && filter_width != 1) ||
+                                   (dilation_height_factor != 1 && filter_height != 1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  const int32_t input_zero_point = -input_offset;
+  assert(input_zero_point >= std::numeric_limits<int8_t>::lowest());
+  assert(input_zero_point <= std::numeric_limits<int8_t>::max());
+  if (need_dilated_im2col)
+  {
+    assert(im2col_data);
+    DilatedIm2col<int8_t>(params, input_shape, input_data, filter_shape, output_shape,
+                          im2col_data, &input_zero_point, 1);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else if (need_im2col)
+  {
+    assert(im2col_data);
+    // Padding is filled byte by byte with the zero point
+    const uint8_t zero_byte = static_cast<uint8_t>(static_cast<int8_t>(input_zero_point));
+    Im2col(params, filter_height, filter_width, zero_byte, input_shape, input_data, im2col_shape,
+           im2col_data);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else
+  {
+    gemm_input_data = input_data;
+    gemm_input_shape = &input_shape;
+  }
+
+  const int gemm_input_rows = gemm_input_shape->Dims(3);
+  const int gemm_input_cols =
+      gemm_input_shape->Dims(0) * gemm_input_shape->Dims(1) * gemm_input_shape->Dims(2);
+  const int filter_rows = filter_shape.Dims(0);
+  const int filter_cols = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  const int output_rows = output_shape.Dims(3);
+  const int output_cols = output_shape.Dims(0) * output_shape.Dims(1) * output_shape.Dims(2);
+  assert(output_rows == filter_rows);
+  assert(output_cols == gemm_input_cols);
+  assert(filter_cols == gemm_input_rows);
+  assert(bias_shape.FlatSize() == output_rows);
+  UNUSED_RELEASE(output_cols);
+  UNUSED_RELEASE(bias_shape);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = filter_rows;
+  lhs_params.cols = filter_cols;
+  lhs_params.zero_point = 0; // filter is quantized symmetrically
+  lhs_params.cache_policy = DefaultCachePolicy(params.lhs_cacheable);
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = gemm_input_rows;
+  rhs_params.cols = gemm_input_cols;
+  rhs_params.zero_point = input_zero_point;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_rows;
+  dst_params.cols = gemm_input_cols;
+  dst_params.zero_point = output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = output_activation_min;
+  gemm_params.clamp_max = output_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  ruy_support::Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params, output_data,
+                    gemm_params, ruy_context);
+}
+
 } // namespace optimized
 
 namespace multithreaded
@@ -247,12 +350,11 @@ public:
 };
 } // namespace
 
-inline void Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
-                 const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
-                 const float *bias_data, const Shape &output_shape, float *output_data)
+inline void Conv(const Eigen::ThreadPoolDevice &device, const ConvParams &params,
+                 const Shape &input_shape, const float *input_data, const Shape &filter_shape,
+                 const float *filter_data, const Shape &bias_shape, const float *bias_data,
+                 const Shape &output_shape, float *output_data)
 {
-  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
-
   const int stride_width = params.stride_width;
   const int stride_height = params.stride_height;
   const PaddingType padding = params.padding_type;
@@ -283,6 +385,15 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const float
                                               bias_shape, bias_data, output_shape, output_data);
 }
 
+inline void Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                 const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
+                 const float *bias_data, const Shape &output_shape, float *output_data)
+{
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  Conv(device, params, input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+       output_shape, output_data);
+}
+
 } // namespace multithreaded
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// acc[i] += filter[i] * input[i]
+inline void FloatDepthwiseConvMultiplyAccumulate(const float *filter, const float *input, int size,
+                                                 float *acc)
+{
+  int i = 0;
+#ifdef USE_NEON
+  for (; i <= size - 4; i += 4)
+  {
+    float32x4_t acc_vec = vld1q_f32(acc + i);
+    acc_vec = vmlaq_f32(acc_vec, vld1q_f32(filter + i), vld1q_f32(input + i));
+    vst1q_f32(acc + i, acc_vec);
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    acc[i] += filter[i] * input[i];
+  }
+}
+
+// output[i] = clamp(acc[i], activation_min, activation_max)
+inline void FloatDepthwiseConvStore(const float *acc, int size, float output_activation_min,
+                                    float output_activation_max, float *output)
+{
+  int i = 0;
+#ifdef USE_NEON
+  const float32x4_t min_vec = vdupq_n_f32(output_activation_min);
+  const float32x4_t max_vec = vdupq_n_f32(output_activation_max);
+  for (; i <= size - 4; i += 4)
+  {
+    float32x4_t acc_vec = vld1q_f32(acc + i);
+    acc_vec = vmaxq_f32(vminq_f32(acc_vec, max_vec), min_vec);
+    vst1q_f32(output + i, acc_vec);
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    output[i] = ActivationFunctionWithMinMax(acc[i], output_activation_min, output_activation_max);
+  }
+}
+
+// Accumulates products of a filter tap and an input row into acc_buffer for output pixels in
+// [out_x_begin, out_x_end), whose out_x'th entry of output_depth values belongs to pixel out_x
+inline void FloatDepthwiseConvAccumRow(int stride, int dilation_factor, int input_depth,
+                                       int input_width, const float *input_data, int pad_width,
+                                       int depth_multiplier, int filter_x,
+                                       const float *filter_data, int out_x_begin, int out_x_end,
+                                       float *acc_buffer)
+{
+  const int output_depth = input_depth * depth_multiplier;
+  // Narrow the range to out_x of which in_x = out_x * stride + in_x_offset is in the input
+  const int in_x_offset = dilation_factor * filter_x - pad_width;
+  if (in_x_offset < 0)
+  {
+    out_x_begin = std::max(out_x_begin, (-in_x_offset + stride - 1) / stride);
+  }
+  out_x_end = std::min(out_x_end, (input_width - in_x_offset + stride - 1) / stride);
+
+  for (int out_x = out_x_begin; out_x < out_x_end; ++out_x)
+  {
+    const float *input_ptr = input_data + (out_x * stride + in_x_offset) * input_depth;
+    float *acc_ptr = acc_buffer + out_x * output_depth;
+    if (depth_multiplier == 1)
+    {
+      FloatDepthwiseConvMultiplyAccumulate(filter_data, input_ptr, input_depth, acc_ptr);
+    }
+    else
+    {
+      for (int ic = 0; ic < input_depth; ++ic)
+      {
+        const float input_val = input_ptr[ic];
+        for (int m = 0; m < depth_multiplier; ++m)
+        {
+          acc_ptr[ic * depth_multiplier + m] += filter_data[ic * depth_multiplier + m] * input_val;
+        }
+      }
+    }
+  }
+}
+
+// Computes output pixels in [out_x_begin, out_x_end) of a 3x3 filter with depth multiplier 1,
+// whose receptive fields are entirely inside the input. Channels are the innermost loop, so that
+// all 9 taps are accumulated in registers before output is stored.
+template <int kStride>
+inline void FloatDepthwiseConv3x3Row(int depth, const float *const input_rows[3],
+                                     const float *filter_data, const float *bias_data,
+                                     int pad_width, int out_x_begin, int out_x_end,
+                                     float output_activation_min, float output_activation_max,
+                                     float *output_row)
+{
+  for (int out_x = out_x_begin; out_x < out_x_end; ++out_x)
+  {
+    const int in_x = out_x * kStride - pad_width;
+    float *output_ptr = output_row + out_x * depth;
+    int c = 0;
+#ifdef USE_NEON
+    const float32x4_t min_vec = vdupq_n_f32(output_activation_min);
+    const float32x4_t max_vec = vdupq_n_f32(output_activation_max);
+    for (; c <= depth - 4; c += 4)
+    {
+      float32x4_t acc = bias_data ? vld1q_f32(bias_data + c) : vdupq_n_f32(0.f);
+      for (int filter_y = 0; filter_y < 3; ++filter_y)
+      {
+        const float *input_ptr = input_rows[filter_y] + in_x * depth + c;
+        const float *filter_ptr = filter_data + filter_y * 3 * depth + c;
+        acc = vmlaq_f32(acc, vld1q_f32(input_ptr), vld1q_f32(filter_ptr));
+        acc = vmlaq_f32(acc, vld1q_f32(input_ptr + depth), vld1q_f32(filter_ptr + depth));
+        acc = vmlaq_f32(acc, vld1q_f32(input_ptr + 2 * depth), vld1q_f32(filter_ptr + 2 * depth));
+      }
+      acc = vmaxq_f32(vminq_f32(acc, max_vec), min_vec);
+      vst1q_f32(output_ptr + c, acc);
+    }
+#endif
+    for (; c < depth; ++c)
+    {
+      float acc = bias_data ? bias_data[c] : 0.f;
+      for (int filter_y = 0; filter_y < 3; ++filter_y)
+      {
+        const float *input_ptr = input_rows[filter_y] + in_x * depth + c;
+        const float *filter_ptr = filter_data + filter_y * 3 * depth + c;
+        acc += input_ptr[0] * filter_ptr[0];
+        acc += input_ptr[depth] * filter_ptr[depth];
+        acc += input_ptr[2 * depth] * filter_ptr[2 * depth];
+      }
+      output_ptr[c] = ActivationFunctionWithMinMax(acc, output_activation_min,
+                                                   output_activation_max);
+    }
+  }
+}
+
+inline bool IsFloatDepthwiseConv3x3Supported(const DepthwiseConvParams &params,
+                                             const Shape &filter_shape)
+{
+  return filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3 && params.depth_multiplier == 1 &&
+         params.dilation_width_factor == 1 && params.dilation_height_factor == 1 &&
+         (params.stride_width == 1 || params.stride_width == 2);
+}
+
+// Computes a row of output. acc_buffer must have room for the row.
+inline void FloatDepthwiseConvRow(const DepthwiseConvParams &params, const Shape &input_shape,
+                                  const float *input_data, const Shape &filter_shape,
+                                  const float *filter_data, const float *bias_data,
+                                  const Shape &output_shape, float *output_data, int batch,
+                                  int out_y, bool use_3x3_kernel, float *acc_buffer)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int in_y_origin = out_y * stride_height - pad_height;
+  float *output_row = output_data + Offset(output_shape, batch, out_y, 0, 0);
+
+  // Output pixels in [fast_begin, fast_end) are computed by the 3x3 kernel
+  int fast_begin = 0;
+  int fast_end = 0;
+  if (use_3x3_kernel && in_y_origin >= 0 && in_y_origin + 2 < input_height)
+  {
+    fast_begin = std::min(output_width, (pad_width + stride_width - 1) / stride_width);
+    fast_end = input_width - 3 + pad_width >= 0
+                   ? std::min(output_width, (input_width - 3 + pad_width) / stride_width + 1)
+                   : 0;
+    fast_end = std::max(fast_begin, fast_end);
+  }
+
+  // The others are accumulated in acc_buffer tap by tap of the filter
+  auto compute_generic = [&](int out_x_begin, int out_x_end) {
+    if (out_x_begin >= out_x_end)
+      return;
+
+    float *acc_begin = acc_buffer + out_x_begin * output_depth;
+    const int acc_size = (out_x_end - out_x_begin) * output_depth;
+    if (bias_data)
+    {
+      for (int out_x = out_x_begin; out_x < out_x_end; ++out_x)
+      {
+        memcpy(acc_buffer + out_x * output_depth, bias_data, output_depth * sizeof(float));
+      }
+    }
+    else
+    {
+      std::fill(acc_begin, acc_begin + acc_size, 0.f);
+    }
+
+    for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+    {
+      const int in_y = in_y_origin + dilation_height_factor * filter_y;
+      if (in_y < 0 || in_y >= input_height)
+        continue;
+
+      for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+      {
+        FloatDepthwiseConvAccumRow(stride_width, dilation_width_factor, input_depth, input_width,
+                                   input_data + Offset(input_shape, batch, in_y, 0, 0), pad_width,
+                                   depth_multiplier, filter_x,
+                                   filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0),
+                                   out_x_begin, out_x_end, acc_buffer);
+      }
+    }
+
+    FloatDepthwiseConvStore(acc_begin, acc_size, output_activation_min, output_activation_max,
+                            output_row + out_x_begin * output_depth);
+  };
+
+  compute_generic(0, fast_begin);
+  compute_generic(fast_end, output_width);
+
+  if (fast_begin < fast_end)
+  {
+    const float *const input_rows[3] = {
+        input_data + Offset(input_shape, batch, in_y_origin, 0, 0),
+        input_data + Offset(input_shape, batch, in_y_origin + 1, 0, 0),
+        input_data + Offset(input_shape, batch, in_y_origin + 2, 0, 0)};
+    if (stride_width == 1)
+    {
+      FloatDepthwiseConv3x3Row<1>(output_depth, input_rows, filter_data, bias_data, pad_width,
+                                  fast_begin, fast_end, output_activation_min,
+                                  output_activation_max, output_row);
+    }
+    else
+    {
+      FloatDepthwiseConv3x3Row<2>(output_depth, input_rows, filter_data, bias_data, pad_width,
+                                  fast_begin, fast_end, output_activation_min,
+                                  output_activation_max, output_row);
+    }
+  }
+}
+
+/**
+ * @brief Float depthwise convolution whose output rows are split across threads of device
+ *
+ * 3x3 filters with stride 1 or 2 and depth multiplier 1, which are the most common in MobileNet
+ * style models, run a kernel that accumulates all taps in registers for pixels not touching
+ * padding. Other pixels and filters are accumulated row by row into a buffer of a thread.
+ */
+inline void DepthwiseConv(const Eigen::ThreadPoolDevice &device,
+                          const DepthwiseConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const Shape &bias_shape, const float *bias_data,
+                          const Shape &output_shape, float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  const bool use_3x3_kernel = IsFloatDepthwiseConv3x3Supported(params, filter_shape);
+  const int row_size = output_width * output_depth;
+
+  auto compute_rows = [&](Eigen::Index first, Eigen::Index last) {
+    std::vector<float> acc_buffer(row_size);
+    for (Eigen::Index i = first; i < last; ++i)
+    {
+      FloatDepthwiseConvRow(params, input_shape, input_data, filter_shape, filter_data, bias_data,
+                            output_shape, output_data, i / output_height, i % output_height,
+                            use_3x3_kernel, acc_buffer.data());
+    }
+  };
+
+  const double row_cost = static_cast<double>(row_size) * filter_height * filter_width;
+  device.parallelFor(batches * output_height,
+                     Eigen::TensorOpCost(row_cost * sizeof(float), row_size * sizeof(float),
+                                         row_cost),
+                     compute_rows);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
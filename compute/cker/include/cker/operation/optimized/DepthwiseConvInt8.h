@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Accumulates products of a filter tap and input pixels of a row into acc_buffer, whose
+// out_x'th entry of output_depth values belongs to output pixel out_x
+inline void DepthwiseConvPerChannelAccumRow(int stride, int dilation_factor, int input_depth,
+                                            int input_width, const int8_t *input_data,
+                                            int32_t input_offset, int pad_width,
+                                            int depth_multiplier, int filter_x,
+                                            const int8_t *filter_data, int output_width,
+                                            int32_t *acc_buffer)
+{
+  const int output_depth = input_depth * depth_multiplier;
+  // Range of out_x of which in_x = out_x * stride - pad_width + dilation_factor * filter_x is in
+  // [0, input_width)
+  const int in_x_offset = dilation_factor * filter_x - pad_width;
+  const int out_x_begin = std::max(0, (-in_x_offset + stride - 1) / stride);
+  const int out_x_end = std::min(output_width, (input_width - in_x_offset + stride - 1) / stride);
+
+  for (int out_x = out_x_begin; out_x < out_x_end; ++out_x)
+  {
+    const int8_t *input_ptr = input_data + (out_x * stride + in_x_offset) * input_depth;
+    int32_t *acc_ptr = acc_buffer + out_x * output_depth;
+    if (depth_multiplier == 1)
+    {
+      for (int c = 0; c < output_depth; ++c)
+      {
+        acc_ptr[c] += static_cast<int32_t>(filter_data[c]) * (input_ptr[c] + input_offset);
+      }
+    }
+    else
+    {
+      for (int ic = 0; ic < input_depth; ++ic)
+      {
+        const int32_t input_val = input_ptr[ic] + input_offset;
+        for (int m = 0; m < depth_multiplier; ++m)
+        {
+          const int oc = ic * depth_multiplier + m;
+          acc_ptr[oc] += static_cast<int32_t>(filter_data[oc]) * input_val;
+        }
+      }
+    }
+  }
+}
+
+// Int8 depthwise convolution whose filter is quantized symmetrically per output channel
+//
+// Each output row is accumulated in int32 tap by tap of the filter, so that the innermost loop
+// runs over contiguous channels, and then requantized with the multiplier of its channel.
+inline void DepthwiseConvPerChannel(const DepthwiseConvParams &params,
+                                    const int32_t *output_multiplier, const int32_t *output_shift,
+                                    const Shape &input_shape, const int8_t *input_data,
+                                    const Shape &filter_shape, const int8_t *filter_data,
+                                    const Shape &bias_shape, const int32_t *bias_data,
+                                    const Shape &output_shape, int8_t *output_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(output_activation_min <= output_activation_max);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_depth * depth_multiplier);
+  assert(bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  const int row_size = output_width * output_depth;
+  std::vector<int32_t> acc_buffer(row_size);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      if (bias_data)
+      {
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          memcpy(acc_buffer.data() + out_x * output_depth, bias_data,
+                 output_depth * sizeof(int32_t));
+        }
+      }
+      else
+      {
+        std::fill(acc_buffer.begin(), acc_buffer.end(), 0);
+      }
+
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = out_y * stride_height - pad_height + dilation_height_factor * filter_y;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          DepthwiseConvPerChannelAccumRow(
+              stride_width, dilation_width_factor, input_depth, input_width,
+              input_data + Offset(input_shape, b, in_y, 0, 0), input_offset, pad_width,
+              depth_multiplier, filter_x,
+              filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0), output_width,
+              acc_buffer.data());
+        }
+      }
+
+      int8_t *output_ptr = output_data + Offset(output_shape, b, out_y, 0, 0);
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int32_t *acc_ptr = acc_buffer.data() + out_x * output_depth;
+        for (int c = 0; c < output_depth; ++c)
+        {
+          int32_t acc = MultiplyByQuantizedMultiplier(acc_ptr[c], output_multiplier[c],
+                                                      output_shift[c]);
+          acc += output_offset;
+          acc = std::max(acc, output_activation_min);
+          acc = std::min(acc, output_activation_max);
+          output_ptr[out_x * output_depth + c] = static_cast<int8_t>(acc);
+        }
+      }
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
@@ -22,6 +22,7 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/DepthwiseConvUint8.h"
 
 #include <fixedpoint/fixedpoint.h>
 #include <public/gemmlowp.h>
@@ -1904,6 +1905,11 @@ inline void DepthwiseConvGeneral(const DepthwiseConvParams &params, const Shape
   TFMINI_USE_DEPTHWISECONV_KERNEL(true, 0, 1)
   TFMINI_USE_DEPTHWISECONV_KERNEL(true, 0, 2)
   TFMINI_USE_DEPTHWISECONV_KERNEL(true, 0, 3)
+#elif defined(USE_X86_SIMD)
+  if (depth_multiplier == 1)
+  {
+    row_accum_func = X86QuantizedDepthwiseConvAccumRowDepthMultiplier1;
+  }
 #endif // USE_NEON
 
   // No matching fast kernel found, use slow fallback.
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Transform matrices of Winograd F(m x m, 3 x 3), which computes an output tile of m x m
+ *        from an input tile of (m + 2) x (m + 2)
+ *
+ * Output tile is A^T [(G g G^T) * (B^T d B)] A for a 3x3 filter g and an input tile d.
+ */
+struct WinogradTransformMatrices
+{
+  int output_tile;
+  int input_tile;
+  const float *bt; // input_tile x input_tile
+  const float *g;  // input_tile x 3
+  const float *at; // output_tile x input_tile
+};
+
+inline const WinogradTransformMatrices &GetWinogradTransformMatrices(int output_tile)
+{
+  static const float bt2[] = {1, 0, -1, 0, 0, 1, 1, 0, 0, -1, 1, 0, 0, 1, 0, -1};
+  static const float g2[] = {1, 0, 0, 0.5f, 0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0, 0, 1};
+  static const float at2[] = {1, 1, 1, 0, 0, 1, -1, -1};
+  static const WinogradTransformMatrices f2{2, 4, bt2, g2, at2};
+
+  static const float bt4[] = {4, 0, -5, 0,  1, 0, 0, -4, -4, 1,  1, 0, 0, 4, -4, -1, 1, 0,
+                              0, -2, -1, 2, 1, 0, 0, 2,  -1, -2, 1, 0, 0, 4, 0,  -5, 0, 1};
+  static const float g4[] = {1.f / 4,  0,        0,       -1.f / 6, -1.f / 6,  -1.f / 6,
+                             -1.f / 6, 1.f / 6,  -1.f / 6, 1.f / 24, 1.f / 12, 1.f / 6,
+                             1.f / 24, -1.f / 12, 1.f / 6, 0,        0,        1};
+  static const float at4[] = {1, 1, 1, 1, 1,  0, 0, 1, -1, 2, -2, 0,
+                              0, 1, 1, 4, 4, 0, 0, 1, -1, 8, -8, 1};
+  static const WinogradTransformMatrices f4{4, 6, bt4, g4, at4};
+
+  assert(output_tile == 2 || output_tile == 4);
+  return output_tile == 2 ? f2 : f4;
+}
+
+/**
+ * @brief Returns whether a convolution can run with Winograd
+ * @note  Shallow convolutions, such as the first layer of image models, are left to GEMM since
+ *        transforms would cost more than multiplications they save
+ */
+inline bool IsWinogradConvSupported(const Shape &filter_shape, int stride_width, int stride_height,
+                                    int dilation_width_factor, int dilation_height_factor)
+{
+  return filter_shape.DimensionsCount() == 4 && filter_shape.Dims(1) == 3 &&
+         filter_shape.Dims(2) == 3 && stride_width == 1 && stride_height == 1 &&
+         dilation_width_factor == 1 && dilation_height_factor == 1 && filter_shape.Dims(0) >= 8 &&
+         filter_shape.Dims(3) >= 8;
+}
+
+/**
+ * @brief Returns the size of output tiles for the output shape
+ *
+ * F(4x4, 3x3) needs 2.25 multiplications per output against 4 of F(2x2, 3x3), but it wastes most
+ * of its tile on outputs smaller than the tile.
+ */
+inline int WinogradOutputTile(const Shape &output_shape)
+{
+  if (output_shape.DimensionsCount() == 4 && output_shape.Dims(1) >= 4 &&
+      output_shape.Dims(2) >= 4)
+    return 4;
+  return 2;
+}
+
+// out[i][j] = sum_k mat[i][k] * in[k][j], where elements of in and out are vectors of depth
+inline void WinogradTransformRows(const float *mat, int out_rows, int in_rows, int cols, int depth,
+                                  const float *in, int in_row_stride, int in_col_stride,
+                                  float *out, int out_row_stride, int out_col_stride)
+{
+  for (int i = 0; i < out_rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      float *out_vec = out + i * out_row_stride + j * out_col_stride;
+      std::fill(out_vec, out_vec + depth, 0.f);
+      for (int k = 0; k < in_rows; ++k)
+      {
+        const float coef = mat[i * in_rows + k];
+        if (coef == 0.f)
+          continue;
+        const float *in_vec = in + k * in_row_stride + j * in_col_stride;
+        for (int c = 0; c < depth; ++c)
+        {
+          out_vec[c] += coef * in_vec[c];
+        }
+      }
+    }
+  }
+}
+
+// out[i][j] = sum_k in[i][k] * mat[j][k], where elements of in and out are vectors of depth
+inline void WinogradTransformCols(const float *mat, int rows, int out_cols, int in_cols, int depth,
+                                  const float *in, int in_row_stride, int in_col_stride,
+                                  float *out, int out_row_stride, int out_col_stride)
+{
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < out_cols; ++j)
+    {
+      float *out_vec = out + i * out_row_stride + j * out_col_stride;
+      std::fill(out_vec, out_vec + depth, 0.f);
+      for (int k = 0; k < in_cols; ++k)
+      {
+        const float coef = mat[j * in_cols + k];
+        if (coef == 0.f)
+          continue;
+        const float *in_vec = in + i * in_row_stride + k * in_col_stride;
+        for (int c = 0; c < depth; ++c)
+        {
+          out_vec[c] += coef * in_vec[c];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Transform a filter of shape [output_depth, 3, 3, input_depth] to G g G^T
+ *
+ * The transformed filter is laid out as [input_tile^2, output_depth, input_depth], so that each
+ * of input_tile^2 positions is a column-major matrix of input_depth x output_depth.
+ */
+inline void WinogradTransformFilter(int output_tile, const Shape &filter_shape,
+                                    const float *filter_data, std::vector<float> &transformed)
+{
+  const auto &matrices = GetWinogradTransformMatrices(output_tile);
+  const int alpha = matrices.input_tile;
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+  assert(filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3);
+
+  transformed.resize(alpha * alpha * output_depth * input_depth);
+  std::vector<float> temp(alpha * 3 * input_depth);
+  for (int o = 0; o < output_depth; ++o)
+  {
+    const float *filter = filter_data + o * 3 * 3 * input_depth;
+    WinogradTransformRows(matrices.g, alpha, 3, 3, input_depth, filter, 3 * input_depth,
+                          input_depth, temp.data(), 3 * input_depth, input_depth);
+    WinogradTransformCols(matrices.g, alpha, alpha, 3, input_depth, temp.data(), 3 * input_depth,
+                          input_depth, transformed.data() + o * input_depth,
+                          alpha * output_depth * input_depth, output_depth * input_depth);
+  }
+}
+
+/**
+ * @brief Convolution of a 3x3 filter with stride 1 by Winograd F(m x m, 3 x 3)
+ *
+ * Output tiles are processed in blocks, which are split across threads. For a block of tiles,
+ * transformed inputs of each position of a tile make a matrix of tiles x input_depth, which is
+ * multiplied by the transformed filter of the position. Then results are transformed back to
+ * output tiles with bias and activation.
+ *
+ * @param transformed_filter Filter transformed by WinogradTransformFilter with the same tile
+ */
+inline void WinogradConv(const Eigen::ThreadPoolDevice &device, const ConvParams &params,
+                         int output_tile, const Shape &input_shape, const float *input_data,
+                         const float *transformed_filter, const Shape &bias_shape,
+                         const float *bias_data, const Shape &output_shape, float *output_data)
+{
+  const auto &matrices = GetWinogradTransformMatrices(output_tile);
+  const int alpha = matrices.input_tile;
+  const int positions = alpha * alpha;
+
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  UNUSED_RELEASE(bias_shape);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  const int tiles_h = (output_height + output_tile - 1) / output_tile;
+  const int tiles_w = (output_width + output_tile - 1) / output_tile;
+  const int num_tiles = batches * tiles_h * tiles_w;
+
+  // Keep transformed inputs and products of a block around 4MB
+  const int block_size =
+      std::max(8, std::min(64, (1 << 20) / (positions * (input_depth + output_depth))));
+  const int num_blocks = (num_tiles + block_size - 1) / block_size;
+
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ColMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+  auto compute_blocks = [&](Eigen::Index first, Eigen::Index last) {
+    std::vector<float> patch(positions * input_depth);
+    std::vector<float> temp(alpha * std::max(input_depth, output_depth) * alpha);
+    std::vector<float> transformed_input(positions * block_size * input_depth);
+    std::vector<float> product(positions * block_size * output_depth);
+    std::vector<float> tile(output_tile * output_tile * output_depth);
+
+    for (Eigen::Index block = first; block < last; ++block)
+    {
+      const int tile_begin = block * block_size;
+      const int tile_count = std::min(block_size, num_tiles - tile_begin);
+      const int input_stride = tile_count * input_depth;
+      const int product_stride = tile_count * output_depth;
+
+      // B^T d B of each input tile
+      for (int t = 0; t < tile_count; ++t)
+      {
+        const int index = tile_begin + t;
+        const int batch = index / (tiles_h * tiles_w);
+        const int in_y_origin = (index / tiles_w % tiles_h) * output_tile - pad_height;
+        const int in_x_origin = (index % tiles_w) * output_tile - pad_width;
+
+        const float *d = nullptr;
+        int d_row_stride = 0;
+        if (in_y_origin >= 0 && in_x_origin >= 0 && in_y_origin + alpha <= input_height &&
+            in_x_origin + alpha <= input_width)
+        {
+          d = input_data + Offset(input_shape, batch, in_y_origin, in_x_origin, 0);
+          d_row_stride = input_width * input_depth;
+        }
+        else
+        {
+          std::fill(patch.begin(), patch.end(), 0.f);
+          for (int y = std::max(0, -in_y_origin);
+               y < std::min(alpha, input_height - in_y_origin); ++y)
+          {
+            const int x_begin = std::max(0, -in_x_origin);
+            const int x_end = std::min(alpha, input_width - in_x_origin);
+            if (x_begin < x_end)
+            {
+              memcpy(patch.data() + (y * alpha + x_begin) * input_depth,
+                     input_data +
+                         Offset(input_shape, batch, in_y_origin + y, in_x_origin + x_begin, 0),
+                     (x_end - x_begin) * input_depth * sizeof(float));
+            }
+          }
+          d = patch.data();
+          d_row_stride = alpha * input_depth;
+        }
+
+        WinogradTransformRows(matrices.bt, alpha, alpha, alpha, input_depth, d, d_row_stride,
+                              input_depth, temp.data(), alpha * input_depth, input_depth);
+        WinogradTransformCols(matrices.bt, alpha, alpha, alpha, input_depth, temp.data(),
+                              alpha * input_depth, input_depth,
+                              transformed_input.data() + t * input_depth, alpha * input_stride,
+                              input_stride);
+      }
+
+      // Multiply transformed inputs and filter of each position
+      for (int p = 0; p < positions; ++p)
+      {
+        Eigen::Map<const RowMajorMatrix> lhs(transformed_input.data() + p * input_stride,
+                                             tile_count, input_depth);
+        Eigen::Map<const ColMajorMatrix> rhs(transformed_filter +
+                                                 p * output_depth * input_depth,
+                                             input_depth, output_depth);
+        Eigen::Map<RowMajorMatrix> dst(product.data() + p * product_stride, tile_count,
+                                       output_depth);
+        dst.noalias() = lhs * rhs;
+      }
+
+      // A^T m A of each output tile
+      for (int t = 0; t < tile_count; ++t)
+      {
+        const int index = tile_begin + t;
+        const int batch = index / (tiles_h * tiles_w);
+        const int out_y_origin = (index / tiles_w % tiles_h) * output_tile;
+        const int out_x_origin = (index % tiles_w) * output_tile;
+
+        WinogradTransformRows(matrices.at, output_tile, alpha, alpha, output_depth,
+                              product.data() + t * output_depth, alpha * product_stride,
+                              product_stride, temp.data(), alpha * output_depth, output_depth);
+        WinogradTransformCols(matrices.at, output_tile, output_tile, alpha, output_depth,
+                              temp.data(), alpha * output_depth, output_depth, tile.data(),
+                              output_tile * output_depth, output_depth);
+
+        const int y_end = std::min(output_tile, output_height - out_y_origin);
+        const int x_end = std::min(output_tile, output_width - out_x_origin);
+        for (int y = 0; y < y_end; ++y)
+        {
+          for (int x = 0; x < x_end; ++x)
+          {
+            const float *src = tile.data() + (y * output_tile + x) * output_depth;
+            float *dst = output_data +
+                         Offset(output_shape, batch, out_y_origin + y, out_x_origin + x, 0);
+            for (int c = 0; c < output_depth; ++c)
+            {
+              const float value = bias_data ? src[c] + bias_data[c] : src[c];
+              dst[c] = ActivationFunctionWithMinMax(value, output_activation_min,
+                                                    output_activation_max);
+            }
+          }
+        }
+      }
+    }
+  };
+
+  const double block_cost =
+      2.0 * positions * block_size * input_depth * output_depth +
+      (2.0 * alpha * alpha * alpha) * block_size * (input_depth + output_depth);
+  device.parallelFor(num_blocks,
+                     Eigen::TensorOpCost(positions * block_size * input_depth * sizeof(float),
+                                         block_size * output_tile * output_tile * output_depth *
+                                             sizeof(float),
+                                         block_cost),
+                     compute_blocks);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
@@ -22,6 +22,7 @@
 #include <ruy/matrix.h>
 #include <ruy/ruy.h>
 #include <cassert>
+#include <vector>
 #include "cker/Types.h"
 
 namespace nnfw
@@ -81,6 +82,66 @@ void MakeRuyMulParams(const GemmParamsType &params, RuySpecType *ruy_mul_params)
   ruy_mul_params->set_clamp_max(params.clamp_max);
 }
 
+/**
+ * @brief Compute dst = lhs * rhs with ruy, applying bias and clamping of @c params
+ * @note  @c lhs and @c rhs are cached by ruy according to their cache policies. Cached data is
+ *        looked up by address, so contents of a cached matrix must not change.
+ */
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar,
+          QuantizationFlavor quantization_flavor>
+void Gemm(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+          const MatrixParams<RhsScalar> &rhs_params, const RhsScalar *rhs_data,
+          const MatrixParams<DstScalar> &dst_params, DstScalar *dst_data,
+          const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params,
+          ruy::Context *ruy_context)
+{
+  assert(lhs_params.cols == rhs_params.rows);
+  assert(lhs_params.rows == dst_params.rows);
+  assert(rhs_params.cols == dst_params.cols);
+
+  ruy::Matrix<LhsScalar> ruy_lhs;
+  ruy::Matrix<RhsScalar> ruy_rhs;
+  ruy::Matrix<DstScalar> ruy_dst;
+  MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs, true);
+  MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs, true);
+  MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+  ruy::BasicSpec<AccumScalar, DstScalar> ruy_mul_params;
+  MakeRuyMulParams(params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+/**
+ * @brief Pack constant lhs into the cache of @c ruy_context ahead of the first Gemm()
+ * @note  Gemm() with lhs of the same address and CachePolicy::kAlwaysCache uses the packed lhs
+ *        instead of packing it again, so lhs must stay alive and unchanged from then on.
+ *        Only shapes, orders and zero points of @c rhs_params and @c dst_params are used.
+ */
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar,
+          QuantizationFlavor quantization_flavor>
+void PrepackLhs(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+                const MatrixParams<RhsScalar> &rhs_params,
+                const MatrixParams<DstScalar> &dst_params,
+                const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params,
+                ruy::Context *ruy_context)
+{
+  MatrixParams<LhsScalar> cached_lhs_params = lhs_params;
+  cached_lhs_params.cache_policy = CachePolicy::kAlwaysCache;
+
+  // Packing of lhs does not depend on the width of rhs, so a column of zero points is enough
+  MatrixParams<RhsScalar> column_params = rhs_params;
+  column_params.cols = 1;
+  column_params.cache_policy = CachePolicy::kNeverCache;
+  MatrixParams<DstScalar> dst_column_params = dst_params;
+  dst_column_params.cols = 1;
+
+  std::vector<RhsScalar> column(column_params.rows, column_params.zero_point);
+  std::vector<DstScalar> dst_column(dst_column_params.rows);
+  Gemm(cached_lhs_params, lhs_data, column_params, column.data(), dst_column_params,
+       dst_column.data(), params, ruy_context);
+}
+
 } // namespace ruy_support
 } // namespace cker
 } // namespace nnfw
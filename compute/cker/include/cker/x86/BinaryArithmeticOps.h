@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
+#define __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
+
+#include "cker/x86/x86_check.h"
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+
+enum class X86BinaryOp
+{
+  kAdd,
+  kSub,
+  kMul,
+};
+
+template <X86BinaryOp kOp> CKER_X86_TARGET_AVX2 inline __m256 Avx2BinaryOp(__m256 a, __m256 b)
+{
+  switch (kOp)
+  {
+    case X86BinaryOp::kAdd:
+      return _mm256_add_ps(a, b);
+    case X86BinaryOp::kSub:
+      return _mm256_sub_ps(a, b);
+    case X86BinaryOp::kMul:
+    default:
+      return _mm256_mul_ps(a, b);
+  }
+}
+
+template <X86BinaryOp kOp> inline __m128 Sse41BinaryOp(__m128 a, __m128 b)
+{
+  switch (kOp)
+  {
+    case X86BinaryOp::kAdd:
+      return _mm_add_ps(a, b);
+    case X86BinaryOp::kSub:
+      return _mm_sub_ps(a, b);
+    case X86BinaryOp::kMul:
+    default:
+      return _mm_mul_ps(a, b);
+  }
+}
+
+// output[i] = clamp(input1[i] op input2[i]), which returns the number of elements computed
+template <X86BinaryOp kOp>
+CKER_X86_TARGET_AVX2 inline int Avx2BinaryElementwise(int size, const float *input1_data,
+                                                      const float *input2_data, float *output_data,
+                                                      float activation_min, float activation_max)
+{
+  int i = 0;
+  const __m256 min_vec = _mm256_set1_ps(activation_min);
+  const __m256 max_vec = _mm256_set1_ps(activation_max);
+  for (; i <= size - 16; i += 16)
+  {
+    __m256 x0 = Avx2BinaryOp<kOp>(_mm256_loadu_ps(input1_data + i),
+                                  _mm256_loadu_ps(input2_data + i));
+    __m256 x1 = Avx2BinaryOp<kOp>(_mm256_loadu_ps(input1_data + i + 8),
+                                  _mm256_loadu_ps(input2_data + i + 8));
+    x0 = _mm256_min_ps(max_vec, _mm256_max_ps(min_vec, x0));
+    x1 = _mm256_min_ps(max_vec, _mm256_max_ps(min_vec, x1));
+    _mm256_storeu_ps(output_data + i, x0);
+    _mm256_storeu_ps(output_data + i + 8, x1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    __m256 x = Avx2BinaryOp<kOp>(_mm256_loadu_ps(input1_data + i),
+                                 _mm256_loadu_ps(input2_data + i));
+    _mm256_storeu_ps(output_data + i, _mm256_min_ps(max_vec, _mm256_max_ps(min_vec, x)));
+  }
+  return i;
+}
+
+template <X86BinaryOp kOp>
+inline int Sse41BinaryElementwise(int size, const float *input1_data, const float *input2_data,
+                                  float *output_data, float activation_min, float activation_max)
+{
+  int i = 0;
+  const __m128 min_vec = _mm_set1_ps(activation_min);
+  const __m128 max_vec = _mm_set1_ps(activation_max);
+  for (; i <= size - 4; i += 4)
+  {
+    __m128 x = Sse41BinaryOp<kOp>(_mm_loadu_ps(input1_data + i), _mm_loadu_ps(input2_data + i));
+    _mm_storeu_ps(output_data + i, _mm_min_ps(max_vec, _mm_max_ps(min_vec, x)));
+  }
+  return i;
+}
+
+template <X86BinaryOp kOp>
+inline int X86BinaryElementwise(int size, const float *input1_data, const float *input2_data,
+                                float *output_data, float activation_min, float activation_max)
+{
+  if (GetX86CpuFeatures().avx2)
+    return Avx2BinaryElementwise<kOp>(size, input1_data, input2_data, output_data,
+                                      activation_min, activation_max);
+  return Sse41BinaryElementwise<kOp>(size, input1_data, input2_data, output_data,
+                                     activation_min, activation_max);
+}
+
+// output[i] = clamp(broadcast_value op input2[i]), which returns the number of elements computed
+template <X86BinaryOp kOp>
+CKER_X86_TARGET_AVX2 inline int Avx2BinaryScalarBroadcast(int size, float broadcast_value,
+                                                          const float *input2_data,
+                                                          float *output_data, float activation_min,
+                                                          float activation_max)
+{
+  int i = 0;
+  const __m256 min_vec = _mm256_set1_ps(activation_min);
+  const __m256 max_vec = _mm256_set1_ps(activation_max);
+  const __m256 broadcast_vec = _mm256_set1_ps(broadcast_value);
+  for (; i <= size - 8; i += 8)
+  {
+    __m256 x = Avx2BinaryOp<kOp>(broadcast_vec, _mm256_loadu_ps(input2_data + i));
+    _mm256_storeu_ps(output_data + i, _mm256_min_ps(max_vec, _mm256_max_ps(min_vec, x)));
+  }
+  return i;
+}
+
+template <X86BinaryOp kOp>
+inline int Sse41BinaryScalarBroadcast(int size, float broadcast_value, const float *input2_data,
+                                      float *output_data, float activation_min,
+                                      float activation_max)
+{
+  int i = 0;
+  const __m128 min_vec = _mm_set1_ps(activation_min);
+  const __m128 max_vec = _mm_set1_ps(activation_max);
+  const __m128 broadcast_vec = _mm_set1_ps(broadcast_value);
+  for (; i <= size - 4; i += 4)
+  {
+    __m128 x = Sse41BinaryOp<kOp>(broadcast_vec, _mm_loadu_ps(input2_data + i));
+    _mm_storeu_ps(output_data + i, _mm_min_ps(max_vec, _mm_max_ps(min_vec, x)));
+  }
+  return i;
+}
+
+template <X86BinaryOp kOp>
+inline int X86BinaryScalarBroadcast(int size, float broadcast_value, const float *input2_data,
+                                    float *output_data, float activation_min, float activation_max)
+{
+  if (GetX86CpuFeatures().avx2)
+    return Avx2BinaryScalarBroadcast<kOp>(size, broadcast_value, input2_data, output_data,
+                                          activation_min, activation_max);
+  return Sse41BinaryScalarBroadcast<kOp>(size, broadcast_value, input2_data, output_data,
+                                         activation_min, activation_max);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_DEPTHWISE_CONV_UINT8_H__
+#define __NNFW_CKER_X86_DEPTHWISE_CONV_UINT8_H__
+
+#include "cker/x86/x86_check.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+
+// acc[c] += (filter[c] + filter_offset) * (input[c] + input_offset) for each output pixel, of
+// which input pointer advances by input_ptr_increment
+CKER_X86_TARGET_AVX2 inline void
+Avx2QuantizedDepthwiseConvKernelDepthMultiplier1(int num_output_pixels, int input_depth,
+                                                 const uint8_t *input_ptr, int16_t input_offset,
+                                                 int input_ptr_increment, const uint8_t *filter_ptr,
+                                                 int16_t filter_offset, int32_t *acc_buffer_ptr)
+{
+  const __m256i input_offset_vec = _mm256_set1_epi32(input_offset);
+  const __m256i filter_offset_vec = _mm256_set1_epi32(filter_offset);
+  for (int outp = 0; outp < num_output_pixels; ++outp)
+  {
+    int c = 0;
+    for (; c <= input_depth - 8; c += 8)
+    {
+      const __m256i input = _mm256_add_epi32(
+          _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input_ptr + c))),
+          input_offset_vec);
+      const __m256i filter = _mm256_add_epi32(
+          _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(filter_ptr + c))),
+          filter_offset_vec);
+      __m256i *acc_ptr = reinterpret_cast<__m256i *>(acc_buffer_ptr + c);
+      _mm256_storeu_si256(acc_ptr, _mm256_add_epi32(_mm256_loadu_si256(acc_ptr),
+                                                    _mm256_mullo_epi32(input, filter)));
+    }
+    for (; c < input_depth; ++c)
+    {
+      acc_buffer_ptr[c] += static_cast<int32_t>(filter_ptr[c] + filter_offset) *
+                           static_cast<int32_t>(input_ptr[c] + input_offset);
+    }
+    input_ptr += input_ptr_increment;
+    acc_buffer_ptr += input_depth;
+  }
+}
+
+inline void Sse41QuantizedDepthwiseConvKernelDepthMultiplier1(
+    int num_output_pixels, int input_depth, const uint8_t *input_ptr, int16_t input_offset,
+    int input_ptr_increment, const uint8_t *filter_ptr, int16_t filter_offset,
+    int32_t *acc_buffer_ptr)
+{
+  const __m128i input_offset_vec = _mm_set1_epi32(input_offset);
+  const __m128i filter_offset_vec = _mm_set1_epi32(filter_offset);
+  for (int outp = 0; outp < num_output_pixels; ++outp)
+  {
+    int c = 0;
+    for (; c <= input_depth - 4; c += 4)
+    {
+      int32_t input_bytes, filter_bytes;
+      memcpy(&input_bytes, input_ptr + c, sizeof(int32_t));
+      memcpy(&filter_bytes, filter_ptr + c, sizeof(int32_t));
+      const __m128i input =
+          _mm_add_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(input_bytes)), input_offset_vec);
+      const __m128i filter =
+          _mm_add_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(filter_bytes)), filter_offset_vec);
+      __m128i *acc_ptr = reinterpret_cast<__m128i *>(acc_buffer_ptr + c);
+      _mm_storeu_si128(acc_ptr,
+                       _mm_add_epi32(_mm_loadu_si128(acc_ptr), _mm_mullo_epi32(input, filter)));
+    }
+    for (; c < input_depth; ++c)
+    {
+      acc_buffer_ptr[c] += static_cast<int32_t>(filter_ptr[c] + filter_offset) *
+                           static_cast<int32_t>(input_ptr[c] + input_offset);
+    }
+    input_ptr += input_ptr_increment;
+    acc_buffer_ptr += input_depth;
+  }
+}
+
+// Accumulates the effect of one row of the filter of depth multiplier 1, which has the same
+// signature as QuantizedDepthwiseConvAccumRowGeneric
+inline void X86QuantizedDepthwiseConvAccumRowDepthMultiplier1(
+    int stride, int dilation_factor, int input_depth, int input_width, const uint8_t *input_data,
+    int16_t input_offset, int pad_width, int depth_multiplier, int filter_width,
+    const uint8_t *filter_data, int16_t filter_offset, int out_x_buffer_start,
+    int out_x_buffer_end, int output_depth, int32_t *acc_buffer)
+{
+  assert(depth_multiplier == 1);
+  assert(output_depth == input_depth);
+  (void)depth_multiplier;
+  auto kernel = GetX86CpuFeatures().avx2 ? Avx2QuantizedDepthwiseConvKernelDepthMultiplier1
+                                         : Sse41QuantizedDepthwiseConvKernelDepthMultiplier1;
+  const uint8_t *filter_base_ptr = filter_data;
+  for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+  {
+    const int out_x_loop_start = std::max(
+        out_x_buffer_start, (pad_width - dilation_factor * filter_x + stride - 1) / stride);
+    const int out_x_loop_end =
+        std::min(out_x_buffer_end,
+                 (pad_width + input_width - dilation_factor * filter_x + stride - 1) / stride);
+    if (out_x_loop_start < out_x_loop_end)
+    {
+      int32_t *acc_buffer_ptr =
+          acc_buffer + (out_x_loop_start - out_x_buffer_start) * output_depth;
+      const int in_x_origin =
+          (out_x_loop_start * stride) - pad_width + dilation_factor * filter_x;
+      kernel(out_x_loop_end - out_x_loop_start, input_depth,
+             input_data + in_x_origin * input_depth, input_offset, stride * input_depth,
+             filter_base_ptr, filter_offset, acc_buffer_ptr);
+    }
+    filter_base_ptr += output_depth;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_DEPTHWISE_CONV_UINT8_H__
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_CHECK_H__
+#define __NNFW_CKER_X86_CHECK_H__
+
+// SSE4.1 is the baseline of x86 builds, and wider instruction sets are selected at runtime by
+// CPUID so that a single build runs on any x86 machine.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE4_1__) && defined(__GNUC__)
+#define USE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#ifdef USE_X86_SIMD
+
+// Functions with these attributes may use the instruction sets only after checking
+// X86CpuFeatures
+#define CKER_X86_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define CKER_X86_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx2,fma")))
+
+namespace nnfw
+{
+namespace cker
+{
+
+struct X86CpuFeatures
+{
+  bool avx2;   // with FMA
+  bool avx512; // AVX-512 F and BW
+};
+
+inline const X86CpuFeatures &GetX86CpuFeatures()
+{
+  static const X86CpuFeatures features = [] {
+    __builtin_cpu_init();
+    X86CpuFeatures detected;
+    detected.avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    detected.avx512 = detected.avx2 && __builtin_cpu_supports("avx512f") &&
+                      __builtin_cpu_supports("avx512bw");
+    return detected;
+  }();
+  return features;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+// X86_OR_PORTABLE(SomeFunc, args) calls X86SomeFunc(args) if USE_X86_SIMD is defined,
+// PortableSomeFunc(args) otherwise.
+#define X86_OR_PORTABLE(funcname, ...) X86##funcname(__VA_ARGS__)
+
+#else
+#define X86_OR_PORTABLE(funcname, ...) Portable##funcname(__VA_ARGS__)
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_CHECK_H__
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQFullyConnected.h>
+#include <cker/operation/Helper/BCQ.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+// Clusters of (qbits, rows), which are 2 rows of 2 bits and a row of 1 bit
+const std::vector<int32_t> clusters{2, 2, 1, 1};
+const int hidden_size = 40;
+const std::vector<float> scales{1.f, 2.f, 4.f, 8.f, 16.f};
+
+// Planes are ordered by bit and then by row in a cluster, and 40 bits take 2 words from the LSB
+std::vector<int32_t> binary()
+{
+  return {
+      0x00000001, 0x00000080,                       // bit 0 of row 0: h = 0 and h = 39 are set
+      0x00000000, 0x00000000,                       // bit 0 of row 1
+      0x00000000, 0x00000000,                       // bit 1 of row 0
+      static_cast<int32_t>(0x80000000), 0x00000000, // bit 1 of row 1: h = 31 is set
+      0x00000000, 0x00000001,                       // bit 0 of row 2: h = 32 is set
+  };
+}
+
+} // namespace
+
+TEST(CKer_Helper, BCQLayout)
+{
+  nnfw::cker::BCQLayout layout;
+  layout.prepare(clusters.data(), 2, hidden_size);
+
+  EXPECT_EQ(layout.rows(), 3);
+  EXPECT_EQ(layout.num_planes(), 5);
+  EXPECT_EQ(layout.words_per_plane(), 2);
+  EXPECT_EQ(layout.qbits(0), 2);
+  EXPECT_EQ(layout.first_plane(0), 0);
+  EXPECT_EQ(layout.plane_stride(0), 2);
+  EXPECT_EQ(layout.first_plane(1), 1);
+  EXPECT_EQ(layout.plane_stride(1), 2);
+  EXPECT_EQ(layout.qbits(2), 1);
+  EXPECT_EQ(layout.first_plane(2), 4);
+  EXPECT_EQ(layout.plane_stride(2), 1);
+}
+
+TEST(CKer_Helper, BCQValue)
+{
+  using nnfw::cker::BCQValue;
+
+  nnfw::cker::BCQLayout layout;
+  layout.prepare(clusters.data(), 2, hidden_size);
+  const auto bits = binary();
+
+  // A set bit is +scale and a clear bit is -scale
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 0, 0), 1.f - 4.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 0, 1), -1.f - 4.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 0, 39), 1.f - 4.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 1, 0), -2.f - 8.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 1, 31), -2.f + 8.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 2, 31), -16.f);
+  EXPECT_FLOAT_EQ(BCQValue(layout, scales.data(), bits.data(), 2, 32), 16.f);
+}
+
+TEST(CKer_Helper, BCQAccumulatePlane)
+{
+  const auto bits = binary();
+  std::vector<float> output(hidden_size, 0.f);
+  nnfw::cker::BCQAccumulatePlane(bits.data(), 0.5f, hidden_size, output.data());
+
+  for (int h = 0; h < hidden_size; ++h)
+    EXPECT_FLOAT_EQ(output[h], (h == 0 || h == 39) ? 0.5f : -0.5f) << "h " << h;
+}
+
+TEST(CKer_Operation, BCQFullyConnected)
+{
+  using namespace nnfw::cker;
+
+  const int batches = 2;
+  const auto bits = binary();
+  BCQFullyConnected kernel;
+  kernel.prepare(clusters.data(), 2, hidden_size);
+  const BCQLayout &layout = kernel.layout();
+
+  // Input is [hidden_size, batches]
+  std::vector<float> input(hidden_size * batches);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 0.01f * static_cast<float>(i % 17) - 0.05f;
+  const std::vector<float> bias{0.5f, -0.5f, 1.f};
+
+  std::vector<float> expected(layout.rows() * batches);
+  for (int row = 0; row < layout.rows(); ++row)
+  {
+    for (int b = 0; b < batches; ++b)
+    {
+      float acc = bias[row];
+      for (int h = 0; h < hidden_size; ++h)
+        acc += BCQValue(layout, scales.data(), bits.data(), row, h) * input[h * batches + b];
+      expected[row * batches + b] = acc;
+    }
+  }
+
+  FullyConnectedParams params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  std::vector<float> output(expected.size());
+  kernel(params, scales.data(), bits.data(), Shape{hidden_size, batches}, input.data(),
+         bias.data(), Shape{layout.rows(), batches}, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f) << "index " << i;
+}
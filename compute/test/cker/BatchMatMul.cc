@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> randomData(int size, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> data(size);
+  for (auto &v : data)
+    v = dist(gen);
+  return data;
+}
+
+// Batch dimensions of both operands have the same rank, and a dimension of 1 is broadcast
+std::vector<float> referenceBatchMatMul(const std::vector<int> &lhs_batch_dims,
+                                        const std::vector<float> &lhs,
+                                        const std::vector<int> &rhs_batch_dims,
+                                        const std::vector<float> &rhs, int rows, int depth,
+                                        int cols, bool adj_x, bool adj_y)
+{
+  const int rank = lhs_batch_dims.size();
+  int output_batch_size = 1;
+  for (int i = 0; i < rank; ++i)
+    output_batch_size *= std::max(lhs_batch_dims[i], rhs_batch_dims[i]);
+
+  std::vector<float> output(output_batch_size * rows * cols);
+  for (int b = 0; b < output_batch_size; ++b)
+  {
+    int lhs_batch = 0;
+    int rhs_batch = 0;
+    int remaining = b;
+    int stride = output_batch_size;
+    for (int i = 0; i < rank; ++i)
+    {
+      stride /= std::max(lhs_batch_dims[i], rhs_batch_dims[i]);
+      const int index = remaining / stride;
+      remaining %= stride;
+      lhs_batch = lhs_batch * lhs_batch_dims[i] + (lhs_batch_dims[i] == 1 ? 0 : index);
+      rhs_batch = rhs_batch * rhs_batch_dims[i] + (rhs_batch_dims[i] == 1 ? 0 : index);
+    }
+
+    const float *x = lhs.data() + lhs_batch * rows * depth;
+    const float *y = rhs.data() + rhs_batch * depth * cols;
+    for (int r = 0; r < rows; ++r)
+    {
+      for (int c = 0; c < cols; ++c)
+      {
+        float sum = 0.f;
+        for (int d = 0; d < depth; ++d)
+        {
+          const float xv = adj_x ? x[d * rows + r] : x[r * depth + d];
+          const float yv = adj_y ? y[c * depth + d] : y[d * cols + c];
+          sum += xv * yv;
+        }
+        output[(b * rows + r) * cols + c] = sum;
+      }
+    }
+  }
+  return output;
+}
+
+Shape matrixShape(const std::vector<int> &batch_dims, int dim0, int dim1)
+{
+  std::vector<int32_t> dims(batch_dims.begin(), batch_dims.end());
+  dims.push_back(dim0);
+  dims.push_back(dim1);
+  return Shape(dims.size(), dims.data());
+}
+
+void verifyBatchMatMul(const std::vector<int> &lhs_batch_dims,
+                       const std::vector<int> &rhs_batch_dims, int rows, int depth, int cols,
+                       bool adj_x, bool adj_y, bool prepack_rhs)
+{
+  const Shape lhs_shape = adj_x ? matrixShape(lhs_batch_dims, depth, rows)
+                                : matrixShape(lhs_batch_dims, rows, depth);
+  const Shape rhs_shape = adj_y ? matrixShape(rhs_batch_dims, cols, depth)
+                                : matrixShape(rhs_batch_dims, depth, cols);
+  std::vector<int> output_batch_dims;
+  for (size_t i = 0; i < lhs_batch_dims.size(); ++i)
+    output_batch_dims.push_back(std::max(lhs_batch_dims[i], rhs_batch_dims[i]));
+  const Shape output_shape = matrixShape(output_batch_dims, rows, cols);
+
+  const auto lhs = randomData(lhs_shape.FlatSize(), 3);
+  const auto rhs = randomData(rhs_shape.FlatSize(), 5);
+  const auto expected = referenceBatchMatMul(lhs_batch_dims, lhs, rhs_batch_dims, rhs, rows,
+                                             depth, cols, adj_x, adj_y);
+
+  ruy::Context ruy_context;
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(lhs_shape, rhs_shape);
+  if (prepack_rhs)
+    kernel.prepackRhs(rhs_shape, rhs.data(), adj_y, &ruy_context);
+
+  std::vector<float> output(output_shape.FlatSize());
+  // The second run uses packing of rhs cached by the first run or by prepackRhs()
+  for (int run = 0; run < 2; ++run)
+  {
+    kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+           output.data(), &ruy_context);
+    ASSERT_EQ(output.size(), expected.size());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-4f) << "run " << run << ", index " << i;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, BatchMatMulAdjoint)
+{
+  for (bool adj_x : {false, true})
+  {
+    for (bool adj_y : {false, true})
+    {
+      SCOPED_TRACE(testing::Message() << "adj_x " << adj_x << ", adj_y " << adj_y);
+      verifyBatchMatMul({2}, {2}, 3, 5, 4, adj_x, adj_y, /*prepack_rhs=*/false);
+      verifyBatchMatMul({2}, {2}, 3, 5, 4, adj_x, adj_y, /*prepack_rhs=*/true);
+    }
+  }
+}
+
+TEST(CKer_Operation, BatchMatMulBroadcast)
+{
+  for (bool adj_x : {false, true})
+  {
+    for (bool adj_y : {false, true})
+    {
+      SCOPED_TRACE(testing::Message() << "adj_x " << adj_x << ", adj_y " << adj_y);
+      // Both operands are broadcast along different batch dimensions
+      verifyBatchMatMul({2, 1}, {1, 3}, 4, 6, 5, adj_x, adj_y, /*prepack_rhs=*/false);
+      verifyBatchMatMul({2, 1}, {1, 3}, 4, 6, 5, adj_x, adj_y, /*prepack_rhs=*/true);
+      // lhs is broadcast
+      verifyBatchMatMul({1, 1}, {2, 3}, 2, 3, 7, adj_x, adj_y, /*prepack_rhs=*/true);
+    }
+  }
+}
+
+TEST(CKer_Operation, BatchMatMulStacked)
+{
+  // Batches of lhs against a single rhs are stacked into a single GEMM unless adj_x is set
+  for (bool adj_x : {false, true})
+  {
+    for (bool adj_y : {false, true})
+    {
+      SCOPED_TRACE(testing::Message() << "adj_x " << adj_x << ", adj_y " << adj_y);
+      verifyBatchMatMul({3, 2}, {1, 1}, 4, 6, 5, adj_x, adj_y, /*prepack_rhs=*/false);
+      verifyBatchMatMul({3, 2}, {1, 1}, 4, 6, 5, adj_x, adj_y, /*prepack_rhs=*/true);
+      verifyBatchMatMul({1}, {1}, 1, 9, 3, adj_x, adj_y, /*prepack_rhs=*/true);
+    }
+  }
+}
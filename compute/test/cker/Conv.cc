@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+struct ConvInt8Case
+{
+  Shape input_shape;
+  Shape filter_shape;
+  Shape output_shape;
+  int stride;
+  int padding;
+};
+
+// Requantizes exact accumulators in double, so the kernel may differ by one for rounding
+std::vector<int8_t> referenceConvPerChannel(const ConvInt8Case &c, const std::vector<int8_t> &input,
+                                            int32_t input_zero_point, float input_scale,
+                                            const std::vector<int8_t> &filter,
+                                            const std::vector<float> &filter_scales,
+                                            const std::vector<int32_t> &bias, float output_scale,
+                                            int32_t output_zero_point)
+{
+  const int in_h = c.input_shape.Dims(1), in_w = c.input_shape.Dims(2);
+  const int in_d = c.input_shape.Dims(3);
+  const int f_h = c.filter_shape.Dims(1), f_w = c.filter_shape.Dims(2);
+  const int out_h = c.output_shape.Dims(1), out_w = c.output_shape.Dims(2);
+  const int out_d = c.output_shape.Dims(3);
+
+  std::vector<int8_t> output(c.output_shape.FlatSize());
+  for (int b = 0; b < c.output_shape.Dims(0); ++b)
+    for (int oy = 0; oy < out_h; ++oy)
+      for (int ox = 0; ox < out_w; ++ox)
+        for (int oc = 0; oc < out_d; ++oc)
+        {
+          int32_t acc = bias[oc];
+          for (int fy = 0; fy < f_h; ++fy)
+            for (int fx = 0; fx < f_w; ++fx)
+            {
+              const int iy = oy * c.stride - c.padding + fy;
+              const int ix = ox * c.stride - c.padding + fx;
+              if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                continue;
+              for (int ic = 0; ic < in_d; ++ic)
+              {
+                const int32_t in = input[Offset(c.input_shape, b, iy, ix, ic)] - input_zero_point;
+                acc += in * filter[Offset(c.filter_shape, oc, fy, fx, ic)];
+              }
+            }
+          const double real = acc * static_cast<double>(input_scale) * filter_scales[oc];
+          const double q = std::round(real / output_scale) + output_zero_point;
+          output[Offset(c.output_shape, b, oy, ox, oc)] =
+              static_cast<int8_t>(std::min(127.0, std::max(-128.0, q)));
+        }
+  return output;
+}
+
+void runConvPerChannel(const ConvInt8Case &c)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  std::uniform_int_distribution<int> bias_dist(-500, 500);
+
+  std::vector<int8_t> input(c.input_shape.FlatSize());
+  std::vector<int8_t> filter(c.filter_shape.FlatSize());
+  std::vector<int32_t> bias(c.output_shape.Dims(3));
+  for (auto &v : input)
+    v = static_cast<int8_t>(int8_dist(gen));
+  for (auto &v : filter)
+    v = static_cast<int8_t>(int8_dist(gen));
+  for (auto &v : bias)
+    v = bias_dist(gen);
+
+  const int32_t input_zero_point = 3;
+  const int32_t output_zero_point = -5;
+  const float input_scale = 0.05f;
+  const float output_scale = 0.8f;
+  // Scales far apart so that using a single scale for all channels cannot pass
+  std::vector<float> filter_scales(c.output_shape.Dims(3));
+  for (size_t i = 0; i < filter_scales.size(); ++i)
+    filter_scales[i] = 0.002f * (1 << (i % 5));
+
+  std::vector<int32_t> multipliers(filter_scales.size());
+  std::vector<int32_t> shifts(filter_scales.size());
+  for (size_t i = 0; i < filter_scales.size(); ++i)
+  {
+    int shift = 0;
+    QuantizeMultiplier(static_cast<double>(input_scale) * filter_scales[i] / output_scale,
+                       &multipliers[i], &shift);
+    shifts[i] = shift;
+  }
+
+  ConvParams params{};
+  params.padding_type = c.padding > 0 ? PaddingType::kSame : PaddingType::kValid;
+  params.padding_values.width = c.padding;
+  params.padding_values.height = c.padding;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.input_offset = -input_zero_point;
+  params.output_offset = output_zero_point;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  ruy::Context ruy_context;
+  Conv kernel;
+  std::vector<int8_t> output(c.output_shape.FlatSize());
+  kernel(params, multipliers.data(), shifts.data(), c.input_shape, input.data(), c.filter_shape,
+         filter.data(), Shape{c.output_shape.Dims(3)}, bias.data(), c.output_shape, output.data(),
+         &ruy_context);
+
+  const auto expected =
+      referenceConvPerChannel(c, input, input_zero_point, input_scale, filter, filter_scales, bias,
+                              output_scale, output_zero_point);
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1) << "at " << i;
+}
+
+struct ConvFloatCase
+{
+  Shape input_shape;
+  Shape filter_shape;
+  int padding;
+};
+
+Shape convFloatOutputShape(const ConvFloatCase &c)
+{
+  // 3x3 filter with stride 1
+  return Shape{c.input_shape.Dims(0), c.input_shape.Dims(1) + 2 * c.padding - 2,
+               c.input_shape.Dims(2) + 2 * c.padding - 2, c.filter_shape.Dims(0)};
+}
+
+std::vector<float> referenceConvFloat(const ConvFloatCase &c, const std::vector<float> &input,
+                                      const std::vector<float> &filter,
+                                      const std::vector<float> &bias, float activation_min,
+                                      float activation_max)
+{
+  const Shape output_shape = convFloatOutputShape(c);
+  const int in_h = c.input_shape.Dims(1), in_w = c.input_shape.Dims(2);
+  const int in_d = c.input_shape.Dims(3);
+
+  std::vector<float> output(output_shape.FlatSize());
+  for (int b = 0; b < output_shape.Dims(0); ++b)
+    for (int oy = 0; oy < output_shape.Dims(1); ++oy)
+      for (int ox = 0; ox < output_shape.Dims(2); ++ox)
+        for (int oc = 0; oc < output_shape.Dims(3); ++oc)
+        {
+          double acc = bias[oc];
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int iy = oy - c.padding + fy;
+              const int ix = ox - c.padding + fx;
+              if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                continue;
+              for (int ic = 0; ic < in_d; ++ic)
+                acc += static_cast<double>(input[Offset(c.input_shape, b, iy, ix, ic)]) *
+                       filter[Offset(c.filter_shape, oc, fy, fx, ic)];
+            }
+          output[Offset(output_shape, b, oy, ox, oc)] =
+              std::min(activation_max, std::max(activation_min, static_cast<float>(acc)));
+        }
+  return output;
+}
+
+std::vector<float> randomFloats(int size, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> data(size);
+  for (auto &v : data)
+    v = dist(gen);
+  return data;
+}
+
+ConvParams floatConvParams(int padding, float activation_min, float activation_max)
+{
+  ConvParams params;
+  params.padding_type = padding == 0 ? PaddingType::kValid : PaddingType::kSame;
+  params.padding_values.width = padding;
+  params.padding_values.height = padding;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = activation_min;
+  params.float_activation_max = activation_max;
+  return params;
+}
+
+// Runs Winograd of the given output tile directly
+void runWinogradConv(const ConvFloatCase &c, int output_tile,
+                     const Eigen::ThreadPoolDevice &device)
+{
+  const Shape output_shape = convFloatOutputShape(c);
+  const Shape bias_shape{c.filter_shape.Dims(0)};
+  const auto input = randomFloats(c.input_shape.FlatSize(), 1);
+  const auto filter = randomFloats(c.filter_shape.FlatSize(), 2);
+  const auto bias = randomFloats(bias_shape.FlatSize(), 3);
+  const float activation_min = -2.f;
+  const float activation_max = 2.f;
+  const auto expected =
+      referenceConvFloat(c, input, filter, bias, activation_min, activation_max);
+
+  ASSERT_TRUE(optimized::IsWinogradConvSupported(c.filter_shape, 1, 1, 1, 1));
+  std::vector<float> transformed;
+  optimized::WinogradTransformFilter(output_tile, c.filter_shape, filter.data(), transformed);
+
+  std::vector<float> output(output_shape.FlatSize());
+  optimized::WinogradConv(device, floatConvParams(c.padding, activation_min, activation_max),
+                          output_tile, c.input_shape, input.data(), transformed.data(),
+                          bias_shape, bias.data(), output_shape, output.data());
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ConvPerChannelInt8)
+{
+  // 3x3 filter with stride and padding, which goes through im2col
+  runConvPerChannel({Shape{1, 5, 5, 3}, Shape{6, 3, 3, 3}, Shape{1, 3, 3, 6}, 2, 1});
+  // 1x1 filter, which multiplies the input directly
+  runConvPerChannel({Shape{2, 4, 4, 8}, Shape{5, 1, 1, 8}, Shape{2, 4, 4, 5}, 1, 0});
+}
+
+TEST(CKer_Operation, WinogradConv)
+{
+  Eigen::ThreadPool thread_pool(3);
+  Eigen::ThreadPoolDevice device(&thread_pool, 3);
+  // Outputs that tiles cover exactly or partially, without padding and with same padding
+  const std::vector<ConvFloatCase> cases{
+      {Shape{1, 10, 10, 8}, Shape{8, 3, 3, 8}, 0},
+      {Shape{1, 7, 9, 8}, Shape{9, 3, 3, 8}, 1},
+      {Shape{2, 6, 5, 11}, Shape{8, 3, 3, 11}, 1},
+      {Shape{1, 5, 4, 16}, Shape{12, 3, 3, 16}, 0},
+      {Shape{1, 1, 3, 8}, Shape{8, 3, 3, 8}, 1},
+  };
+  for (int output_tile : {2, 4})
+  {
+    for (size_t i = 0; i < cases.size(); ++i)
+    {
+      SCOPED_TRACE(testing::Message() << "F(" << output_tile << "x" << output_tile
+                                      << ", 3x3), case " << i);
+      runWinogradConv(cases[i], output_tile, device);
+    }
+  }
+}
+
+TEST(CKer_Operation, ConvFloatWinograd)
+{
+  // Conv picks F(4x4, 3x3) for the first case and F(2x2, 3x3) for the second, whose output is
+  // smaller than 4x4
+  const std::vector<ConvFloatCase> cases{
+      {Shape{1, 9, 7, 8}, Shape{10, 3, 3, 8}, 1},
+      {Shape{1, 3, 5, 8}, Shape{8, 3, 3, 8}, 1},
+  };
+  for (size_t i = 0; i < cases.size(); ++i)
+  {
+    SCOPED_TRACE(testing::Message() << "case " << i);
+    const ConvFloatCase &c = cases[i];
+    const Shape output_shape = convFloatOutputShape(c);
+    const Shape bias_shape{c.filter_shape.Dims(0)};
+    const auto input = randomFloats(c.input_shape.FlatSize(), 4);
+    const auto filter = randomFloats(c.filter_shape.FlatSize(), 5);
+    const auto bias = randomFloats(bias_shape.FlatSize(), 6);
+    const float lowest = std::numeric_limits<float>::lowest();
+    const float highest = std::numeric_limits<float>::max();
+    const auto expected = referenceConvFloat(c, input, filter, bias, lowest, highest);
+    const ConvParams params = floatConvParams(c.padding, lowest, highest);
+
+    Conv kernel;
+    bool is_replaced_weights = false;
+    kernel.prepare(c.filter_shape, filter.data(), output_shape, params.padding_type, 1, 1, 1, 1,
+                   is_replaced_weights);
+    EXPECT_TRUE(is_replaced_weights);
+
+    std::vector<float> output(output_shape.FlatSize());
+    kernel(params, c.input_shape, input.data(), c.filter_shape, filter.data(), bias_shape,
+           bias.data(), output_shape, output.data());
+    for (size_t j = 0; j < output.size(); ++j)
+      ASSERT_NEAR(output[j], expected[j], 1e-4f) << "at " << j;
+  }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/reference/DepthwiseConv.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct DepthwiseConvCase
+{
+  int batches;
+  int input_height;
+  int input_width;
+  int input_depth;
+  int filter_height;
+  int filter_width;
+  int depth_multiplier;
+  int stride;
+  int dilation;
+  int pad;
+};
+
+std::vector<float> randomData(int size, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> data(size);
+  for (auto &v : data)
+    v = dist(gen);
+  return data;
+}
+
+void verifyDepthwiseConv(const DepthwiseConvCase &c, float activation_min, float activation_max,
+                         const Eigen::ThreadPoolDevice *device)
+{
+  using namespace nnfw::cker;
+
+  const int output_depth = c.input_depth * c.depth_multiplier;
+  const int output_height =
+      (c.input_height + 2 * c.pad - c.dilation * (c.filter_height - 1) - 1) / c.stride + 1;
+  const int output_width =
+      (c.input_width + 2 * c.pad - c.dilation * (c.filter_width - 1) - 1) / c.stride + 1;
+  const Shape input_shape{c.batches, c.input_height, c.input_width, c.input_depth};
+  const Shape filter_shape{1, c.filter_height, c.filter_width, output_depth};
+  const Shape bias_shape{output_depth};
+  const Shape output_shape{c.batches, output_height, output_width, output_depth};
+
+  const auto input = randomData(input_shape.FlatSize(), 1);
+  const auto filter = randomData(filter_shape.FlatSize(), 2);
+  const auto bias = randomData(bias_shape.FlatSize(), 3);
+
+  DepthwiseConvParams params;
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = c.dilation;
+  params.dilation_height_factor = c.dilation;
+  params.depth_multiplier = c.depth_multiplier;
+  params.float_activation_min = activation_min;
+  params.float_activation_max = activation_max;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference::DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                           bias_shape, bias.data(), output_shape, expected.data());
+
+  std::vector<float> output(output_shape.FlatSize());
+  DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                bias.data(), output_shape, output.data(), device);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-5f) << "index " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, DepthwiseConvFloat)
+{
+  // batches, input h/w/depth, filter h/w, depth multiplier, stride, dilation, pad
+  const std::vector<DepthwiseConvCase> cases{
+      // 3x3 kernel, with depths that are not a multiple of the vector width
+      {1, 9, 11, 8, 3, 3, 1, 1, 1, 1},
+      {2, 7, 6, 5, 3, 3, 1, 1, 1, 0},
+      {1, 10, 9, 13, 3, 3, 1, 2, 1, 1},
+      {1, 8, 8, 3, 3, 3, 1, 2, 1, 0},
+      // Generic accumulation
+      {1, 9, 9, 4, 3, 3, 2, 1, 1, 1},
+      {1, 11, 10, 6, 3, 3, 1, 1, 2, 2},
+      {2, 12, 7, 7, 5, 5, 1, 1, 1, 2},
+      {1, 9, 13, 3, 1, 3, 3, 3, 1, 0},
+      {1, 4, 4, 2, 3, 3, 1, 1, 1, 2},
+  };
+
+  Eigen::ThreadPool thread_pool(3);
+  Eigen::ThreadPoolDevice device(&thread_pool, 3);
+  for (size_t i = 0; i < cases.size(); ++i)
+  {
+    SCOPED_TRACE(testing::Message() << "case " << i);
+    verifyDepthwiseConv(cases[i], std::numeric_limits<float>::lowest(),
+                        std::numeric_limits<float>::max(), &device);
+    verifyDepthwiseConv(cases[i], -0.5f, 0.5f, &device);
+  }
+}
+
+TEST(CKer_Operation, DepthwiseConvFloatGlobalThreadPool)
+{
+  verifyDepthwiseConv({1, 16, 16, 32, 3, 3, 1, 1, 1, 1}, 0.f, 6.f, nullptr);
+}
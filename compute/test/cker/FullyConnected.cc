@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST(CKer_Operation, FullyConnectedPerChannelInt8)
+{
+  using namespace nnfw::cker;
+
+  const int batches = 3;
+  const int input_size = 37;
+  const int num_units = 10;
+
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> int8_dist(-128, 127);
+  std::uniform_int_distribution<int> bias_dist(-1000, 1000);
+  std::vector<int8_t> input(batches * input_size);
+  std::vector<int8_t> weights(num_units * input_size);
+  std::vector<int32_t> bias(num_units);
+  for (auto &v : input)
+    v = static_cast<int8_t>(int8_dist(gen));
+  for (auto &v : weights)
+    v = static_cast<int8_t>(int8_dist(gen));
+  for (auto &v : bias)
+    v = bias_dist(gen);
+
+  const int32_t input_zero_point = -7;
+  const int32_t output_zero_point = 2;
+  const float input_scale = 0.03f;
+  const float output_scale = 0.5f;
+  std::vector<float> weight_scales(num_units);
+  std::vector<int32_t> multipliers(num_units);
+  std::vector<int32_t> shifts(num_units);
+  for (int i = 0; i < num_units; ++i)
+  {
+    weight_scales[i] = 0.001f * (i + 1) * (i + 1);
+    int shift = 0;
+    QuantizeMultiplier(static_cast<double>(input_scale) * weight_scales[i] / output_scale,
+                       &multipliers[i], &shift);
+    shifts[i] = shift;
+  }
+
+  FullyConnectedParams params{};
+  params.input_offset = -input_zero_point;
+  params.output_offset = output_zero_point;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  ruy::Context ruy_context;
+  std::vector<int8_t> output(batches * num_units);
+  FullyConnectedPerChannel(params, multipliers.data(), shifts.data(),
+                           Shape{batches, input_size}, input.data(),
+                           Shape{num_units, input_size}, weights.data(), Shape{num_units},
+                           bias.data(), Shape{batches, num_units}, output.data(), &ruy_context);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int u = 0; u < num_units; ++u)
+    {
+      int32_t acc = bias[u];
+      for (int i = 0; i < input_size; ++i)
+        acc += (input[b * input_size + i] - input_zero_point) * weights[u * input_size + i];
+      const double real = acc * static_cast<double>(input_scale) * weight_scales[u];
+      const double q = std::round(real / output_scale) + output_zero_point;
+      const int expected = static_cast<int>(std::min(127.0, std::max(-128.0, q)));
+      ASSERT_NEAR(output[b * num_units + u], expected, 1) << "batch " << b << ", unit " << u;
+    }
+  }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedSparse.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// Weights in block CSR format, with the dense weights they encode
+struct BlockSparseWeights
+{
+  std::vector<float> dense;
+  std::vector<float> blocks;
+  std::vector<uint16_t> segments;
+  std::vector<uint16_t> indices;
+};
+
+BlockSparseWeights randomBlockSparseWeights(int rows, int cols, int block_rows, int block_cols,
+                                            unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> value_dist(-1.f, 1.f);
+  std::bernoulli_distribution nonzero_dist(0.3);
+
+  BlockSparseWeights weights;
+  weights.dense.assign(rows * cols, 0.f);
+  weights.segments.push_back(0);
+  for (int br = 0; br < rows / block_rows; ++br)
+  {
+    for (int bc = 0; bc < cols / block_cols; ++bc)
+    {
+      if (!nonzero_dist(gen))
+        continue;
+      weights.indices.push_back(static_cast<uint16_t>(bc));
+      // A block is stored in row-major order
+      for (int r = 0; r < block_rows; ++r)
+      {
+        for (int c = 0; c < block_cols; ++c)
+        {
+          const float value = value_dist(gen);
+          weights.blocks.push_back(value);
+          weights.dense[(br * block_rows + r) * cols + bc * block_cols + c] = value;
+        }
+      }
+    }
+    weights.segments.push_back(static_cast<uint16_t>(weights.indices.size()));
+  }
+  return weights;
+}
+
+void verifyFullyConnectedSparse(int block_rows, int block_cols,
+                                const Eigen::ThreadPoolDevice *device)
+{
+  const int batches = 3;
+  const int rows = 48;
+  const int cols = 64;
+  const auto weights = randomBlockSparseWeights(rows, cols, block_rows, block_cols, 7);
+
+  std::mt19937 gen(9);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> input(batches * cols);
+  std::vector<float> bias(rows);
+  for (auto &v : input)
+    v = dist(gen);
+  for (auto &v : bias)
+    v = dist(gen);
+
+  std::vector<float> expected(batches * rows);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      float acc = bias[r];
+      for (int c = 0; c < cols; ++c)
+        acc += weights.dense[r * cols + c] * input[b * cols + c];
+      expected[b * rows + r] = std::max(acc, 0.f);
+    }
+  }
+
+  FullyConnectedParams params;
+  params.activation = FusedActivationFunctionType::kRelu;
+  std::vector<float> output(batches * rows);
+  FullyConnectedSparseWeight(params, Shape{batches, cols}, input.data(), Shape{rows, cols},
+                             weights.blocks.data(), Shape{rows}, bias.data(),
+                             Shape{batches, rows}, output.data(), weights.segments.data(),
+                             weights.indices.data(), block_rows, block_cols, device);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedSparseWeight)
+{
+  Eigen::ThreadPool thread_pool(3);
+  Eigen::ThreadPoolDevice device(&thread_pool, 3);
+
+  // Block sizes with specialized kernels, and ones that fall back to the generic loop
+  const std::vector<std::pair<int, int>> block_sizes{
+      {1, 1}, {1, 4}, {1, 8}, {1, 16}, {4, 1}, {8, 1}, {16, 1},
+      {2, 2}, {4, 4}, {8, 8}, {2, 4}, {3, 1}, {1, 2}, {6, 8}};
+  for (const auto &block_size : block_sizes)
+  {
+    SCOPED_TRACE(testing::Message() << "block " << block_size.first << "x" << block_size.second);
+    verifyFullyConnectedSparse(block_size.first, block_size.second, &device);
+  }
+}
+
+TEST(CKer_Operation, FullyConnectedSparseWeightGlobalThreadPool)
+{
+  verifyFullyConnectedSparse(16, 1, nullptr);
+}
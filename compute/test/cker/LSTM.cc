@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+#include <cker/operation/RNN.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> makeData(int size, int seed)
+{
+  // Deterministic values in [-0.5, 0.5)
+  std::vector<float> data(size);
+  uint32_t state = 12345u + seed * 7919u;
+  for (auto &v : data)
+  {
+    state = state * 1103515245u + 12345u;
+    v = static_cast<float>((state >> 8) & 0xffff) / 65536.f - 0.5f;
+  }
+  return data;
+}
+
+float sigmoid(float x) { return 1.f / (1.f + std::exp(-x)); }
+
+struct LSTMConfig
+{
+  bool cifg;
+  bool peephole;
+  bool projection;
+  float cell_clip;
+  float proj_clip;
+};
+
+// Weights in the order of input, forget, cell and output gate
+struct LSTMWeights
+{
+  std::vector<std::vector<float>> input_weights;
+  std::vector<std::vector<float>> recurrent_weights;
+  std::vector<std::vector<float>> biases;
+  std::vector<std::vector<float>> peephole_weights;
+  std::vector<float> projection_weights;
+  std::vector<float> projection_bias;
+};
+
+LSTMWeights makeWeights(const LSTMConfig &config, int n_cell, int n_input, int n_output)
+{
+  LSTMWeights w;
+  int seed = 0;
+  for (int g = 0; g < 4; ++g)
+  {
+    w.input_weights.push_back(makeData(n_cell * n_input, ++seed));
+    w.recurrent_weights.push_back(makeData(n_cell * n_output, ++seed));
+    w.biases.push_back(makeData(n_cell, ++seed));
+    w.peephole_weights.push_back(makeData(n_cell, ++seed));
+  }
+  if (config.projection)
+  {
+    w.projection_weights = makeData(n_output * n_cell, ++seed);
+    w.projection_bias = makeData(n_output, ++seed);
+  }
+  return w;
+}
+
+// A step of LSTM for one batch, as described in the NNAPI and tflite specification
+void referenceLSTMStep(const LSTMConfig &config, const LSTMWeights &w, int n_cell, int n_input,
+                       int n_output, const float *input, float *output_state, float *cell_state)
+{
+  auto gate = [&](int g) {
+    std::vector<float> out(n_cell);
+    for (int r = 0; r < n_cell; ++r)
+    {
+      float acc = w.biases[g][r];
+      for (int c = 0; c < n_input; ++c)
+        acc += w.input_weights[g][r * n_input + c] * input[c];
+      for (int c = 0; c < n_output; ++c)
+        acc += w.recurrent_weights[g][r * n_output + c] * output_state[c];
+      out[r] = acc;
+    }
+    return out;
+  };
+
+  auto input_gate = gate(0);
+  auto forget_gate = gate(1);
+  auto cell_gate = gate(2);
+  auto output_gate = gate(3);
+  std::vector<float> hidden(n_cell);
+  for (int i = 0; i < n_cell; ++i)
+  {
+    const float c_prev = cell_state[i];
+    const float peep = config.peephole ? 1.f : 0.f;
+    forget_gate[i] = sigmoid(forget_gate[i] + peep * w.peephole_weights[1][i] * c_prev);
+    input_gate[i] = config.cifg
+                        ? 1.f - forget_gate[i]
+                        : sigmoid(input_gate[i] + peep * w.peephole_weights[0][i] * c_prev);
+    float c = forget_gate[i] * c_prev + input_gate[i] * std::tanh(cell_gate[i]);
+    if (config.cell_clip > 0.f)
+      c = std::min(std::max(c, -config.cell_clip), config.cell_clip);
+    cell_state[i] = c;
+    output_gate[i] = sigmoid(output_gate[i] + peep * w.peephole_weights[3][i] * c);
+    hidden[i] = output_gate[i] * std::tanh(c);
+  }
+
+  if (!config.projection)
+  {
+    std::copy(hidden.begin(), hidden.end(), output_state);
+    return;
+  }
+  for (int r = 0; r < n_output; ++r)
+  {
+    float acc = w.projection_bias[r];
+    for (int c = 0; c < n_cell; ++c)
+      acc += w.projection_weights[r * n_cell + c] * hidden[c];
+    if (config.proj_clip > 0.f)
+      acc = std::min(std::max(acc, -config.proj_clip), config.proj_clip);
+    output_state[r] = acc;
+  }
+}
+
+void quantizeSymmetric(const std::vector<float> &values, std::vector<int8_t> &quantized,
+                       float &scale)
+{
+  float max_abs = 0.f;
+  for (auto v : values)
+    max_abs = std::max(max_abs, std::abs(v));
+  scale = max_abs / 127.f;
+  quantized.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+    quantized[i] = static_cast<int8_t>(std::round(values[i] / scale));
+}
+
+void runLSTM(const LSTMConfig &config, bool hybrid)
+{
+  const int n_batch = 2;
+  const int n_input = 5;
+  const int n_cell = 4;
+  const int n_output = config.projection ? 3 : n_cell;
+  const int n_steps = 3;
+
+  LSTMWeights w = makeWeights(config, n_cell, n_input, n_output);
+  const int first_gate = config.cifg ? 1 : 0;
+  const int n_gates = 4 - first_gate;
+
+  nnfw::cker::RecurrentGates gates;
+  std::vector<const float *> biases;
+  for (int g = first_gate; g < 4; ++g)
+    biases.push_back(w.biases[g].data());
+
+  std::vector<std::vector<int8_t>> q_input(4), q_recurrent(4);
+  std::vector<float> input_scales, recurrent_scales;
+  if (hybrid)
+  {
+    std::vector<const int8_t *> input_weights, recurrent_weights;
+    for (int g = first_gate; g < 4; ++g)
+    {
+      float scale;
+      quantizeSymmetric(w.input_weights[g], q_input[g], scale);
+      input_scales.push_back(scale);
+      quantizeSymmetric(w.recurrent_weights[g], q_recurrent[g], scale);
+      recurrent_scales.push_back(scale);
+      input_weights.push_back(q_input[g].data());
+      recurrent_weights.push_back(q_recurrent[g].data());
+      // The reference runs on the dequantized weights
+      for (size_t i = 0; i < w.input_weights[g].size(); ++i)
+        w.input_weights[g][i] = q_input[g][i] * input_scales.back();
+      for (size_t i = 0; i < w.recurrent_weights[g].size(); ++i)
+        w.recurrent_weights[g][i] = q_recurrent[g][i] * recurrent_scales.back();
+    }
+    gates.pack(n_gates, n_cell, n_input, n_output, input_weights.data(), input_scales.data(),
+               recurrent_weights.data(), recurrent_scales.data(), biases.data());
+  }
+  else
+  {
+    std::vector<const float *> input_weights, recurrent_weights;
+    for (int g = first_gate; g < 4; ++g)
+    {
+      input_weights.push_back(w.input_weights[g].data());
+      recurrent_weights.push_back(w.recurrent_weights[g].data());
+    }
+    gates.pack(n_gates, n_cell, n_input, n_output, input_weights.data(), recurrent_weights.data(),
+               biases.data());
+  }
+
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = config.cell_clip;
+  params.proj_clip = config.proj_clip;
+
+  const float *peephole[4] = {nullptr, nullptr, nullptr, nullptr};
+  if (config.peephole)
+  {
+    for (int g = first_gate; g < 4; ++g)
+      peephole[g] = w.peephole_weights[g].data();
+  }
+
+  ruy::Context ruy_context;
+  nnfw::cker::LSTMTempArena arena;
+  std::vector<float> output_state(n_batch * n_output, 0.f);
+  std::vector<float> cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> output(n_batch * n_output);
+  std::vector<float> expected_output_state = output_state;
+  std::vector<float> expected_cell_state = cell_state;
+
+  // Hybrid gates quantize input and state per batch, which bounds the error
+  const float tolerance = hybrid ? 2e-2f : 1e-5f;
+  for (int step = 0; step < n_steps; ++step)
+  {
+    const auto input = makeData(n_batch * n_input, 100 + step);
+    nnfw::cker::LSTM(params, n_batch, n_cell, n_output, input.data(), gates, peephole[0],
+                     peephole[1], peephole[3],
+                     config.projection ? w.projection_weights.data() : nullptr,
+                     config.projection ? w.projection_bias.data() : nullptr,
+                     output_state.data(), cell_state.data(), output_state.data(),
+                     cell_state.data(), output.data(), arena, &ruy_context);
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      referenceLSTMStep(config, w, n_cell, n_input, n_output, input.data() + b * n_input,
+                        expected_output_state.data() + b * n_output,
+                        expected_cell_state.data() + b * n_cell);
+    }
+
+    for (int i = 0; i < n_batch * n_output; ++i)
+    {
+      ASSERT_NEAR(output[i], expected_output_state[i], tolerance) << "step " << step;
+      ASSERT_NEAR(output_state[i], expected_output_state[i], tolerance) << "step " << step;
+    }
+    for (int i = 0; i < n_batch * n_cell; ++i)
+      ASSERT_NEAR(cell_state[i], expected_cell_state[i], tolerance) << "step " << step;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, LSTM)
+{
+  runLSTM({false, false, false, 0.f, 0.f}, false);
+}
+
+TEST(CKer_Operation, LSTMCIFG)
+{
+  runLSTM({true, false, false, 0.f, 0.f}, false);
+}
+
+TEST(CKer_Operation, LSTMPeephole)
+{
+  runLSTM({false, true, false, 0.f, 0.f}, false);
+  runLSTM({true, true, false, 0.f, 0.f}, false);
+}
+
+TEST(CKer_Operation, LSTMProjection)
+{
+  runLSTM({false, true, true, 0.f, 0.f}, false);
+  runLSTM({false, false, true, 0.3f, 0.2f}, false);
+}
+
+TEST(CKer_Operation, LSTMHybrid)
+{
+  runLSTM({false, false, false, 0.f, 0.f}, true);
+  runLSTM({true, true, true, 0.f, 0.f}, true);
+}
+
+TEST(CKer_Operation, RNN)
+{
+  const int n_batch = 2;
+  const int n_input = 3;
+  const int n_unit = 4;
+
+  const auto input_weights = makeData(n_unit * n_input, 1);
+  const auto recurrent_weights = makeData(n_unit * n_unit, 2);
+  const auto bias = makeData(n_unit, 3);
+
+  nnfw::cker::RecurrentGates weights;
+  const float *input_weights_ptr = input_weights.data();
+  const float *recurrent_weights_ptr = recurrent_weights.data();
+  const float *bias_ptr = bias.data();
+  weights.pack(1, n_unit, n_input, n_unit, &input_weights_ptr, &recurrent_weights_ptr, &bias_ptr);
+
+  ruy::Context ruy_context;
+  std::vector<float> hidden_state(n_batch * n_unit, 0.f);
+  std::vector<float> expected = hidden_state;
+  std::vector<float> output(n_batch * n_unit);
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = makeData(n_batch * n_input, 100 + step);
+    nnfw::cker::RNN(nnfw::cker::FusedActivationFunctionType::kRelu, n_batch, n_unit, input.data(),
+                    weights, hidden_state.data(), hidden_state.data(), output.data(),
+                    &ruy_context);
+
+    std::vector<float> next(n_batch * n_unit);
+    for (int b = 0; b < n_batch; ++b)
+    {
+      for (int r = 0; r < n_unit; ++r)
+      {
+        float acc = bias[r];
+        for (int c = 0; c < n_input; ++c)
+          acc += input_weights[r * n_input + c] * input[b * n_input + c];
+        for (int c = 0; c < n_unit; ++c)
+          acc += recurrent_weights[r * n_unit + c] * expected[b * n_unit + c];
+        next[b * n_unit + r] = std::max(acc, 0.f);
+      }
+    }
+    expected = next;
+
+    for (int i = 0; i < n_batch * n_unit; ++i)
+    {
+      ASSERT_NEAR(output[i], expected[i], 1e-5f) << "step " << step;
+      ASSERT_NEAR(hidden_state[i], expected[i], 1e-5f) << "step " << step;
+    }
+  }
+}
+
+TEST(CKer_Operation, RNNSharedWeights)
+{
+  const int n_batch = 1;
+  const int n_input = 3;
+  const int n_unit = 4;
+
+  const auto input_weights = makeData(n_unit * n_input, 1);
+  const auto recurrent_weights = makeData(n_unit * n_unit, 2);
+  const auto bias = makeData(n_unit, 3);
+  const auto input = makeData(n_batch * n_input, 100);
+  const std::vector<float> hidden_state(n_batch * n_unit, 0.5f);
+
+  nnfw::cker::RecurrentGates weights;
+  const float *input_weights_ptr = input_weights.data();
+  const float *recurrent_weights_ptr = recurrent_weights.data();
+  const float *bias_ptr = bias.data();
+  weights.pack(1, n_unit, n_input, n_unit, &input_weights_ptr, &recurrent_weights_ptr, &bias_ptr);
+
+  nnfw::cker::RecurrentGates shared;
+  shared.share(weights);
+  EXPECT_EQ(shared.weights_data(), weights.weights_data());
+  EXPECT_EQ(shared.weights_size(), weights.weights_size());
+
+  ruy::Context ruy_context;
+  std::vector<float> expected(n_batch * n_unit);
+  std::vector<float> output(n_batch * n_unit);
+  std::vector<float> state_out(n_batch * n_unit);
+  nnfw::cker::RNN(nnfw::cker::FusedActivationFunctionType::kNone, n_batch, n_unit, input.data(),
+                  weights, hidden_state.data(), state_out.data(), expected.data(), &ruy_context);
+
+  // Packing again does not overwrite weights that others share
+  const auto other_weights = makeData(n_unit * n_input, 4);
+  const float *other_weights_ptr = other_weights.data();
+  weights.pack(1, n_unit, n_input, n_unit, &other_weights_ptr, &recurrent_weights_ptr, &bias_ptr);
+  EXPECT_NE(shared.weights_data(), weights.weights_data());
+
+  nnfw::cker::RNN(nnfw::cker::FusedActivationFunctionType::kNone, n_batch, n_unit, input.data(),
+                  shared, hidden_state.data(), state_out.data(), output.data(), &ruy_context);
+  for (int i = 0; i < n_batch * n_unit; ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
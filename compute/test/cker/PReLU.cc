@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/PReLU.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, PReLU)
+{
+  // alpha per channel
+  const nnfw::cker::Shape input_shape{1, 2, 2, 2};
+  const nnfw::cker::Shape alpha_shape{2};
+  std::vector<float> input = {-2, 1, 3, -4, -1, -1, 0, 2};
+  std::vector<float> alpha = {0.5, 0.25};
+  std::vector<float> expected = {-1, 1, 3, -1, -0.5, -0.25, 0, 2};
+  std::vector<float> output(expected.size());
+
+  nnfw::cker::PReLU(input_shape, input.data(), alpha_shape, alpha.data(), input_shape,
+                    output.data());
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation, PReLUQuant8)
+{
+  const float input_scale = 0.5f;
+  const int32_t input_zero_point = 128;
+  const float alpha_scale = 0.25f;
+  const int32_t alpha_zero_point = 0;
+  const float output_scale = 0.25f;
+  const int32_t output_zero_point = 120;
+
+  const nnfw::cker::Shape input_shape{1, 2, 2, 3};
+  const nnfw::cker::Shape alpha_shape{1, 1, 3};
+  std::vector<uint8_t> input = {120, 128, 136, 100, 140, 127, 128, 129, 80, 150, 110, 131};
+  std::vector<uint8_t> alpha = {1, 2, 4};
+
+  nnfw::cker::PReLUParams params;
+  params.input_offset = -input_zero_point;
+  params.alpha_offset = -alpha_zero_point;
+  params.output_offset = output_zero_point;
+  nnfw::cker::QuantizeMultiplier(input_scale / output_scale, &params.output_multiplier_1,
+                                 &params.output_shift_1);
+  nnfw::cker::QuantizeMultiplier(input_scale * alpha_scale / output_scale,
+                                 &params.output_multiplier_2, &params.output_shift_2);
+
+  std::vector<uint8_t> output(input.size());
+  nnfw::cker::PReLU(params, input_shape, input.data(), alpha_shape, alpha.data(), input_shape,
+                    output.data());
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const float x = input_scale * (input[i] - input_zero_point);
+    const float a = alpha_scale * (alpha[i % 3] - alpha_zero_point);
+    const float y = x >= 0 ? x : x * a;
+    const float q =
+        std::min(std::max(std::round(y / output_scale) + output_zero_point, 0.f), 255.f);
+    ASSERT_NEAR(output[i], q, 1) << "at " << i;
+  }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/PortableTensorUtils.h>
+#include <cker/X86TensorUtils.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#ifdef USE_X86_SIMD
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+template <typename T> std::vector<T> randomVector(std::mt19937 &gen, int size, T lo, T hi)
+{
+  std::uniform_real_distribution<float> dist(lo, hi);
+  std::vector<T> v(size);
+  for (auto &e : v)
+    e = static_cast<T>(dist(gen));
+  return v;
+}
+
+// Sizes around every vector width so that both the SIMD body and the scalar tail are exercised
+const int kColsToTest[] = {1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 64, 67};
+
+} // namespace
+
+TEST(CKer_Utils, X86DotProductInt8)
+{
+  std::mt19937 gen(0);
+  for (int size : kColsToTest)
+  {
+    const auto a = randomVector<int8_t>(gen, size, -127, 127);
+    const auto b = randomVector<int8_t>(gen, size, -127, 127);
+    int32_t expected = 0;
+    for (int i = 0; i < size; ++i)
+      expected += a[i] * b[i];
+
+    auto check = [&](int (*dot_product)(const int8_t *, const int8_t *, int, int32_t *)) {
+      int32_t dotprod = 0;
+      int i = dot_product(a.data(), b.data(), size, &dotprod);
+      for (; i < size; ++i)
+        dotprod += a[i] * b[i];
+      EXPECT_EQ(dotprod, expected) << "size " << size;
+    };
+    check(Sse41DotProduct);
+    if (GetX86CpuFeatures().avx2)
+      check(Avx2DotProduct);
+    if (GetX86CpuFeatures().avx512)
+      check(Avx512DotProduct);
+  }
+}
+
+TEST(CKer_Utils, X86DotProductFloat)
+{
+  std::mt19937 gen(1);
+  for (int size : kColsToTest)
+  {
+    const auto a = randomVector<float>(gen, size, -1.f, 1.f);
+    const auto b = randomVector<float>(gen, size, -1.f, 1.f);
+    float expected = 0.f;
+    for (int i = 0; i < size; ++i)
+      expected += a[i] * b[i];
+
+    auto check = [&](int (*dot_product)(const float *, const float *, int, float *)) {
+      float dotprod = 0.f;
+      int i = dot_product(a.data(), b.data(), size, &dotprod);
+      for (; i < size; ++i)
+        dotprod += a[i] * b[i];
+      EXPECT_NEAR(dotprod, expected, 1e-4f) << "size " << size;
+    };
+    check(Sse41DotProduct);
+    if (GetX86CpuFeatures().avx2)
+      check(Avx2DotProduct);
+    if (GetX86CpuFeatures().avx512)
+      check(Avx512DotProduct);
+  }
+}
+
+TEST(CKer_Utils, X86MatrixBatchVectorMultiplyAccumulateFloat)
+{
+  std::mt19937 gen(2);
+  const int rows = 5;
+  const int batch = 3;
+  for (int cols : kColsToTest)
+  {
+    const auto matrix = randomVector<float>(gen, rows * cols, -1.f, 1.f);
+    const auto vectors = randomVector<float>(gen, batch * cols, -1.f, 1.f);
+    std::vector<float> expected(rows * batch, 0.5f);
+    std::vector<float> actual(expected);
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vectors.data(), batch,
+                                                expected.data(), 1);
+    X86MatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vectors.data(), batch,
+                                           actual.data(), 1);
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_NEAR(actual[i], expected[i], 1e-4f) << "cols " << cols << ", index " << i;
+  }
+}
+
+TEST(CKer_Utils, X86MatrixBatchVectorMultiplyAccumulateInt8)
+{
+  std::mt19937 gen(3);
+  const int rows = 5;
+  const int batch = 3;
+  const std::vector<float> scaling_factors = {0.5f, 0.25f, 2.f};
+  for (int cols : kColsToTest)
+  {
+    const auto matrix = randomVector<int8_t>(gen, rows * cols, -127, 127);
+    const auto vectors = randomVector<int8_t>(gen, batch * cols, -127, 127);
+    std::vector<float> expected(rows * batch, 1.f);
+    std::vector<float> actual(expected);
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vectors.data(),
+                                                scaling_factors.data(), batch, expected.data(), 1);
+    X86MatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vectors.data(),
+                                           scaling_factors.data(), batch, actual.data(), 1);
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_FLOAT_EQ(actual[i], expected[i]) << "cols " << cols << ", index " << i;
+  }
+}
+
+TEST(CKer_Utils, X86SymmetricQuantizeFloats)
+{
+  std::mt19937 gen(4);
+  for (int size : kColsToTest)
+  {
+    const auto values = randomVector<float>(gen, size, -3.f, 3.f);
+    std::vector<int8_t> expected(size), actual(size);
+    float expected_min, expected_max, expected_scale;
+    float actual_min, actual_max, actual_scale;
+    PortableSymmetricQuantizeFloats(values.data(), size, expected.data(), &expected_min,
+                                    &expected_max, &expected_scale);
+    X86SymmetricQuantizeFloats(values.data(), size, actual.data(), &actual_min, &actual_max,
+                               &actual_scale);
+    EXPECT_EQ(actual_min, expected_min);
+    EXPECT_EQ(actual_max, expected_max);
+    EXPECT_EQ(actual_scale, expected_scale);
+    EXPECT_EQ(actual, expected) << "size " << size;
+  }
+}
+
+TEST(CKer_Utils, X86IsZeroVectorAndActivation)
+{
+  std::mt19937 gen(5);
+  for (int size : kColsToTest)
+  {
+    std::vector<float> zeros(size, 0.f);
+    EXPECT_TRUE(X86IsZeroVector(zeros.data(), size));
+    zeros[size - 1] = 1.f;
+    EXPECT_FALSE(X86IsZeroVector(zeros.data(), size));
+
+    const auto values = randomVector<float>(gen, size, -8.f, 8.f);
+    for (auto activation : {FusedActivationFunctionType::kRelu, FusedActivationFunctionType::kRelu1,
+                            FusedActivationFunctionType::kRelu6})
+    {
+      std::vector<float> expected(size), actual(size);
+      PortableApplyActivationToVector(values.data(), size, activation, expected.data());
+      X86ApplyActivationToVector(values.data(), size, activation, actual.data());
+      EXPECT_EQ(actual, expected) << "size " << size;
+    }
+  }
+}
+
+#endif // USE_X86_SIMD
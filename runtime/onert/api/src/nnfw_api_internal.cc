@@ -18,6 +18,7 @@
 #include "CustomKernelRegistry.h"
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
+#include "util/CompileCache.h"
 #include "util/Exceptions.h"
 #include "exec/Execution.h"
 #include "circle_loader.h"
@@ -183,6 +184,7 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
       return NNFW_STATUS_ERROR;
     }
     _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+    _model_file_path = model_file_path;
   }
   catch (const std::exception &e)
   {
@@ -223,6 +225,11 @@ NNFW_STATUS nnfw_session::prepare()
 
   try
   {
+    // Cached data of constants are keyed by the model file instead of hashing each constant
+    auto &options = _compiler->options();
+    if (!options.cache_dir.empty() && !_model_file_path.empty())
+      options.cache_model_key = onert::util::CompileCache::hashFile(_model_file_path);
+
     _subgraphs.reset();
     std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
     _execution = std::make_shared<onert::exec::Execution>(executors);
@@ -735,6 +742,18 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::COMPILE_CACHE_DIR)
+  {
+    options.cache_dir = value;
+  }
+  else if (skey == config::DISABLE_OP_FUSION)
+  {
+    options.disable_op_fusion = toBool(value);
+  }
+  else if (skey == config::COMPILE_CACHE_MAX_SIZE)
+  {
+    options.cache_max_size = toInt(value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -156,6 +156,7 @@ private:
   std::unique_ptr<onert::compiler::Compiler> _compiler;
   std::shared_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
+  std::string _model_file_path; //< Path of the model file, empty if loaded from a buffer
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
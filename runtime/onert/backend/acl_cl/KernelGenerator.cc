@@ -987,6 +987,10 @@ void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
   const auto ofm_index{node.getOutputs().at(0)};
   const auto ifm_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT)};
 
+  // CLScale samples at the top-left corner of pixels
+  if (node.param().half_pixel_centers)
+    throw std::runtime_error("acl_cl: ResizeNearestNeighbor does not support half_pixel_centers");
+
   auto ofm_tensor = _tensor_reg->getAclTensor(ofm_index);
   auto ifm_tensor = _tensor_reg->getAclTensor(ifm_index);
 
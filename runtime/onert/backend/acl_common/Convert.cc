@@ -129,6 +129,10 @@ namespace acl_common
                                        ir::Layout frontend_layout, ir::Layout backend_layout,
                                        bool apply_dim_correction)
 {
+  // Only the first scale would be given to ACL, which gives wrong results silently
+  if (!typeInfo.scales().empty())
+    throw std::runtime_error("acl backends do not support tensors quantized per channel");
+
   ::arm_compute::TensorInfo info(
       asTensorShape(shape, frontend_layout, backend_layout, apply_dim_correction), 1,
       asDataType(typeInfo.type()), asQuantizationInfo(typeInfo.scale(), typeInfo.offset()));
@@ -46,14 +46,15 @@ public:
   {
     const auto &operands = graph.operands();
     const auto &operations = graph.operations();
-    auto context = std::make_unique<BackendContext>(this, &graph);
+    auto external_context = std::make_shared<ExternalContext>();
+    auto context = std::make_unique<BackendContext>(this, &graph, external_context);
     auto tr = std::make_shared<cpu_common::TensorRegistry>();
     auto tb = std::make_shared<TensorBuilder>(tr);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tr);
-    context->kernel_gen = std::make_shared<KernelGenerator>(operands, operations, tb, tr, kb,
-                                                            context->external_context());
+    context->kernel_gen =
+        std::make_shared<KernelGenerator>(operands, operations, tb, tr, kb, external_context);
     context->tensor_register = nullptr;
     context->optimizer = nullptr;
     return context;
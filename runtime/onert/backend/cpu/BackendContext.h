@@ -31,6 +31,7 @@ class BackendContext : public onert::backend::BackendContext
 {
 public:
   BackendContext(const Backend *backend, const ir::Graph *graph,
+                 std::shared_ptr<ExternalContext> external_context,
                  std::shared_ptr<ITensorRegistry> tensor_registry = nullptr,
                  std::shared_ptr<ITensorBuilder> tensor_builder = nullptr,
                  std::shared_ptr<IConstantInitializer> constant_initializer = nullptr,
@@ -40,11 +41,11 @@ public:
       : onert::backend::BackendContext(backend, graph, tensor_registry, tensor_builder,
                                        constant_initializer, kernel_gen, tensor_register,
                                        optimizer),
-        _external_context(new ExternalContext)
+        _external_context(external_context)
   {
   }
 
-  std::shared_ptr<ExternalContext> external_context() { return _external_context; }
+  std::shared_ptr<IExternalContext> external_context() override { return _external_context; }
 
 private:
   // NOTE ruy context has a thread pool, and when multiple ruy contexts are created,
@@ -18,8 +18,19 @@
 #define __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 
 #include <backend/IExternalContext.h>
+#include <exec/ThreadPool.h>
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
+#include <cker/eigen/EigenSupport.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace
 {
@@ -33,27 +44,248 @@ namespace backend
 namespace cpu
 {
 
+// Eigen thread pool interface on the thread pool of runtime
+class EigenThreadPool : public Eigen::ThreadPoolInterface
+{
+public:
+  explicit EigenThreadPool(const std::shared_ptr<exec::ThreadPool> &pool) : _pool{pool} {}
+
+  void Schedule(std::function<void()> fn) override { _pool->enqueue(std::move(fn)); }
+  int NumThreads() const override { return static_cast<int>(_pool->numThreads()); }
+  int CurrentThreadId() const override { return _pool->currentWorkerIndex(); }
+
+private:
+  std::shared_ptr<exec::ThreadPool> _pool;
+};
+
 class ExternalContext : public IExternalContext
 {
+private:
+  struct SharedResources;
+
+public:
+  /**
+   * @brief ruy context that a kernel uses alone until the lease goes out of scope
+   */
+  class RuyContextLease
+  {
+  public:
+    RuyContextLease(const std::shared_ptr<SharedResources> &shared, size_t index);
+    RuyContextLease(RuyContextLease &&other);
+    RuyContextLease(const RuyContextLease &) = delete;
+    ~RuyContextLease();
+
+    ruy::Context *get() const { return _context; }
+
+  private:
+    std::shared_ptr<SharedResources> _shared;
+    size_t _index;
+    ruy::Context *_context;
+  };
+
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
+  ExternalContext() : _shared(std::make_shared<SharedResources>())
+  {
+    setRuyMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    const int prepack_max_size = onert::util::getConfigInt(util::config::RUY_PREPACK_MAX_SIZE);
+    _shared->prepack_heap_budget = prepack_max_size < 0
+                                       ? std::numeric_limits<size_t>::max()
+                                       : static_cast<size_t>(prepack_max_size) << 20;
+  }
+
+  /**
+   * @brief Set the maximum number of threads of ruy
+   * @note  If max_num_threads is negative, ruy uses the default number of threads. RUY_THREADS
+   *        wins if it is smaller.
+   */
+  void setMaxNumThreads(int max_num_threads) override
+  {
+    const int ruy_threads = onert::util::getConfigInt(onert::util::config::RUY_THREADS);
+    if (ruy_threads > 0 && (max_num_threads < 0 || ruy_threads < max_num_threads))
+      max_num_threads = ruy_threads;
+    setRuyMaxNumThreads(max_num_threads);
+  }
+
+  /**
+   * @brief Run Eigen kernels on the thread pool of the session
+   * @note  Without the pool, Eigen kernels use the global thread pool of cker. ruy cannot run on
+   *        the pool, so the session gives it its share of threads by setMaxNumThreads().
+   */
+  void setThreadPool(const std::shared_ptr<exec::ThreadPool> &pool) override
+  {
+    if (pool)
+    {
+      _eigen_context = std::make_unique<nnfw::cker::eigen_support::EigenContext>(
+          std::make_unique<EigenThreadPool>(pool));
+    }
+    else
+    {
+      _eigen_context.reset();
+    }
+  }
+
+  /**
+   * @brief Use ruy, its packed weights and data prepared from constants of @c other
+   * @note  Kernels of every subgraph and execution context share them, so that constants which
+   *        execution contexts share are prepared and packed only once
+   */
+  void share(const IExternalContext &other) override
+  {
+    const auto *context = dynamic_cast<const ExternalContext *>(&other);
+    if (context != nullptr)
+      _shared = context->_shared;
+  }
+
+  /**
+   * @brief Lease a ruy context that no other kernel is using
+   * @note  ruy context is not thread-safe, but kernels can run concurrently on Parallel executor
+   *        and on execution contexts. Each kernel takes the first free ruy context, and another
+   *        context is made only if all are in use. ruy keeps packed constants in each context, so
+   *        the constants packed ahead of runs are in the first context, and a context made for
+   *        concurrent kernels packs constants again as the kernels run on it.
+   */
+  RuyContextLease leaseRuyContext() const
+  {
+    std::lock_guard<std::mutex> lock{_shared->ruy_mutex};
+    auto &in_use = _shared->ruy_contexts_in_use;
+    const size_t index = std::find(in_use.begin(), in_use.end(), false) - in_use.begin();
+    if (index == in_use.size())
+    {
+      _shared->ruy_contexts.emplace_back(new ruy::Context);
+      _shared->ruy_contexts.back()->set_max_num_threads(_shared->ruy_max_num_threads);
+      in_use.push_back(false);
+    }
+    in_use[index] = true;
+    return RuyContextLease{_shared, index};
+  }
+
+  /**
+   * @brief Reserve the memory that ruy takes to pack constant data kept on heap
+   *
+   * @param data Address of the data, which ruy looks packed data up by
+   * @param size Size of the data in bytes
+   * @return true if the data may be packed ahead of runs, false if it has to be packed on each run
+   * @note  ruy looks packed data up by the address of its source and packs the source again when
+   *        it drops the packed copy, so heap data stays alive after packing and the packed copy
+   *        doubles its memory. RUY_PREPACK_MAX_SIZE (MB, unlimited if negative) limits such
+   *        copies, trading the speed of larger weights for memory. Data reserved already is not
+   *        charged again.
+   */
+  bool reservePrepackedHeap(const void *data, size_t size)
+  {
+    auto &shared = *_shared;
+    std::lock_guard<std::mutex> lock{shared.prepack_mutex};
+    if (shared.prepacked_heap.count(data) > 0)
+      return true;
+    if (size > shared.prepack_heap_budget)
+      return false;
+    shared.prepack_heap_budget -= size;
+    shared.prepacked_heap.insert(data);
+    return true;
+  }
+
+  /**
+   * @brief Find data that a kernel prepared and added with @c key
+   *
+   * @return The data, or nullptr if no kernel has added it
+   * @note  Keys made of addresses of constants are valid, as no constant is made after
+   *        compilation and constants shared by execution contexts live while compiling.
+   */
+  template <typename T> std::shared_ptr<const T> findPrepared(const util::CompileCache::Key &key)
+  {
+    std::lock_guard<std::mutex> lock{_shared->prepared_mutex};
+    auto found = _shared->prepared.find(key.str());
+    if (found == _shared->prepared.end() || found->second.first != typeid(T))
+      return nullptr;
+    return std::static_pointer_cast<const T>(found->second.second);
+  }
+
+  /**
+   * @brief Add data prepared from constants for the kernels of other execution contexts
+   */
+  template <typename T>
+  void addPrepared(const util::CompileCache::Key &key, const std::shared_ptr<const T> &data)
+  {
+    std::lock_guard<std::mutex> lock{_shared->prepared_mutex};
+    _shared->prepared.emplace(key.str(), std::make_pair(std::type_index{typeid(T)}, data));
+  }
+
+  /**
+   * @brief Returns Eigen device on the thread pool of the session
+   * @return Eigen device, or nullptr if the session does not limit the number of threads
+   */
+  const Eigen::ThreadPoolDevice *eigen_device() const
+  {
+    return _eigen_context ? _eigen_context->device.get() : nullptr;
+  }
+
+  void setCompileCache(const std::shared_ptr<util::CompileCache> &cache) override
   {
-    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    _compile_cache = cache;
   }
 
-  void setMaxNumThreads(int max_num_threads)
+  /**
+   * @brief Returns the cache of data prepared by kernels
+   * @return The cache, or nullptr if caching is disabled
+   */
+  const std::shared_ptr<util::CompileCache> &compile_cache() const { return _compile_cache; }
+
+private:
+  void setRuyMaxNumThreads(int max_num_threads)
   {
     const int target_num_threads =
         max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    std::lock_guard<std::mutex> lock{_shared->ruy_mutex};
+    _shared->ruy_max_num_threads = target_num_threads;
+    for (auto &context : _shared->ruy_contexts)
+      context->set_max_num_threads(target_num_threads);
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+private:
+  struct SharedResources
+  {
+    SharedResources() : ruy_max_num_threads(kDefaultNumThreadpoolThreads), prepack_heap_budget(0)
+    {
+    }
+
+    std::mutex ruy_mutex;
+    std::vector<std::unique_ptr<ruy::Context>> ruy_contexts;
+    std::vector<bool> ruy_contexts_in_use;
+    int ruy_max_num_threads;
+    std::mutex prepack_mutex;
+    size_t prepack_heap_budget;
+    std::unordered_set<const void *> prepacked_heap;
+    std::mutex prepared_mutex;
+    std::unordered_map<std::string, std::pair<std::type_index, std::shared_ptr<const void>>>
+        prepared;
+  };
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  std::shared_ptr<SharedResources> _shared;
+  std::unique_ptr<nnfw::cker::eigen_support::EigenContext> _eigen_context;
+  std::shared_ptr<util::CompileCache> _compile_cache;
 };
 
+inline ExternalContext::RuyContextLease::RuyContextLease(
+    const std::shared_ptr<SharedResources> &shared, size_t index)
+    : _shared{shared}, _index{index}, _context{shared->ruy_contexts[index].get()}
+{
+}
+
+inline ExternalContext::RuyContextLease::RuyContextLease(RuyContextLease &&other)
+    : _shared{std::move(other._shared)}, _index{other._index}, _context{other._context}
+{
+  other._shared = nullptr;
+}
+
+inline ExternalContext::RuyContextLease::~RuyContextLease()
+{
+  if (!_shared)
+    return;
+  std::lock_guard<std::mutex> lock{_shared->ruy_mutex};
+  _shared->ruy_contexts_in_use[_index] = false;
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExternalContext.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+
+TEST(ExternalContext, share_thread_pool)
+{
+  auto pool = std::make_shared<exec::ThreadPool>(2);
+  ExternalContext context1;
+  ExternalContext context2;
+  context1.setMaxNumThreads(3);
+  context1.setThreadPool(pool);
+  context2.setThreadPool(pool);
+
+  ASSERT_NE(context1.eigen_device(), nullptr);
+  ASSERT_NE(context2.eigen_device(), nullptr);
+  EXPECT_EQ(context1.eigen_device()->numThreads(), 2);
+  // ruy keeps the share of threads that the session gives it apart from the pool
+  EXPECT_EQ(context1.leaseRuyContext().get()->max_num_threads(), 3);
+
+  // Work of Eigen kernels of both contexts runs on the threads of the shared pool
+  std::atomic<int> num_items{0};
+  std::atomic<int> num_items_on_pool{0};
+  for (const auto *device : {context1.eigen_device(), context2.eigen_device()})
+  {
+    device->parallelFor(64, Eigen::TensorOpCost(1e6, 1e6, 1e6),
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                          // The caller thread may also take a part
+                          if (pool->currentWorkerIndex() >= 0)
+                            num_items_on_pool += static_cast<int>(end - begin);
+                          num_items += static_cast<int>(end - begin);
+                        });
+  }
+  EXPECT_EQ(num_items, 128);
+  EXPECT_GT(num_items_on_pool, 0);
+
+  context1.setThreadPool(nullptr);
+  EXPECT_EQ(context1.eigen_device(), nullptr);
+  EXPECT_NE(context2.eigen_device(), nullptr);
+}
+
+TEST(ExternalContext, lease_ruy_context)
+{
+  ExternalContext context;
+  context.setMaxNumThreads(2);
+
+  ruy::Context *first = nullptr;
+  {
+    // Kernels running at the same time take their own contexts of the same number of threads
+    auto lease1 = context.leaseRuyContext();
+    auto lease2 = context.leaseRuyContext();
+    first = lease1.get();
+    EXPECT_NE(lease2.get(), first);
+    EXPECT_EQ(lease1.get()->max_num_threads(), 2);
+    EXPECT_EQ(lease2.get()->max_num_threads(), 2);
+  }
+
+  // The first context, which has constants packed ahead of runs, is taken first
+  auto lease = context.leaseRuyContext();
+  EXPECT_EQ(lease.get(), first);
+
+  context.setMaxNumThreads(3);
+  EXPECT_EQ(lease.get()->max_num_threads(), 3);
+  EXPECT_EQ(context.leaseRuyContext().get()->max_num_threads(), 3);
+}
+
+TEST(ExternalContext, reserve_prepacked_heap)
+{
+  static const char data[4] = {};
+
+  // RUY_PREPACK_MAX_SIZE is 64MB by default
+  ExternalContext context;
+  EXPECT_TRUE(context.reservePrepackedHeap(&data[0], 60 << 20));
+  EXPECT_FALSE(context.reservePrepackedHeap(&data[1], 8 << 20));
+  EXPECT_TRUE(context.reservePrepackedHeap(&data[2], 4 << 20));
+  EXPECT_FALSE(context.reservePrepackedHeap(&data[3], 1));
+
+  // Data reserved already is not charged again
+  EXPECT_TRUE(context.reservePrepackedHeap(&data[0], 60 << 20));
+}
+
+TEST(ExternalContext, share_prepared)
+{
+  static const char data[2] = {};
+
+  ExternalContext context1;
+  ExternalContext context2;
+  ExternalContext context3;
+  context2.share(context1);
+
+  // Contexts sharing ruy take one budget, and charge data that both reserve only once
+  ruy::Context *ruy_context = context1.leaseRuyContext().get();
+  EXPECT_EQ(context2.leaseRuyContext().get(), ruy_context);
+  EXPECT_NE(context3.leaseRuyContext().get(), ruy_context);
+  EXPECT_TRUE(context1.reservePrepackedHeap(&data[0], 60 << 20));
+  EXPECT_TRUE(context2.reservePrepackedHeap(&data[0], 60 << 20));
+  EXPECT_FALSE(context2.reservePrepackedHeap(&data[1], 8 << 20));
+  EXPECT_TRUE(context3.reservePrepackedHeap(&data[1], 8 << 20));
+
+  util::CompileCache::Key key;
+  key.append(std::string{"prepared"});
+  auto prepared = std::make_shared<const int>(42);
+  context1.addPrepared<int>(key, prepared);
+  EXPECT_EQ(context2.findPrepared<int>(key), prepared);
+  EXPECT_EQ(context2.findPrepared<float>(key), nullptr);
+  EXPECT_EQ(context3.findPrepared<int>(key), nullptr);
+}
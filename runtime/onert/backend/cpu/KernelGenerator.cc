@@ -18,6 +18,8 @@
 
 #include "ops/ArgMinMaxLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
 #include "ops/ConcatLayer.h"
@@ -55,6 +57,7 @@
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
@@ -64,6 +67,14 @@
 #include "ops/FusedBatchNormLayer.h"
 #include "ops/LogSoftMaxLayer.h"
 #include "ops/StatelessRandomUniformLayer.h"
+#include "ops/LSTMLayer.h"
+#include "ops/RNNLayer.h"
+#include "ops/InstanceNormLayer.h"
+#include "ops/PReLULayer.h"
+#include "ops/DepthToSpaceLayer.h"
+#include "ops/ResizeNearestNeighborLayer.h"
+#include "ops/TopKV2Layer.h"
+#include "ops/LocalResponseNormalizationLayer.h"
 
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
@@ -288,7 +299,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor);
+                  activation, ofm_tensor, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -306,7 +317,8 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
-                dilation.width_factor, dilation.height_factor, activation, ofm_tensor);
+                dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -341,7 +353,40 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, padding.left, padding.right, padding.top,
                 padding.bottom, stride.horizontal, stride.vertical, multiplier, activation,
-                ofm_tensor);
+                ofm_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_op_seq_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_op_seq_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  const auto stride = node.param().stride;
+  // Padding of transpose convolution is that of the convolution from ofm to ifm
+  const auto padding = ir::calculatePadding(node.param().padding, ofm_shape, ifm_shape, stride,
+                                            ker_width, ker_height);
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  const auto padding_type = node.param().padding.type;
+  fn->configure(ifm_tensor, ker_tensor, padding_type, padding.left, padding.right, padding.top,
+                padding.bottom, stride.horizontal, stride.vertical, ofm_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -432,6 +477,62 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto weights_scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto weights_binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto weights_clusters_index{
+      node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+  const auto weights_hidden_size = node.param().weights_hidden_size;
+  const auto activation = node.param().activation;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto weights_scales_tensor = _tensor_reg->getPortableTensor(weights_scales_index);
+  auto weights_binary_tensor = _tensor_reg->getPortableTensor(weights_binary_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+  auto weights_clusters_tensor = _tensor_reg->getPortableTensor(weights_clusters_index);
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, weights_scales_tensor, weights_binary_tensor, bias_tensor,
+                weights_clusters_tensor, weights_hidden_size, activation, output_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto input_binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto input_clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+  const auto input_hidden_size = node.param().input_hidden_size;
+  const auto axis = node.param().axis;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_scales_tensor = _tensor_reg->getPortableTensor(input_scales_index);
+  auto input_binary_tensor = _tensor_reg->getPortableTensor(input_binary_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_clusters_tensor = _tensor_reg->getPortableTensor(input_clusters_index);
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(input_scales_tensor, input_binary_tensor, indices_tensor, input_clusters_tensor,
+                input_hidden_size, axis, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reshape &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -603,7 +704,7 @@ void KernelGenerator::visit(const ir::operation::Einsum &node)
 
   auto fn = std::make_unique<ops::EinsumLayer>();
 
-  fn->configure(input_tensors, equation, output_tensor);
+  fn->configure(input_tensors, equation, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1153,7 +1254,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -1286,6 +1387,234 @@ void KernelGenerator::visit(const ir::operation::SplitV &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::LSTM &node)
+{
+  using ir::operation::LSTM;
+  using Gate = ops::LSTMLayer::Gate;
+
+  // Optional inputs which are omitted have no elements
+  auto optional_tensor = [&](LSTM::Input input) -> IPortableTensor * {
+    const auto index{node.getInputs().at(input)};
+    if (index.undefined())
+      return nullptr;
+    const auto &shape = _ctx.at(index).shape();
+    if (shape.rank() == 0 || shape.dim(0) == 0)
+      return nullptr;
+    return _tensor_reg->getPortableTensor(index);
+  };
+
+  ops::LSTMLayer::GateTensors input_weights{};
+  input_weights[Gate::INPUT_GATE] = optional_tensor(LSTM::Input::INPUT_TO_INPUT_WEIGHTS);
+  input_weights[Gate::FORGET_GATE] = optional_tensor(LSTM::Input::INPUT_TO_FORGET_WEIGHTS);
+  input_weights[Gate::CELL_GATE] = optional_tensor(LSTM::Input::INPUT_TO_CELL_WEIGHTS);
+  input_weights[Gate::OUTPUT_GATE] = optional_tensor(LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS);
+
+  ops::LSTMLayer::GateTensors recurrent_weights{};
+  recurrent_weights[Gate::INPUT_GATE] = optional_tensor(LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS);
+  recurrent_weights[Gate::FORGET_GATE] = optional_tensor(LSTM::Input::RECURRENT_TO_FORGET_WEIGHTS);
+  recurrent_weights[Gate::CELL_GATE] = optional_tensor(LSTM::Input::RECURRENT_TO_CELL_WEIGHTS);
+  recurrent_weights[Gate::OUTPUT_GATE] = optional_tensor(LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS);
+
+  ops::LSTMLayer::GateTensors cell_weights{};
+  cell_weights[Gate::INPUT_GATE] = optional_tensor(LSTM::Input::CELL_TO_INPUT_WEIGHTS);
+  cell_weights[Gate::FORGET_GATE] = optional_tensor(LSTM::Input::CELL_TO_FORGET_WEIGHTS);
+  cell_weights[Gate::OUTPUT_GATE] = optional_tensor(LSTM::Input::CELL_TO_OUTPUT_WEIGHTS);
+
+  ops::LSTMLayer::GateTensors biases{};
+  biases[Gate::INPUT_GATE] = optional_tensor(LSTM::Input::INPUT_GATE_BIAS);
+  biases[Gate::FORGET_GATE] = optional_tensor(LSTM::Input::FORGET_GATE_BIAS);
+  biases[Gate::CELL_GATE] = optional_tensor(LSTM::Input::CELL_BIAS);
+  biases[Gate::OUTPUT_GATE] = optional_tensor(LSTM::Input::OUTPUT_GATE_BIAS);
+
+  // NOTE The input gate exists only if both of its weights exist, otherwise it is CIFG
+  if (input_weights[Gate::INPUT_GATE] == nullptr || recurrent_weights[Gate::INPUT_GATE] == nullptr)
+  {
+    input_weights[Gate::INPUT_GATE] = nullptr;
+    recurrent_weights[Gate::INPUT_GATE] = nullptr;
+    cell_weights[Gate::INPUT_GATE] = nullptr;
+    biases[Gate::INPUT_GATE] = nullptr;
+  }
+
+  auto projection_weights = optional_tensor(LSTM::Input::PROJECTION_WEIGHTS);
+  auto projection_bias = optional_tensor(LSTM::Input::PROJECTION_BIAS);
+  auto input = _tensor_reg->getPortableTensor(node.getInputs().at(LSTM::Input::INPUT));
+  auto output_state_in =
+      _tensor_reg->getPortableTensor(node.getInputs().at(LSTM::Input::OUTPUT_STATE_IN));
+  auto cell_state_in =
+      _tensor_reg->getPortableTensor(node.getInputs().at(LSTM::Input::CELL_STATE_IN));
+  auto output_state_out =
+      _tensor_reg->getPortableTensor(node.getOutputs().at(LSTM::Output::OUTPUT_STATE_OUT));
+  auto cell_state_out =
+      _tensor_reg->getPortableTensor(node.getOutputs().at(LSTM::Output::CELL_STATE_OUT));
+  auto output = _tensor_reg->getPortableTensor(node.getOutputs().at(LSTM::Output::OUTPUT));
+
+  auto fn = std::make_unique<ops::LSTMLayer>();
+
+  fn->configure(input, input_weights, recurrent_weights, cell_weights, biases, projection_weights,
+                projection_bias, output_state_in, cell_state_in, node.param().activation,
+                node.param().cell_threshold, node.param().projection_threshold, output_state_out,
+                cell_state_out, output, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  using ir::operation::RNN;
+
+  const auto output_index{node.getOutputs().at(RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{node.getOutputs().at(RNN::Output::HIDDEN_STATE_OUT)};
+  const auto input_index{node.getInputs().at(RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{node.getInputs().at(RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(RNN::Input::HIDDEN_STATE_IN)};
+  const auto activation = node.param().activation;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto hidden_state_out_tensor = _tensor_reg->getPortableTensor(hidden_state_out_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto weights_tensor = _tensor_reg->getPortableTensor(weights_index);
+  auto recurrent_weights_tensor = _tensor_reg->getPortableTensor(recurrent_weights_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+  auto hidden_state_in_tensor = _tensor_reg->getPortableTensor(hidden_state_in_index);
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  fn->configure(input_tensor, weights_tensor, recurrent_weights_tensor, bias_tensor,
+                hidden_state_in_tensor, activation, output_tensor, hidden_state_out_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::InstanceNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::InstanceNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::InstanceNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::InstanceNorm::Input::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::InstanceNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, node.param().epsilon,
+                node.param().activation, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::PReLU &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::PReLU::Input::INPUT)};
+  const auto alpha_index{node.getInputs().at(ir::operation::PReLU::Input::ALPHA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto alpha_tensor = _tensor_reg->getPortableTensor(alpha_index);
+
+  auto fn = std::make_unique<ops::PReLULayer>();
+
+  fn->configure(input_tensor, alpha_tensor, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::DepthToSpace &node)
+{
+  const auto input_index{node.getInputs().at(ir::operation::DepthToSpace::Input::INPUT)};
+  const auto output_index{node.getOutputs().at(0)};
+  auto block_size = node.param().block_size;
+
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+
+  auto fn = std::make_unique<ops::DepthToSpaceLayer>();
+
+  fn->configure(input_tensor, block_size, output_tensor);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::INPUT)};
+
+  auto align_corners = node.param().align_corners;
+  auto half_pixel_centers = node.param().half_pixel_centers;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::ResizeNearestNeighborLayer>();
+
+  if (node.getInputs().size() == 1)
+  {
+    fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
+                  align_corners, half_pixel_centers);
+  }
+  else
+  {
+    assert(node.getInputs().size() == 2);
+    const auto size_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::SIZE)};
+    auto size_tensor = _tensor_reg->getPortableTensor(size_index);
+    if (size_tensor->is_constant())
+    {
+      auto size_vec = _ctx.at(size_index).asVector<int32_t>();
+      const auto height_out = size_vec[0];
+      const auto width_out = size_vec[1];
+      fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
+                    half_pixel_centers);
+    }
+    else
+    {
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+    }
+  }
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TopKV2 &node)
+{
+  const auto values_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES)};
+  const auto indices_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES)};
+  const auto input_index{node.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::TopKV2Layer>();
+
+  fn->configure(input_tensor, node.param().k, values_tensor, indices_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::LocalResponseNormalization &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{
+      node.getInputs().at(ir::operation::LocalResponseNormalization::Input::INPUT)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  const auto &param = node.param();
+
+  auto fn = std::make_unique<ops::LocalResponseNormalizationLayer>();
+
+  fn->configure(input_tensor, param.radius, param.bias, param.alpha, param.beta, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
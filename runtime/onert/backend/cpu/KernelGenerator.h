@@ -48,6 +48,7 @@ public:
   void visit(const ir::OpSequence &) override;
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Concat &) override;
   void visit(const ir::operation::Fill &) override;
   void visit(const ir::operation::FullyConnected &) override;
@@ -56,6 +57,8 @@ public:
   void visit(const ir::operation::Softmax &) override;
   void visit(const ir::operation::Comparison &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
+  void visit(const ir::operation::BCQFullyConnected &) override;
+  void visit(const ir::operation::BCQGather &) override;
   void visit(const ir::operation::Einsum &) override;
   void visit(const ir::operation::Gather &) override;
   void visit(const ir::operation::Custom &node) override;
@@ -94,6 +97,14 @@ public:
   void visit(const ir::operation::SpaceToDepth &) override;
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::SplitV &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
+  void visit(const ir::operation::InstanceNorm &) override;
+  void visit(const ir::operation::PReLU &) override;
+  void visit(const ir::operation::DepthToSpace &) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &) override;
+  void visit(const ir::operation::TopKV2 &) override;
+  void visit(const ir::operation::LocalResponseNormalization &) override;
 
 private:
   const ir::Operands &_ctx;
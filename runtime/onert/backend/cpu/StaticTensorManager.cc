@@ -96,6 +96,14 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
     _nonconst_mgr->releasePlan(ind);
 }
 
+void StaticTensorManager::hintInPlace(const ir::OperandIndex &ind,
+                                      const ir::OperandIndex &input_ind)
+{
+  // Constant tensors are not planned by the memory manager
+  if (!_as_constants[ind] && !_as_constants[input_ind])
+    _nonconst_mgr->hintInPlace(ind, input_ind);
+}
+
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
 {
   for (const auto &it : _tensors->native_tensors())
@@ -47,6 +47,8 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  void hintInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &input_ind);
+  uint32_t nonconstCapacity() const { return _nonconst_mgr->capacity(); }
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
@@ -91,11 +91,26 @@ public:
     --_num_references;
     if (_num_references == 0)
     {
-      _data.reset();
-      _buffer = nullptr;
+      releaseData();
     }
   }
 
+  /**
+   * @brief Decrease reference like decrease_ref(), for a user that still refers to the address of
+   *        data without reading it, e.g. as a key of ruy's cache of packed matrices
+   * @note  Once nothing reads data, data mapped from a file is paged out while its address stays
+   *        reserved. Data on heap is kept as it is for the lifetime of this tensor, since freeing
+   *        it would let a later allocation at the same address hit a stale packing, and ruy packs
+   *        the source again once it evicts a packing. So heap weights packed by ruy take memory
+   *        twice, which ExternalContext::reservePrepackedHeap() bounds. Set USE_MMAPED_DATA to
+   *        reclaim the memory of such weights.
+   */
+  void decrease_ref_keeping_address()
+  {
+    _keep_address = true;
+    decrease_ref();
+  }
+
   /**
    * @brief Reset reference count to zero and release data
    */
@@ -105,14 +120,36 @@ public:
     assert(_num_references > 0);
     _num_references = 0;
 
-    _data.reset();
-    _buffer = nullptr;
+    releaseData();
   }
 
   int32_t num_references() override { return _num_references; }
 
+  /**
+   * @brief Whether data is mapped from a file rather than kept on heap
+   */
+  bool is_mmaped() const { return dynamic_cast<const ir::MMapedData *>(_data.get()) != nullptr; }
+
+private:
+  void releaseData()
+  {
+    if (!_keep_address)
+    {
+      _data.reset();
+      _buffer = nullptr;
+      return;
+    }
+
+    auto mmaped_data = dynamic_cast<const ir::MMapedData *>(_data.get());
+    if (mmaped_data)
+    {
+      mmaped_data->releaseResidentPages();
+    }
+  }
+
 private:
   std::shared_ptr<const ir::Data> _data;
+  bool _keep_address = false;
 };
 
 } // namespace cpu
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tensor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <unistd.h>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+
+namespace
+{
+
+std::unique_ptr<ExternalTensor> createExternalTensor(const std::shared_ptr<ir::Data> &data)
+{
+  auto info = ir::OperandInfo::createStaticInfo(
+      ir::Shape{static_cast<int32_t>(data->size() / sizeof(float))},
+      ir::TypeInfo{ir::DataType::FLOAT32});
+  info.setAsConstant();
+  auto tensor = std::make_unique<ExternalTensor>(info, ir::Layout::NHWC);
+  tensor->setData(data);
+  return tensor;
+}
+
+} // namespace
+
+TEST(ExternalTensor, release_heap_data_on_last_reference)
+{
+  const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+  std::weak_ptr<ir::Data> weak_data;
+  std::unique_ptr<ExternalTensor> tensor;
+  {
+    auto data = std::make_shared<ir::CachedData>(reinterpret_cast<const uint8_t *>(values.data()),
+                                                 values.size() * sizeof(float));
+    weak_data = data;
+    tensor = createExternalTensor(data);
+  }
+  EXPECT_FALSE(tensor->is_mmaped());
+
+  tensor->increase_ref();
+  tensor->increase_ref();
+  EXPECT_EQ(tensor->num_references(), 2);
+
+  tensor->decrease_ref();
+  EXPECT_EQ(tensor->num_references(), 1);
+  EXPECT_NE(tensor->buffer(), nullptr);
+  EXPECT_FALSE(weak_data.expired());
+
+  tensor->decrease_ref();
+  EXPECT_EQ(tensor->num_references(), 0);
+  EXPECT_EQ(tensor->buffer(), nullptr);
+  EXPECT_TRUE(weak_data.expired());
+}
+
+TEST(ExternalTensor, reset_ref)
+{
+  const std::vector<float> values{1.f, 2.f};
+  auto tensor = createExternalTensor(std::make_shared<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+
+  tensor->increase_ref();
+  tensor->increase_ref();
+  tensor->reset_ref();
+  EXPECT_EQ(tensor->num_references(), 0);
+  EXPECT_EQ(tensor->buffer(), nullptr);
+}
+
+TEST(ExternalTensor, keep_address_of_heap_data)
+{
+  const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+  auto tensor = createExternalTensor(std::make_shared<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+  const auto buffer = tensor->buffer();
+
+  tensor->increase_ref();
+  tensor->decrease_ref_keeping_address();
+  EXPECT_EQ(tensor->num_references(), 0);
+
+  // Heap data is kept as it is, since it cannot be released without freeing its address
+  ASSERT_EQ(tensor->buffer(), buffer);
+  const auto data = reinterpret_cast<const float *>(tensor->buffer());
+  EXPECT_EQ(std::vector<float>(data, data + values.size()), values);
+}
+
+TEST(ExternalTensor, keep_address_of_mmaped_data)
+{
+  const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(fwrite(values.data(), sizeof(float), values.size(), file), values.size());
+  ASSERT_EQ(fflush(file), 0);
+
+  const size_t size = values.size() * sizeof(float);
+  auto tensor = createExternalTensor(
+      std::make_shared<ir::MMapedData>(fileno(file), 0, size, 0, size));
+  EXPECT_TRUE(tensor->is_mmaped());
+  const auto buffer = tensor->buffer();
+
+  tensor->increase_ref();
+  tensor->increase_ref();
+  tensor->decrease_ref_keeping_address();
+  tensor->decrease_ref_keeping_address();
+  EXPECT_EQ(tensor->num_references(), 0);
+
+  // Pages dropped from memory are read from the file again at the same address
+  ASSERT_EQ(tensor->buffer(), buffer);
+  const auto data = reinterpret_cast<const float *>(tensor->buffer());
+  EXPECT_EQ(std::vector<float>(data, data + values.size()), values);
+
+  fclose(file);
+}
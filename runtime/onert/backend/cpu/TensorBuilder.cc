@@ -72,6 +72,15 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::notifyInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &input_ind)
+{
+  if (!_tensor_reg->getNativeTensor(ind)->is_dynamic() &&
+      !_tensor_reg->getNativeTensor(input_ind)->is_dynamic())
+  {
+    _static_tensor_mgr->hintInPlace(ind, input_ind);
+  }
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 {
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
@@ -51,6 +51,7 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &) override;
   void notifyLastUse(const ir::OperandIndex &) override;
+  void notifyInPlace(const ir::OperandIndex &, const ir::OperandIndex &) override;
 
   bool isRegistered(const ir::OperandIndex &) const override;
 
@@ -60,6 +61,12 @@ public:
 
   IDynamicTensorManager *dynamicTensorManager(void) override { return _dynamic_tensor_mgr.get(); }
 
+  /**
+   * @brief Get the peak size of the arena planned for non-constant tensors
+   * @return The peak arena size in bytes
+   */
+  uint32_t nonconstCapacity() const { return _static_tensor_mgr->nonconstCapacity(); }
+
 private:
   const std::shared_ptr<cpu_common::TensorRegistry> _tensor_reg;
   std::unique_ptr<cpu_common::DynamicTensorManager> _dynamic_tensor_mgr;
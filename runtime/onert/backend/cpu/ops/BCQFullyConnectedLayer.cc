@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQFullyConnectedLayer.h"
+
+#include <cker/operation/BCQFullyConnected.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQFullyConnectedLayer::BCQFullyConnectedLayer()
+    : _input(nullptr), _weights_scales(nullptr), _weights_binary(nullptr), _bias(nullptr),
+      _weights_clusters(nullptr), _output(nullptr), _weights_hidden_size(0),
+      _activation(ir::Activation::NONE), _kernel(new nnfw::cker::BCQFullyConnected()),
+      _external_context(nullptr), _prepare(false)
+{
+  // DO NOTHING
+}
+
+BCQFullyConnectedLayer::~BCQFullyConnectedLayer() = default;
+
+void BCQFullyConnectedLayer::bcqFullyConnectedFloat32()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+  op_params.activation = convertActivationType(_activation);
+
+  (*_kernel)(op_params, reinterpret_cast<const float *>(_weights_scales->buffer()),
+             reinterpret_cast<const int32_t *>(_weights_binary->buffer()), getTensorShape(_input),
+             reinterpret_cast<const float *>(_input->buffer()),
+             reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+             getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+             _external_context->eigen_device());
+}
+
+void BCQFullyConnectedLayer::configure(const IPortableTensor *input,
+                                       const IPortableTensor *weights_scales,
+                                       const IPortableTensor *weights_binary,
+                                       const IPortableTensor *bias,
+                                       const IPortableTensor *weights_clusters,
+                                       uint32_t weights_hidden_size, ir::Activation activation,
+                                       IPortableTensor *output,
+                                       const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(weights_scales != nullptr);
+  assert(weights_binary != nullptr);
+  assert(weights_clusters != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _weights_scales = weights_scales;
+  _weights_binary = weights_binary;
+  _bias = bias;
+  _weights_clusters = weights_clusters;
+  _weights_hidden_size = weights_hidden_size;
+  _activation = activation;
+  _output = output;
+  _external_context = external_context;
+}
+
+void BCQFullyConnectedLayer::run()
+{
+  if (!_weights_clusters->is_constant())
+  {
+    prepareLayout();
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    bcqFullyConnectedFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"BCQFullyConnected: unsupported data type"};
+  }
+}
+
+void BCQFullyConnectedLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  if (_weights_clusters->is_constant())
+  {
+    prepareLayout();
+  }
+  _prepare = true;
+}
+
+void BCQFullyConnectedLayer::prepareLayout()
+{
+  const auto clusters_shape = getTensorShape(_weights_clusters);
+  _kernel->prepare(reinterpret_cast<const int32_t *>(_weights_clusters->buffer()),
+                   clusters_shape.FlatSize() / 2, _weights_hidden_size);
+
+  const auto &layout = _kernel->layout();
+  if (getTensorShape(_weights_scales).FlatSize() != layout.num_planes() ||
+      getTensorShape(_weights_binary).FlatSize() != layout.num_planes() * layout.words_per_plane())
+    throw std::runtime_error{"BCQFullyConnected: weights do not match clusters"};
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQGatherLayer.h"
+
+#include <cker/operation/BCQGather.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQGatherLayer::BCQGatherLayer()
+    : _input_scales(nullptr), _input_binary(nullptr), _indices(nullptr), _input_clusters(nullptr),
+      _output(nullptr), _input_hidden_size(0), _axis(0), _kernel(new nnfw::cker::BCQGather()),
+      _prepare(false)
+{
+  // DO NOTHING
+}
+
+BCQGatherLayer::~BCQGatherLayer() = default;
+
+void BCQGatherLayer::configure(const IPortableTensor *input_scales,
+                               const IPortableTensor *input_binary, const IPortableTensor *indices,
+                               const IPortableTensor *input_clusters, uint32_t input_hidden_size,
+                               int32_t axis, IPortableTensor *output)
+{
+  assert(input_scales != nullptr);
+  assert(input_binary != nullptr);
+  assert(indices != nullptr);
+  assert(input_clusters != nullptr);
+  assert(output != nullptr);
+
+  if (axis != 0 && axis != 1)
+    throw std::runtime_error{"BCQGather: unsupported axis"};
+
+  _input_scales = input_scales;
+  _input_binary = input_binary;
+  _indices = indices;
+  _input_clusters = input_clusters;
+  _input_hidden_size = input_hidden_size;
+  _axis = axis;
+  _output = output;
+}
+
+template <typename IndexT> void BCQGatherLayer::bcqGatherFloat32()
+{
+  (*_kernel)(_axis, reinterpret_cast<const float *>(_input_scales->buffer()),
+             reinterpret_cast<const int32_t *>(_input_binary->buffer()), getTensorShape(_indices),
+             reinterpret_cast<const IndexT *>(_indices->buffer()), getTensorShape(_output),
+             reinterpret_cast<float *>(_output->buffer()));
+}
+
+void BCQGatherLayer::run()
+{
+  if (!_input_clusters->is_constant())
+  {
+    prepareLayout();
+  }
+
+  if (_output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQGather: unsupported data type"};
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      bcqGatherFloat32<int32_t>();
+      break;
+    case OperandType::INT64:
+      bcqGatherFloat32<int64_t>();
+      break;
+    default:
+      throw std::runtime_error{"BCQGather: unsupported indices data type"};
+  }
+}
+
+void BCQGatherLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  if (_input_clusters->is_constant())
+  {
+    prepareLayout();
+  }
+  _prepare = true;
+}
+
+void BCQGatherLayer::prepareLayout()
+{
+  const auto clusters_shape = getTensorShape(_input_clusters);
+  _kernel->prepare(reinterpret_cast<const int32_t *>(_input_clusters->buffer()),
+                   clusters_shape.FlatSize() / 2, _input_hidden_size);
+
+  const auto &layout = _kernel->layout();
+  if (getTensorShape(_input_scales).FlatSize() != layout.num_planes() ||
+      getTensorShape(_input_binary).FlatSize() != layout.num_planes() * layout.words_per_plane())
+    throw std::runtime_error{"BCQGather: input does not match clusters"};
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -29,7 +29,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
     : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-      _kernel(new nnfw::cker::BatchMatMul())
+      _kernel(new nnfw::cker::BatchMatMul()), _external_context(nullptr), _prepare(false)
 {
   // DO NOTHING
 }
@@ -43,16 +43,21 @@ void BatchMatMulLayer::batchMatMulFloat32()
   nnfw::cker::Shape rhs_shape = getTensorShape(_rhs);
   nnfw::cker::Shape output_shape = getTensorShape(_output);
 
-  // TODO implement for constant input
+  if (_lhs->is_dynamic() || _rhs->is_dynamic())
+  {
+    batchmatmul_kernel.prepare(lhs_shape, rhs_shape);
+  }
 
-  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
+  const auto ruy_context = _external_context->leaseRuyContext();
   batchmatmul_kernel(lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), rhs_shape,
                      reinterpret_cast<const float *>(_rhs->buffer()), _adj_x, _adj_y, output_shape,
-                     reinterpret_cast<float *>(_output->buffer()));
+                     reinterpret_cast<float *>(_output->buffer()),
+                     ruy_context.get());
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -63,10 +68,13 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
 }
 
 void BatchMatMulLayer::run()
 {
+  prepare();
+
   if (_lhs->data_type() == OperandType::FLOAT32)
   {
     batchMatMulFloat32();
@@ -77,6 +85,31 @@ void BatchMatMulLayer::run()
   }
 }
 
+void BatchMatMulLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  // Batches of dynamic tensors are broadcast on every run
+  if (!_lhs->is_dynamic() && !_rhs->is_dynamic())
+  {
+    _kernel->prepare(getTensorShape(_lhs), getTensorShape(_rhs));
+  }
+
+  // Constant rhs, which is usually weights, is packed by ruy only once
+  if (_rhs->is_constant() && _rhs->data_type() == OperandType::FLOAT32)
+  {
+    const auto ruy_context = _external_context->leaseRuyContext();
+    if (canPrepack(_rhs, *_external_context))
+    {
+      _kernel->prepackRhs(getTensorShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
+                          _adj_y, ruy_context.get());
+      releaseConsumedConstant(_rhs, /*keep_address=*/true);
+    }
+  }
+  _prepare = true;
+}
+
 #undef AVGPOOLING_PARAMETERS
 
 } // namespace ops
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_BATCH_MATMUL_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -49,10 +50,12 @@ public:
   void batchMatMulFloat32();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+  void prepare() override;
+
 private:
   const IPortableTensor *_lhs;
   const IPortableTensor *_rhs;
@@ -62,6 +65,9 @@ private:
   bool _adj_y;
 
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  bool _prepare;
 };
 
 } // namespace ops
@@ -19,6 +19,8 @@
 #include "../Tensor.h"
 #include "ir/Padding.h"
 #include <cker/operation/Conv.h>
+#include <cker/operation/FullyConnectedSparse.h>
+#include <util/ConfigSource.h>
 
 namespace onert
 {
@@ -32,8 +34,11 @@ ConvolutionLayer::ConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
       _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
       _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
-      _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-      _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+      _dilationHeightFactor(1), _activation(ir::Activation::NONE), _output_multiplier(0),
+      _output_shift(0), _output_activation_min(0), _output_activation_max(0),
+      _per_channel_output_multiplier(), _per_channel_output_shift(), _cached_filter(),
+      _conv_kernel(new nnfw::cker::Conv()), _external_context(nullptr), _prepare(false),
+      _is_kernel_prepacked(false)
 {
   // DO NOTHING
 }
@@ -57,6 +62,7 @@ void ConvolutionLayer::convFloat32()
   op_params.float_activation_max = output_activation_max;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
+  kernel.setEigenDevice(_external_context->eigen_device());
   kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
          getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
          getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
@@ -65,17 +71,6 @@ void ConvolutionLayer::convFloat32()
 
 void ConvolutionLayer::convQuant8()
 {
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-
   nnfw::cker::ConvParams op_params;
   op_params.stride_width = _strideWidth;
   op_params.stride_height = _strideHeight;
@@ -87,10 +82,10 @@ void ConvolutionLayer::convQuant8()
   op_params.input_offset = -_input->data_offset();
   op_params.weights_offset = -_kernel->data_offset();
   op_params.output_offset = _output->data_offset();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
   op_params.is_replaced_weights = true;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
@@ -100,6 +95,69 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
+  op_params.lhs_cacheable = _is_kernel_prepacked;
+
+  const auto ruy_context = _external_context->leaseRuyContext();
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+         ruy_context.get());
+}
+
+void ConvolutionLayer::convSparseWeight()
+{
+  // Pointwise convolution is FullyConnected of pixels, which is the only sparse case supported
+  const auto kernel_shape = getTensorShape(_kernel);
+  if (kernel_shape.Dims(1) != 1 || kernel_shape.Dims(2) != 1 || _strideWidth != 1 ||
+      _strideHeight != 1 || _paddingLeft != 0 || _paddingRight != 0 || _paddingTop != 0 ||
+      _paddingBottom != 0)
+  {
+    throw std::runtime_error{"Conv: unsupported sparsity"};
+  }
+
+  const auto sparsity = _kernel->sparsity();
+  const auto &block_size = sparsity->block_size();
+  const int block_rows = block_size.empty() ? 1 : block_size[0];
+  const int block_cols = block_size.empty() ? 1 : block_size[1];
+  const int output_depth = kernel_shape.Dims(0);
+  const int input_depth = kernel_shape.Dims(3);
+  if (output_depth % block_rows != 0 || input_depth % block_cols != 0)
+    throw std::runtime_error{"Conv: unsupported sparsity"};
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  const int num_pixels = getTensorShape(_input).FlatSize() / input_depth;
+  nnfw::cker::FullyConnectedSparseWeight(
+      op_params, nnfw::cker::Shape{num_pixels, input_depth},
+      reinterpret_cast<const float *>(_input->buffer()),
+      nnfw::cker::Shape{output_depth, input_depth},
+      reinterpret_cast<const float *>(_kernel->buffer()), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias->buffer()),
+      nnfw::cker::Shape{num_pixels, output_depth}, reinterpret_cast<float *>(_output->buffer()),
+      sparsity->w1_segments(), sparsity->w1_indices(), block_rows, block_cols,
+      _external_context->eigen_device());
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -107,7 +165,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t strideWidth, const uint32_t strideHeight,
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
-                                 const ir::Activation activation, IPortableTensor *output)
+                                 const ir::Activation activation, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -123,6 +182,7 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _dilationHeightFactor = dilationHeightFactor;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
 }
 
 void ConvolutionLayer::run()
@@ -158,7 +218,11 @@ void ConvolutionLayer::run()
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
   }
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_kernel->sparsity())
+  {
+    convSparseWeight();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -166,6 +230,10 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    convQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -178,28 +246,128 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  kernel.setWinogradEnabled(util::getConfigBool(util::config::USE_WINOGRAD));
+  // Sparse filter is used as it is
+  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant() &&
+      !_kernel->sparsity())
   {
+    const auto filter_shape = getTensorShape(_kernel);
+    const auto output_shape = getTensorShape(_output);
+    const auto *filter_data = reinterpret_cast<const float *>(_kernel->buffer());
+    const auto padding_type = getPaddingType(_paddingType);
+
+    // The prepared filter is derived from the filter and everything that selects the algorithm
+    auto append_params = [&](util::CompileCache::Key &key) {
+      key.append(std::string{"cpu.Conv.filter"})
+          .append(util::getConfigBool(util::config::USE_WINOGRAD))
+          .append(filter_shape.DimsData(), filter_shape.DimensionsCount() * sizeof(int32_t))
+          .append(output_shape.DimsData(), output_shape.DimensionsCount() * sizeof(int32_t))
+          .append(padding_type)
+          .append(_strideWidth)
+          .append(_strideHeight)
+          .append(_dilationWidthFactor)
+          .append(_dilationHeightFactor);
+    };
+
+    // Kernels of every execution context share the filter prepared from the same constant
+    util::CompileCache::Key shared_key;
+    append_params(shared_key.append(filter_data));
+    _cached_filter = _external_context->findPrepared<ir::Data>(shared_key);
+    const bool is_shared = _cached_filter != nullptr;
+
+    const auto cache = _external_context->compile_cache();
+    util::CompileCache::Key key;
+    if (cache && !is_shared)
+    {
+      key = cache->constantKey(filter_data, filter_shape.FlatSize() * sizeof(float));
+      append_params(key);
+      _cached_filter = cache->load(key);
+    }
+
     bool is_transposed = false;
-    kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-                   getPaddingType(_paddingType), is_transposed, _dilationWidthFactor,
-                   _dilationHeightFactor);
+    if (_cached_filter &&
+        kernel.prepareWithFilter(filter_shape,
+                                 reinterpret_cast<const float *>(_cached_filter->base()),
+                                 _cached_filter->size() / sizeof(float), output_shape,
+                                 padding_type, _strideWidth, _strideHeight, _dilationWidthFactor,
+                                 _dilationHeightFactor))
+    {
+      is_transposed = true;
+    }
+    else
+    {
+      _cached_filter.reset();
+      kernel.prepare(filter_shape, filter_data, output_shape, padding_type, _strideWidth,
+                     _strideHeight, _dilationWidthFactor, _dilationHeightFactor, is_transposed);
+
+      size_t prepared_size = 0;
+      const float *prepared = kernel.preparedFilter(prepared_size);
+      if (prepared)
+      {
+        const auto prepared_base = reinterpret_cast<const uint8_t *>(prepared);
+        const auto prepared_bytes = prepared_size * sizeof(float);
+        if (cache)
+          cache->store(key, prepared_base, prepared_bytes);
+        // The filter is owned by this kernel, which the shared data keeps alive
+        _cached_filter = std::shared_ptr<const ir::Data>(
+            new ir::ExternalData(prepared_base, prepared_bytes),
+            [owner = _conv_kernel](const ir::Data *data) { delete data; });
+      }
+    }
+    if (_cached_filter && !is_shared)
+      _external_context->addPrepared<ir::Data>(shared_key, _cached_filter);
 
-    // Decrease reference of _kernel(weights) only when _kernel is constant
+    // The filter is not read any longer once it is transposed
     if (is_transposed)
     {
-      auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
-      if (kernel_tensor)
-        // TODO Remove const_cast
-        const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+      releaseConsumedConstant(_kernel);
     }
   }
-  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM && _kernel->is_constant() &&
-           !_input->is_dynamic() && !_output->is_dynamic())
+  else if ((_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
+            _input->data_type() == OperandType::QUANT_INT8_SYMM) &&
+           _kernel->is_constant() && !_input->is_dynamic() && !_output->is_dynamic())
   {
     kernel.prepareQuant(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
                         _strideWidth, _strideHeight);
   }
+
+  // Quantization parameters of tensors do not change even if their shapes change
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+    CalculateActivationRangeUint8(_activation, _output, &_output_activation_min,
+                                  &_output_activation_max);
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    const int num_channels = getTensorShape(_kernel).Dims(0);
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, num_channels,
+                                                &_per_channel_output_multiplier,
+                                                &_per_channel_output_shift);
+    CalculateActivationRangeQuantized(_activation, _output, &_output_activation_min,
+                                      &_output_activation_max);
+
+    // Constant filter is packed by ruy only once
+    if (_kernel->is_constant())
+    {
+      nnfw::cker::ConvParams op_params;
+      op_params.input_offset = -_input->data_offset();
+      op_params.output_offset = _output->data_offset();
+
+      const auto ruy_context = _external_context->leaseRuyContext();
+      if (canPrepack(_kernel, *_external_context))
+      {
+        kernel.prepackQuant(op_params, _per_channel_output_multiplier.data(),
+                            _per_channel_output_shift.data(), getTensorShape(_kernel),
+                            reinterpret_cast<const int8_t *>(_kernel->buffer()),
+                            ruy_context.get());
+        _is_kernel_prepacked = true;
+        releaseConsumedConstant(_kernel, /*keep_address=*/true);
+      }
+    }
+  }
   _prepare = true;
 }
 
@@ -18,11 +18,13 @@
 #define __ONERT_BACKEND_CPU_OPS_CONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace nnfw
 {
@@ -52,13 +54,17 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
+  void convSparseWeight();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -83,9 +89,24 @@ private:
 
   ir::Activation _activation;
 
-  std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  // Parameters derived from quantization of tensors, which are computed once in prepare()
+  int32_t _output_multiplier;
+  int32_t _output_shift;
+  int32_t _output_activation_min;
+  int32_t _output_activation_max;
+  // Multipliers and shifts of output channels for int8 convolution
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
+  // Prepared filter which _conv_kernel refers to, loaded from the compile cache or shared with
+  // kernels of other execution contexts
+  std::shared_ptr<const ir::Data> _cached_filter;
+  std::shared_ptr<nnfw::cker::Conv> _conv_kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 
   bool _prepare;
+  // Whether ruy has packed constant filter in prepare(), which it does not pack again in runs
+  bool _is_kernel_prepacked;
 };
 
 } // namespace ops
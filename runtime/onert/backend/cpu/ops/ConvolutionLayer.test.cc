@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConvolutionLayer.h"
+
+#include <backend/cpu_common/Tensor.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::ops;
+
+namespace
+{
+
+ir::OperandInfo floatInfo(const ir::Shape &shape)
+{
+  return ir::OperandInfo::createStaticInfo(shape, ir::TypeInfo(ir::DataType::FLOAT32));
+}
+
+// Kernel of [4, 1, 1, 4] with 2x2 blocks, whose nonzero blocks are (0, 1) and (1, 0)
+const std::vector<float> dense_kernel{
+    0.f, 0.f, 1.f,  2.f,  // row 0
+    0.f, 0.f, 3.f,  4.f,  // row 1
+    -1.f, 0.5f, 0.f, 0.f, // row 2
+    2.f, -2.f, 0.f, 0.f,  // row 3
+};
+
+ir::OperandInfo sparseKernelInfo()
+{
+  ir::TypeInfo type_info(ir::DataType::FLOAT32);
+  type_info.sparsity(std::make_shared<ir::Sparsity>(std::vector<uint16_t>{0, 1, 2},
+                                                    std::vector<uint16_t>{1, 0},
+                                                    std::vector<int32_t>{2, 2}));
+  auto info = ir::OperandInfo::createStaticInfo({4, 1, 1, 4}, type_info);
+  info.setAsConstant();
+  return info;
+}
+
+} // namespace
+
+TEST(ConvolutionLayer, sparse_pointwise)
+{
+  backend::cpu_common::Tensor input(floatInfo({1, 2, 3, 4}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor kernel(sparseKernelInfo(), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor bias(floatInfo({4}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor output(floatInfo({1, 2, 3, 4}), ir::Layout::NHWC, nullptr);
+
+  std::vector<float> input_data(24);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = 0.25f * static_cast<float>(i % 7) - 0.5f;
+  // Nonzero blocks in row-major order
+  std::vector<float> kernel_data{1.f, 2.f, 3.f, 4.f, -1.f, 0.5f, 2.f, -2.f};
+  std::vector<float> bias_data{0.5f, 0.f, -0.5f, 1.f};
+  std::vector<float> output_data(24);
+
+  input.setBuffer(reinterpret_cast<uint8_t *>(input_data.data()));
+  kernel.setBuffer(reinterpret_cast<uint8_t *>(kernel_data.data()));
+  bias.setBuffer(reinterpret_cast<uint8_t *>(bias_data.data()));
+  output.setBuffer(reinterpret_cast<uint8_t *>(output_data.data()));
+
+  ConvolutionLayer layer;
+  layer.configure(&input, &kernel, &bias, ir::PaddingType::VALID, 0, 0, 0, 0, 1, 1, 1, 1,
+                  ir::Activation::NONE, &output, std::make_shared<ExternalContext>());
+  layer.prepare();
+  layer.run();
+
+  for (int pixel = 0; pixel < 6; ++pixel)
+  {
+    for (int oc = 0; oc < 4; ++oc)
+    {
+      float expected = bias_data[oc];
+      for (int ic = 0; ic < 4; ++ic)
+        expected += dense_kernel[oc * 4 + ic] * input_data[pixel * 4 + ic];
+      EXPECT_NEAR(output_data[pixel * 4 + oc], expected, 1e-5f)
+          << "pixel " << pixel << ", channel " << oc;
+    }
+  }
+}
+
+TEST(ConvolutionLayer, neg_sparse_with_padding)
+{
+  backend::cpu_common::Tensor input(floatInfo({1, 2, 3, 4}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor kernel(sparseKernelInfo(), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor bias(floatInfo({4}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor output(floatInfo({1, 4, 5, 4}), ir::Layout::NHWC, nullptr);
+
+  std::vector<float> input_data(24, 1.f);
+  std::vector<float> kernel_data{1.f, 2.f, 3.f, 4.f, -1.f, 0.5f, 2.f, -2.f};
+  std::vector<float> bias_data(4, 0.f);
+  std::vector<float> output_data(80);
+
+  input.setBuffer(reinterpret_cast<uint8_t *>(input_data.data()));
+  kernel.setBuffer(reinterpret_cast<uint8_t *>(kernel_data.data()));
+  bias.setBuffer(reinterpret_cast<uint8_t *>(bias_data.data()));
+  output.setBuffer(reinterpret_cast<uint8_t *>(output_data.data()));
+
+  // Only pointwise convolution without padding runs on sparse filter
+  ConvolutionLayer layer;
+  layer.configure(&input, &kernel, &bias, ir::PaddingType::EXPLICIT, 1, 1, 1, 1, 1, 1, 1, 1,
+                  ir::Activation::NONE, &output, std::make_shared<ExternalContext>());
+  layer.prepare();
+  EXPECT_THROW(layer.run(), std::runtime_error);
+}
+
+TEST(ConvolutionLayer, share_prepared_filter)
+{
+  ir::OperandInfo kernel_info = floatInfo({8, 3, 3, 8});
+  kernel_info.setAsConstant();
+  backend::cpu_common::Tensor input(floatInfo({1, 4, 4, 8}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor kernel(kernel_info, ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor bias(floatInfo({8}), ir::Layout::NHWC, nullptr);
+  backend::cpu_common::Tensor output(floatInfo({1, 4, 4, 8}), ir::Layout::NHWC, nullptr);
+
+  std::vector<float> input_data(128);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = 0.25f * static_cast<float>(i % 5) - 0.5f;
+  std::vector<float> kernel_data(576);
+  for (size_t i = 0; i < kernel_data.size(); ++i)
+    kernel_data[i] = 0.125f * static_cast<float>(i % 9) - 0.5f;
+  std::vector<float> bias_data(8);
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = 0.125f * static_cast<float>(i) - 0.5f;
+  std::vector<float> output_data(128);
+
+  input.setBuffer(reinterpret_cast<uint8_t *>(input_data.data()));
+  kernel.setBuffer(reinterpret_cast<uint8_t *>(kernel_data.data()));
+  bias.setBuffer(reinterpret_cast<uint8_t *>(bias_data.data()));
+  output.setBuffer(reinterpret_cast<uint8_t *>(output_data.data()));
+
+  // The filter of 3x3 convolution of 8 channels is prepared for Winograd
+  auto run_layer = [&](const std::shared_ptr<ExternalContext> &external_context) {
+    ConvolutionLayer layer;
+    layer.configure(&input, &kernel, &bias, ir::PaddingType::SAME, 1, 1, 1, 1, 1, 1, 1, 1,
+                    ir::Activation::NONE, &output, external_context);
+    layer.prepare();
+    layer.run();
+    return output_data;
+  };
+
+  auto first_context = std::make_shared<ExternalContext>();
+  auto shared_context = std::make_shared<ExternalContext>();
+  shared_context->share(*first_context);
+  const auto expected = run_layer(first_context);
+
+  // A kernel of a context sharing the first one does not read the constant filter again
+  std::fill(kernel_data.begin(), kernel_data.end(), 0.f);
+  const auto shared_output = run_layer(shared_context);
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_FLOAT_EQ(shared_output[i], expected[i]) << "element " << i;
+
+  // Other contexts prepare the filter by themselves
+  const auto other_output = run_layer(std::make_shared<ExternalContext>());
+  for (size_t i = 0; i < other_output.size(); ++i)
+    EXPECT_FLOAT_EQ(other_output[i], bias_data[i % 8]) << "element " << i;
+}
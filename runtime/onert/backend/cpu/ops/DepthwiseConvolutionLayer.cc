@@ -30,7 +30,9 @@ namespace ops
 DepthwiseConvolutionLayer::DepthwiseConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _paddingLeft(0),
       _paddingTop(0), _paddingRight(0), _paddingBottom(0), _strideWidth(0), _strideHeight(0),
-      _multiplier(0), _activation(ir::Activation::NONE)
+      _multiplier(0), _activation(ir::Activation::NONE), _output_multiplier(0), _output_shift(0),
+      _output_activation_min(0), _output_activation_max(0), _per_channel_output_multiplier(),
+      _per_channel_output_shift(), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -55,22 +57,12 @@ void DepthwiseConvolutionLayer::convFloat32()
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
       getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
       getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
-      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+      _external_context->eigen_device());
 }
 
 void DepthwiseConvolutionLayer::convQuant8()
 {
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-
   nnfw::cker::DepthwiseConvParams op_params;
   op_params.stride_width = _strideWidth;
   op_params.stride_height = _strideHeight;
@@ -82,10 +74,10 @@ void DepthwiseConvolutionLayer::convQuant8()
   op_params.input_offset = -_input->data_offset();
   op_params.weights_offset = -_kernel->data_offset();
   op_params.output_offset = _output->data_offset();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
 
   nnfw::cker::DepthwiseConv(
       op_params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
@@ -94,13 +86,38 @@ void DepthwiseConvolutionLayer::convQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convQuant8PerChannel()
+{
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
+
+  nnfw::cker::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
                                           const IPortableTensor *kernel,
                                           const IPortableTensor *bias, const uint32_t paddingLeft,
                                           const uint32_t paddingRight, const uint32_t paddingTop,
                                           const uint32_t paddingBottom, const uint32_t strideWidth,
                                           const uint32_t strideHeight, const uint32_t multiplier,
-                                          const ir::Activation activation, IPortableTensor *output)
+                                          const ir::Activation activation, IPortableTensor *output,
+                                          const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -114,6 +131,7 @@ void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
   _multiplier = multiplier;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
 }
 
 void DepthwiseConvolutionLayer::run()
@@ -126,12 +144,38 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    convQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
   }
 }
 
+void DepthwiseConvolutionLayer::prepare()
+{
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+    CalculateActivationRangeUint8(_activation, _output, &_output_activation_min,
+                                  &_output_activation_max);
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    // Kernel format is [1, kernel_height, kernel_width, depth_out]
+    const int num_channels = getTensorShape(_kernel).Dims(3);
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, num_channels,
+                                                &_per_channel_output_multiplier,
+                                                &_per_channel_output_shift);
+    CalculateActivationRangeQuantized(_activation, _output, &_output_activation_min,
+                                      &_output_activation_max);
+  }
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
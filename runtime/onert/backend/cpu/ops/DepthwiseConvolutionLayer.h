@@ -18,10 +18,14 @@
 #define __ONERT_KERNEL_CPU_DEPTHWISECONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
 
+#include <memory>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -41,15 +45,19 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
                  const uint32_t multiplier, const ir::Activation activation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+  void prepare() override;
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_kernel;
@@ -67,6 +75,17 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  // Parameters derived from quantization of tensors, which are computed once in prepare()
+  int32_t _output_multiplier;
+  int32_t _output_shift;
+  int32_t _output_activation_min;
+  int32_t _output_activation_max;
+  // Multipliers and shifts of output channels for int8 depthwise convolution
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
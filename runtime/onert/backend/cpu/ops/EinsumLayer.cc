@@ -28,7 +28,8 @@ namespace ops
 {
 
 EinsumLayer::EinsumLayer()
-    : _inputs(), _output(nullptr), _equation(), _einsum_kernel(new nnfw::cker::Einsum())
+    : _inputs(), _output(nullptr), _equation(), _einsum_kernel(new nnfw::cker::Einsum()),
+      _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -51,8 +52,9 @@ void EinsumLayer::einsumFloat32()
     inputFloatPtrs.emplace_back(reinterpret_cast<const float *>(_inputs[i]->buffer()));
   }
 
+  const auto ruy_context = _external_context->leaseRuyContext();
   kernel(_equation, inputShapes, inputFloatPtrs, getTensorShape(_output),
-         reinterpret_cast<float *>(_output->buffer()));
+         reinterpret_cast<float *>(_output->buffer()), ruy_context.get());
 }
 
 void EinsumLayer::run()
@@ -68,7 +70,8 @@ void EinsumLayer::run()
 }
 
 void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
-                            std::string equation, IPortableTensor *output)
+                            std::string equation, IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(inputs.size() > 0);
   assert(output != nullptr);
@@ -76,6 +79,7 @@ void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
   _inputs = inputs;
   _equation = equation;
   _output = output;
+  _external_context = external_context;
 }
 
 } // namespace ops
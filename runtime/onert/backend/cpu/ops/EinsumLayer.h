@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_EINSUM_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -51,7 +52,7 @@ public:
   void einsumFloat32();
 
   void configure(const std::vector<const IPortableTensor *> &inputs, std::string equation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -62,6 +63,7 @@ private:
   std::string _equation;
 
   std::unique_ptr<nnfw::cker::Einsum> _einsum_kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
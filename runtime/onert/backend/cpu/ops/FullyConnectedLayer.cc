@@ -30,10 +30,21 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Fewest batches for which ruy with packed weights beats the vector kernels in float on arm. This
+// is a heuristic, since ruy packs input of every run while the vector kernels do not pack at all.
+constexpr int kMinBatchSizeForRuy = 4;
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
     : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
-      _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-      _external_context(nullptr), _is_hybrid(false)
+      _activation(ir::Activation::NONE), _output_multiplier(0), _output_shift(0),
+      _output_activation_min(0), _output_activation_max(0), _per_channel_output_multiplier(),
+      _per_channel_output_shift(), _temp_arena(new nnfw::cker::FCTempArena()),
+      _external_context(nullptr), _is_hybrid(false), _is_weights_prepacked(false)
 {
   // DO NOTHING
 }
@@ -50,6 +61,19 @@ void FullyConnectedLayer::fullyConnectedFloat32()
   op_params.float_activation_max = output_activation_max;
   op_params.activation = convertActivationType(_activation);
 
+  if (_is_weights_prepacked)
+  {
+    op_params.lhs_cacheable = true;
+    const auto ruy_context = _external_context->leaseRuyContext();
+    nnfw::cker::FullyConnected(
+        op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+        getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
+        getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+        ruy_context.get());
+    return;
+  }
+
   nnfw::cker::FullyConnected(
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
       getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
@@ -61,24 +85,14 @@ void FullyConnectedLayer::fullyConnectedFloat32()
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
 {
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
-
   nnfw::cker::FullyConnectedParams op_params;
   op_params.input_offset = -_input->data_offset();
   op_params.weights_offset = -_weights->data_offset();
   op_params.output_offset = _output->data_offset();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
 
   nnfw::cker::FullyConnected(
       op_params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
@@ -87,6 +101,27 @@ void FullyConnectedLayer::fullyConnectedQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
+  op_params.lhs_cacheable = _is_weights_prepacked;
+
+  const auto ruy_context = _external_context->leaseRuyContext();
+
+  nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+      ruy_context.get());
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -99,13 +134,15 @@ void FullyConnectedLayer::fullyConnectedHybrid()
   op_params.activation = convertActivationType(_activation);
   op_params.weights_scale = _weights->data_scale();
 
+  const auto ruy_context = _external_context->leaseRuyContext();
+
 #ifndef USE_RUY_GEMV
   nnfw::cker::FullyConnectedHybrid(
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
       getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
       getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), temp_arena,
-      _external_context->ruy_context());
+      ruy_context.get());
 #else
   nnfw::cker::FullyConnectedHybrid(
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
@@ -114,7 +151,7 @@ void FullyConnectedLayer::fullyConnectedHybrid()
                         : reinterpret_cast<const int8_t *>(_weights->buffer()),
       getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), temp_arena,
-      _external_context->ruy_context());
+      ruy_context.get());
 
   if (_cached_weights == nullptr || _is_weights_freed)
     return;
@@ -158,30 +195,60 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
   op_params.float_activation_max = output_activation_max;
   op_params.activation = convertActivationType(_activation);
 
-  const uint16_t *w1_segments = _weights->sparsity()->w1_segments();
-  const uint16_t *w1_indices = _weights->sparsity()->w1_indices();
+  const auto sparsity = _weights->sparsity();
+  const auto &block_size = sparsity->block_size();
+  const int block_rows = block_size.empty() ? 1 : block_size[0];
+  const int block_cols = block_size.empty() ? 1 : block_size[1];
+  const auto weights_shape = getTensorShape(_weights);
+  if (weights_shape.Dims(0) % block_rows != 0 || weights_shape.Dims(1) % block_cols != 0)
+    throw std::runtime_error{"FullyConnected: unsupported sparsity"};
 
-  auto block_size = _weights->sparsity()->block_size();
-  if (block_size.size() == 0)
+  nnfw::cker::FullyConnectedSparseWeight(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      weights_shape, reinterpret_cast<const float *>(_weights->buffer()), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr), getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()), sparsity->w1_segments(),
+      sparsity->w1_indices(), block_rows, block_cols, _external_context->eigen_device());
+}
+
+void FullyConnectedLayer::prepackWeights()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
   {
-    nnfw::cker::FullyConnectedSparseWeightRandom(
-        op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
-        getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
-        getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), w1_segments,
-        w1_indices);
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+    // On arm, ruy with packed weights is used instead of the vector kernels of TensorUtils once
+    // a run has enough batches to amortize ruy's packing of input. With fewer batches, or an input
+    // of unknown batches, the vector kernels that read weights as they are stay faster.
+    if (_input->is_dynamic())
+      return;
+    const int batch_size = getTensorShape(_input).FlatSize() / getTensorShape(_weights).Dims(1);
+    if (batch_size < kMinBatchSizeForRuy)
+      return;
+
+    const auto ruy_context = _external_context->leaseRuyContext();
+    if (!canPrepack(_weights, *_external_context))
+      return;
+    nnfw::cker::PrepackFullyConnected(getTensorShape(_weights),
+                                      reinterpret_cast<const float *>(_weights->buffer()),
+                                      ruy_context.get());
+    _is_weights_prepacked = true;
+#endif
   }
-  else if (block_size.size() == 2 && block_size[0] == 16 && block_size[1] == 1)
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
   {
-    nnfw::cker::FullyConnectedSparseWeight16x1(
-        op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
-        getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
-        getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
-        getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), w1_segments,
-        w1_indices);
+    nnfw::cker::FullyConnectedParams op_params;
+    op_params.input_offset = -_input->data_offset();
+    op_params.output_offset = _output->data_offset();
+
+    const auto ruy_context = _external_context->leaseRuyContext();
+    if (!canPrepack(_weights, *_external_context))
+      return;
+    nnfw::cker::PrepackFullyConnectedPerChannel(
+        op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+        getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+        ruy_context.get());
+    _is_weights_prepacked = true;
   }
-  else
-    throw std::runtime_error{"FullyConnected: unsupported sparsity"};
 }
 
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -217,6 +284,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -225,6 +296,24 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+    CalculateActivationRangeUint8(_activation, _output, &_output_activation_min,
+                                  &_output_activation_max);
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    const int num_units = getTensorShape(_weights).Dims(0);
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _weights, _output, num_units,
+                                                &_per_channel_output_multiplier,
+                                                &_per_channel_output_shift);
+    CalculateActivationRangeQuantized(_activation, _output, &_output_activation_min,
+                                      &_output_activation_max);
+  }
+
   if (_bias && _bias->is_constant())
   {
     const int bias_size = getTensorShape(_bias).FlatSize();
@@ -234,6 +323,13 @@ void FullyConnectedLayer::prepare()
     }
   }
 
+  if (_weights->is_constant() && !_weights->sparsity() && !_is_hybrid && !_is_weights_prepacked)
+  {
+    prepackWeights();
+    if (_is_weights_prepacked)
+      releaseConsumedConstant(_weights, /*keep_address=*/true);
+  }
+
 #if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && defined(USE_RUY_GEMV)
   // TODO This is workaround
   // The only fc hybrid will use ruy kernel
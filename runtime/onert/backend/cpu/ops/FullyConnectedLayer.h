@@ -23,6 +23,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -51,6 +53,8 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant8PerChannel();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
@@ -63,6 +67,9 @@ public:
 
   void prepare() override;
 
+private:
+  void prepackWeights();
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_weights;
@@ -70,11 +77,23 @@ private:
   IPortableTensor *_output;
 
   ir::Activation _activation;
+
+  // Parameters derived from quantization of tensors, which are computed once in prepare()
+  int32_t _output_multiplier;
+  int32_t _output_shift;
+  int32_t _output_activation_min;
+  int32_t _output_activation_max;
+  // Multipliers and shifts of output units for int8 fully connected
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
 
   std::shared_ptr<ExternalContext> _external_context;
 
   bool _is_hybrid;
+  // Whether ruy has packed constant weights in prepare(), which it does not pack again in runs
+  bool _is_weights_prepacked;
 
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FullyConnectedLayer.h"
+
+#include <backend/cpu_common/Tensor.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::ops;
+
+namespace
+{
+
+// Tensor that counts how often its quantization scale is read
+class ScaleCountingTensor : public backend::cpu_common::Tensor
+{
+public:
+  ScaleCountingTensor(const ir::OperandInfo &info)
+      : backend::cpu_common::Tensor(info, ir::Layout::NHWC, nullptr)
+  {
+  }
+
+public:
+  float data_scale() const override
+  {
+    ++_scale_reads;
+    return backend::cpu_common::Tensor::data_scale();
+  }
+
+  int scale_reads() const { return _scale_reads; }
+
+private:
+  mutable int _scale_reads = 0;
+};
+
+ir::OperandInfo quantInfo(const ir::Shape &shape, ir::DataType type, float scale, int32_t offset)
+{
+  return ir::OperandInfo::createStaticInfo(shape, ir::TypeInfo(type, scale, offset));
+}
+
+} // namespace
+
+TEST(FullyConnectedLayer, quant8_params_cached_in_prepare)
+{
+  ScaleCountingTensor input(quantInfo({1, 4}, ir::DataType::QUANT_UINT8_ASYMM, 0.5f, 128));
+  ScaleCountingTensor weights(quantInfo({3, 4}, ir::DataType::QUANT_UINT8_ASYMM, 0.5f, 128));
+  ScaleCountingTensor bias(quantInfo({3}, ir::DataType::INT32, 0.25f, 0));
+  ScaleCountingTensor output(quantInfo({1, 3}, ir::DataType::QUANT_UINT8_ASYMM, 1.0f, 128));
+
+  std::vector<uint8_t> input_data{130, 132, 126, 128};
+  std::vector<uint8_t> weights_data{130, 130, 130, 130, 128, 132, 128, 124, 126, 126, 126, 126};
+  std::vector<int32_t> bias_data{4, 0, -4};
+  std::vector<uint8_t> output_data(3);
+
+  input.setBuffer(input_data.data());
+  weights.setBuffer(weights_data.data());
+  bias.setBuffer(reinterpret_cast<uint8_t *>(bias_data.data()));
+  output.setBuffer(output_data.data());
+
+  FullyConnectedLayer layer;
+  layer.configure(&input, &weights, &bias, ir::Activation::NONE, &output,
+                  std::make_shared<ExternalContext>());
+  layer.prepare();
+
+  const int reads = input.scale_reads() + weights.scale_reads() + bias.scale_reads() +
+                    output.scale_reads();
+  ASSERT_GT(reads, 0);
+
+  layer.run();
+  const std::vector<uint8_t> first = output_data;
+  std::fill(output_data.begin(), output_data.end(), 0);
+  layer.run();
+
+  // The multiplier and activation range come from prepare(), not from every run()
+  EXPECT_EQ(input.scale_reads() + weights.scale_reads() + bias.scale_reads() +
+                output.scale_reads(),
+            reads);
+  EXPECT_EQ(output_data, first);
+
+  // Accumulators {12, 16, -12} scaled by 0.5 * 0.5 / 1.0 and offset by 128
+  EXPECT_EQ(first, (std::vector<uint8_t>{131, 132, 125}));
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LSTMLayer.h"
+
+#include <cker/operation/LSTM.h>
+
+#include <algorithm>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+LSTMLayer::LSTMLayer()
+    : _input(nullptr), _input_weights(), _recurrent_weights(), _cell_weights(), _biases(),
+      _projection_weights(nullptr), _projection_bias(nullptr), _output_state_in(nullptr),
+      _cell_state_in(nullptr), _output_state_out(nullptr), _cell_state_out(nullptr),
+      _output(nullptr), _activation(ir::Activation::NONE), _cell_threshold(0.f),
+      _projection_threshold(0.f), _external_context(nullptr), _is_hybrid(false),
+      _is_weights_packed(false), _is_projection_prepacked(false),
+      _gates(new nnfw::cker::RecurrentGates()),
+      _temp_arena(new nnfw::cker::LSTMTempArena()), _cell_weights_data(),
+      _projection_weights_data(nullptr)
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
+void LSTMLayer::configure(const IPortableTensor *input, const GateTensors &input_weights,
+                          const GateTensors &recurrent_weights, const GateTensors &cell_weights,
+                          const GateTensors &biases, const IPortableTensor *projection_weights,
+                          const IPortableTensor *projection_bias,
+                          const IPortableTensor *output_state_in,
+                          const IPortableTensor *cell_state_in, ir::Activation activation,
+                          float cell_threshold, float projection_threshold,
+                          IPortableTensor *output_state_out, IPortableTensor *cell_state_out,
+                          IPortableTensor *output,
+                          const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr && output != nullptr);
+  assert(input_weights[FORGET_GATE] != nullptr && recurrent_weights[FORGET_GATE] != nullptr);
+
+  _input = input;
+  _input_weights = input_weights;
+  _recurrent_weights = recurrent_weights;
+  _cell_weights = cell_weights;
+  _biases = biases;
+  _projection_weights = projection_weights;
+  _projection_bias = projection_bias;
+  _output_state_in = output_state_in;
+  _cell_state_in = cell_state_in;
+  _activation = activation;
+  _cell_threshold = cell_threshold;
+  _projection_threshold = projection_threshold;
+  _output_state_out = output_state_out;
+  _cell_state_out = cell_state_out;
+  _output = output;
+  _external_context = external_context;
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               input_weights[FORGET_GATE]->data_type() == OperandType::QUANT_INT8_SYMM;
+}
+
+bool LSTMLayer::isWeightsConstant() const
+{
+  auto is_constant = [](const GateTensors &tensors) {
+    return std::all_of(tensors.begin(), tensors.end(), [](const IPortableTensor *tensor) {
+      return tensor == nullptr || tensor->is_constant();
+    });
+  };
+  return is_constant(_input_weights) && is_constant(_recurrent_weights) &&
+         is_constant(_cell_weights) && is_constant(_biases) &&
+         (_projection_weights == nullptr || _projection_weights->is_constant());
+}
+
+const float *LSTMLayer::floatWeights(const IPortableTensor *tensor,
+                                     std::shared_ptr<const std::vector<float>> &dequantized)
+{
+  if (tensor == nullptr)
+    return nullptr;
+
+  if (tensor->data_type() == OperandType::FLOAT32)
+    return reinterpret_cast<const float *>(tensor->buffer());
+
+  if (tensor->data_type() != OperandType::QUANT_INT8_SYMM)
+    throw std::runtime_error{"LSTM: unsupported weights type"};
+
+  // Kernels of every execution context share weights dequantized from the same constant
+  util::CompileCache::Key key;
+  key.append(std::string{"cpu.LSTM.dequantized"}).append(tensor->buffer());
+  if (tensor->is_constant())
+  {
+    dequantized = _external_context->findPrepared<std::vector<float>>(key);
+    if (dequantized)
+      return dequantized->data();
+  }
+
+  const auto size = getTensorShape(tensor).FlatSize();
+  const auto data = reinterpret_cast<const int8_t *>(tensor->buffer());
+  const auto scale = tensor->data_scale();
+  auto dequantized_data = std::make_shared<std::vector<float>>(size);
+  for (int i = 0; i < size; ++i)
+    (*dequantized_data)[i] = data[i] * scale;
+  dequantized = dequantized_data;
+  if (tensor->is_constant())
+    _external_context->addPrepared<std::vector<float>>(key, dequantized);
+  return dequantized->data();
+}
+
+void LSTMLayer::packWeights()
+{
+  packGates();
+  loadFloatWeights();
+}
+
+void LSTMLayer::packGates()
+{
+  const bool use_cifg = _input_weights[INPUT_GATE] == nullptr;
+  const int first_gate = use_cifg ? FORGET_GATE : INPUT_GATE;
+  const int n_gates = OUTPUT_GATE - first_gate + 1;
+  const int n_cell = getTensorShape(_input_weights[OUTPUT_GATE]).Dims(0);
+  const int n_input = getTensorShape(_input_weights[OUTPUT_GATE]).Dims(1);
+  const int n_output = getTensorShape(_recurrent_weights[OUTPUT_GATE]).Dims(1);
+
+  std::array<const float *, 4> biases;
+  for (int g = 0; g < n_gates; ++g)
+  {
+    auto bias = _biases[first_gate + g];
+    biases[g] = bias ? reinterpret_cast<const float *>(bias->buffer()) : nullptr;
+  }
+
+  if (_is_hybrid)
+  {
+    std::array<const int8_t *, 4> input_weights, recurrent_weights;
+    std::array<float, 4> input_scales, recurrent_scales;
+    for (int g = 0; g < n_gates; ++g)
+    {
+      auto input_weight = _input_weights[first_gate + g];
+      auto recurrent_weight = _recurrent_weights[first_gate + g];
+      input_weights[g] = reinterpret_cast<const int8_t *>(input_weight->buffer());
+      input_scales[g] = input_weight->data_scale();
+      recurrent_weights[g] = reinterpret_cast<const int8_t *>(recurrent_weight->buffer());
+      recurrent_scales[g] = recurrent_weight->data_scale();
+    }
+    _gates->pack(n_gates, n_cell, n_input, n_output, input_weights.data(), input_scales.data(),
+                 recurrent_weights.data(), recurrent_scales.data(), biases.data());
+  }
+  else
+  {
+    std::array<const float *, 4> input_weights, recurrent_weights;
+    for (int g = 0; g < n_gates; ++g)
+    {
+      input_weights[g] =
+          reinterpret_cast<const float *>(_input_weights[first_gate + g]->buffer());
+      recurrent_weights[g] =
+          reinterpret_cast<const float *>(_recurrent_weights[first_gate + g]->buffer());
+    }
+    _gates->pack(n_gates, n_cell, n_input, n_output, input_weights.data(),
+                 recurrent_weights.data(), biases.data());
+  }
+}
+
+void LSTMLayer::loadFloatWeights()
+{
+  // Peephole and projection weights of hybrid LSTM are used as float
+  for (int g = 0; g < 4; ++g)
+  {
+    _cell_weights_data[g] = floatWeights(_cell_weights[g], _dequantized_cell_weights[g]);
+  }
+  _projection_weights_data = floatWeights(_projection_weights, _dequantized_projection_weights);
+}
+
+void LSTMLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+  {
+    throw std::runtime_error{"LSTM: unsupported data type"};
+  }
+
+  // Weights that are not constant may change on every run
+  if (!_is_weights_packed)
+  {
+    packWeights();
+  }
+
+  const int n_batch = getTensorShape(_input).Dims(0);
+  const int n_cell = getTensorShape(_input_weights[OUTPUT_GATE]).Dims(0);
+  const int n_output = getTensorShape(_recurrent_weights[OUTPUT_GATE]).Dims(1);
+
+  nnfw::cker::LSTMParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.cell_clip = _cell_threshold;
+  op_params.proj_clip = _projection_threshold;
+  op_params.projection_cache_policy = _is_projection_prepacked
+                                          ? nnfw::cker::CachePolicy::kAlwaysCache
+                                          : nnfw::cker::CachePolicy::kNeverCache;
+
+  const auto ruy_context = _external_context->leaseRuyContext();
+
+  nnfw::cker::LSTM(
+      op_params, n_batch, n_cell, n_output, reinterpret_cast<const float *>(_input->buffer()),
+      *_gates, _cell_weights_data[INPUT_GATE], _cell_weights_data[FORGET_GATE],
+      _cell_weights_data[OUTPUT_GATE], _projection_weights_data,
+      _projection_bias ? reinterpret_cast<const float *>(_projection_bias->buffer()) : nullptr,
+      reinterpret_cast<const float *>(_output_state_in->buffer()),
+      reinterpret_cast<const float *>(_cell_state_in->buffer()),
+      reinterpret_cast<float *>(_output_state_out->buffer()),
+      reinterpret_cast<float *>(_cell_state_out->buffer()),
+      reinterpret_cast<float *>(_output->buffer()), *_temp_arena,
+      ruy_context.get());
+}
+
+void LSTMLayer::prepare()
+{
+  if (_is_weights_packed || !isWeightsConstant())
+    return;
+
+  // Constant weights are packed once, and are packed by ruy ahead of runs as well. Kernels of
+  // every execution context share gates packed from the same constants.
+  util::CompileCache::Key key;
+  key.append(std::string{"cpu.LSTM.gates"});
+  for (int g = 0; g < 4; ++g)
+  {
+    for (auto tensor : {_input_weights[g], _recurrent_weights[g], _biases[g]})
+      key.append(tensor ? tensor->buffer() : nullptr);
+  }
+  auto shared = _external_context->findPrepared<nnfw::cker::RecurrentGates>(key);
+  if (shared)
+  {
+    _gates->share(*shared);
+  }
+  else
+  {
+    packGates();
+    auto gates = std::make_shared<nnfw::cker::RecurrentGates>();
+    gates->share(*_gates);
+    _external_context->addPrepared<nnfw::cker::RecurrentGates>(key, gates);
+  }
+  loadFloatWeights();
+  _is_weights_packed = true;
+
+  // Packed gates are always a copy on heap, and so are dequantized projection weights
+  const auto ruy_context = _external_context->leaseRuyContext();
+  if (_external_context->reservePrepackedHeap(_gates->weights_data(), _gates->weights_size()))
+    _gates->prepack(ruy_context.get());
+  if (_projection_weights_data != nullptr)
+  {
+    const int n_cell = getTensorShape(_input_weights[OUTPUT_GATE]).Dims(0);
+    const int n_output = getTensorShape(_recurrent_weights[OUTPUT_GATE]).Dims(1);
+    _is_projection_prepacked =
+        _dequantized_projection_weights == nullptr
+            ? canPrepack(_projection_weights, *_external_context)
+            : _external_context->reservePrepackedHeap(
+                  _dequantized_projection_weights->data(),
+                  _dequantized_projection_weights->size() * sizeof(float));
+    if (_is_projection_prepacked)
+      nnfw::cker::PrepackLSTMProjection(n_cell, n_output, _projection_weights_data,
+                                        ruy_context.get());
+  }
+
+  // Weights and biases of gates are copied into _gates. Peephole and projection weights are
+  // used as they are if they are float, and float projection weights are released only once ruy
+  // has packed them, keeping their address as the key of the packing. Otherwise they are used as
+  // dequantized copies.
+  for (int g = 0; g < 4; ++g)
+  {
+    for (auto tensor : {_input_weights[g], _recurrent_weights[g], _biases[g]})
+    {
+      if (tensor != nullptr)
+        releaseConsumedConstant(tensor);
+    }
+    if (_cell_weights[g] != nullptr && _cell_weights[g]->data_type() != OperandType::FLOAT32)
+      releaseConsumedConstant(_cell_weights[g]);
+  }
+  if (_projection_weights != nullptr)
+  {
+    const bool is_float = _projection_weights->data_type() == OperandType::FLOAT32;
+    if (!is_float || _is_projection_prepacked)
+      releaseConsumedConstant(_projection_weights, /*keep_address=*/is_float);
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+class RecurrentGates;
+class LSTMTempArena;
+} // namespace cker
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class LSTMLayer : public ::onert::exec::IFunction
+{
+public:
+  // Tensors of gates are indexed in this order
+  enum Gate
+  {
+    INPUT_GATE = 0,
+    FORGET_GATE = 1,
+    CELL_GATE = 2,
+    OUTPUT_GATE = 3
+  };
+  using GateTensors = std::array<const IPortableTensor *, 4>;
+
+public:
+  LSTMLayer();
+  ~LSTMLayer();
+
+public:
+  /**
+   * @brief Configure LSTM
+   * @note  Optional tensors are nullptr. Input gate tensors are nullptr with CIFG, and
+   *        @c cell_weights, which has no cell gate tensor, is all nullptr without peephole.
+   */
+  void configure(const IPortableTensor *input, const GateTensors &input_weights,
+                 const GateTensors &recurrent_weights, const GateTensors &cell_weights,
+                 const GateTensors &biases, const IPortableTensor *projection_weights,
+                 const IPortableTensor *projection_bias, const IPortableTensor *output_state_in,
+                 const IPortableTensor *cell_state_in, ir::Activation activation,
+                 float cell_threshold, float projection_threshold,
+                 IPortableTensor *output_state_out, IPortableTensor *cell_state_out,
+                 IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+  void prepare() override;
+
+private:
+  bool isWeightsConstant() const;
+  void packWeights();
+  void packGates();
+  void loadFloatWeights();
+  const float *floatWeights(const IPortableTensor *tensor,
+                            std::shared_ptr<const std::vector<float>> &dequantized);
+
+private:
+  const IPortableTensor *_input;
+  GateTensors _input_weights;
+  GateTensors _recurrent_weights;
+  GateTensors _cell_weights;
+  GateTensors _biases;
+  const IPortableTensor *_projection_weights;
+  const IPortableTensor *_projection_bias;
+  const IPortableTensor *_output_state_in;
+  const IPortableTensor *_cell_state_in;
+  IPortableTensor *_output_state_out;
+  IPortableTensor *_cell_state_out;
+  IPortableTensor *_output;
+
+  ir::Activation _activation;
+  float _cell_threshold;
+  float _projection_threshold;
+
+  std::shared_ptr<ExternalContext> _external_context;
+
+  bool _is_hybrid;
+  bool _is_weights_packed;
+  // Whether ruy has packed projection weights in prepare(), which it does not pack again in runs
+  bool _is_projection_prepacked;
+
+  // Weights of all gates packed into a single matrix
+  std::unique_ptr<nnfw::cker::RecurrentGates> _gates;
+  std::unique_ptr<nnfw::cker::LSTMTempArena> _temp_arena;
+  // Peephole and projection weights as float, which are dequantized for hybrid LSTM
+  std::array<const float *, 4> _cell_weights_data;
+  const float *_projection_weights_data;
+  std::array<std::shared_ptr<const std::vector<float>>, 4> _dequantized_cell_weights;
+  std::shared_ptr<const std::vector<float>> _dequantized_projection_weights;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
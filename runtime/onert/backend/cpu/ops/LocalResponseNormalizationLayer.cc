@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LocalResponseNormalizationLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/LocalResponseNormalization.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+LocalResponseNormalizationLayer::LocalResponseNormalizationLayer()
+    : _input(nullptr), _output(nullptr), _radius(0), _bias(0.f), _alpha(0.f), _beta(0.f)
+{
+  // DO NOTHING
+}
+
+void LocalResponseNormalizationLayer::configure(const IPortableTensor *input, int radius,
+                                                float bias, float alpha, float beta,
+                                                IPortableTensor *output)
+{
+  _input = input;
+  _radius = radius;
+  _bias = bias;
+  _alpha = alpha;
+  _beta = beta;
+  _output = output;
+}
+
+void LocalResponseNormalizationLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"LocalResponseNormalization: unsupported data type"};
+
+  nnfw::cker::LocalResponseNormalizationParams params;
+  params.range = _radius;
+  params.bias = _bias;
+  params.alpha = _alpha;
+  params.beta = _beta;
+
+  nnfw::cker::LocalResponseNormalization(
+      params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -16,6 +16,9 @@
 
 #include "OperationUtils.h"
 
+#include "../ExternalContext.h"
+#include "../Tensor.h"
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -94,6 +97,30 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *input, const IPort
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliersAndShifts(const IPortableTensor *input,
+                                                 const IPortableTensor *filter,
+                                                 const IPortableTensor *output, int num_channels,
+                                                 std::vector<int32_t> *multipliers,
+                                                 std::vector<int32_t> *shifts)
+{
+  // A filter quantized per tensor has the same scale for all channels
+  const auto &filter_scales = filter->data_scales();
+  assert(filter_scales.empty() || filter_scales.size() == static_cast<size_t>(num_channels));
+  const double input_scale = input->data_scale();
+  const double output_scale = output->data_scale();
+
+  multipliers->resize(num_channels);
+  shifts->resize(num_channels);
+  for (int i = 0; i < num_channels; ++i)
+  {
+    const double filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[i];
+    const double multiplier = input_scale * filter_scale / output_scale;
+    int shift = 0;
+    QuantizeMultiplier(multiplier, &(*multipliers)[i], &shift);
+    (*shifts)[i] = shift;
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -114,8 +141,29 @@ void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantiz
 void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
                                    int32_t *act_min, int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
+  assert(output->data_type() == OperandType::QUANT_UINT8_ASYMM);
+  CalculateActivationRangeQuantized(activation, output, act_min, act_max);
+}
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max)
+{
+  int32_t qmin = 0;
+  int32_t qmax = 0;
+  switch (output->data_type())
+  {
+    case OperandType::QUANT_UINT8_ASYMM:
+      qmin = std::numeric_limits<uint8_t>::min();
+      qmax = std::numeric_limits<uint8_t>::max();
+      break;
+    case OperandType::QUANT_INT8_SYMM:
+      qmin = std::numeric_limits<int8_t>::min();
+      qmax = std::numeric_limits<int8_t>::max();
+      break;
+    default:
+      throw std::runtime_error("CalculateActivationRangeQuantized: Not supported data type");
+  }
+
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -260,6 +308,33 @@ std::vector<int32_t> getReducerAxes(const IPortableTensor *axes)
   return ret;
 }
 
+void releaseConsumedConstant(const IPortableTensor *tensor, bool keep_address)
+{
+  assert(tensor->is_constant());
+
+  // Constant tensors of other backends are not released
+  // TODO Remove const_cast
+  auto external_tensor = dynamic_cast<ExternalTensor *>(const_cast<IPortableTensor *>(tensor));
+  if (external_tensor == nullptr || external_tensor->buffer() == nullptr)
+    return;
+
+  if (keep_address)
+    external_tensor->decrease_ref_keeping_address();
+  else
+    external_tensor->decrease_ref();
+}
+
+bool canPrepack(const IPortableTensor *tensor, ExternalContext &external_context)
+{
+  assert(tensor->is_constant());
+
+  auto external_tensor = dynamic_cast<const ExternalTensor *>(tensor);
+  if (external_tensor != nullptr && external_tensor->is_mmaped())
+    return true;
+
+  return external_context.reservePrepackedHeap(tensor->buffer(), tensor->total_size());
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -38,6 +38,9 @@ namespace backend
 {
 namespace cpu
 {
+
+class ExternalContext;
+
 namespace ops
 {
 
@@ -131,6 +134,10 @@ convertActivationType(const ir::Activation activation)
       return nnfw::cker::FusedActivationFunctionType::kRelu1;
     case ir::Activation::RELU6:
       return nnfw::cker::FusedActivationFunctionType::kRelu6;
+    case ir::Activation::TANH:
+      return nnfw::cker::FusedActivationFunctionType::kTanh;
+    case ir::Activation::SIGMOID:
+      return nnfw::cker::FusedActivationFunctionType::kSigmoid;
     default:
       throw std::runtime_error{"CPU backend: Cannot convert activation type"};
   }
@@ -162,6 +169,16 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
                                        const IPortableTensor *biasDescr,
                                        const IPortableTensor *outputDescr, double *multiplier);
 
+/**
+ * @brief Compute multipliers and shifts of output channels of convolution whose filter may be
+ *        quantized per channel
+ */
+void GetQuantizedConvolutionMultipliersAndShifts(const IPortableTensor *input,
+                                                 const IPortableTensor *filter,
+                                                 const IPortableTensor *output, int num_channels,
+                                                 std::vector<int32_t> *multipliers,
+                                                 std::vector<int32_t> *shifts);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -202,6 +219,9 @@ void CalculateActivationRange(ir::Activation activation, T *activation_min, T *a
 void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max);
+
 bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
@@ -212,6 +232,20 @@ nnfw::cker::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
 std::vector<int32_t> getReducerAxes(const IPortableTensor *axes);
 
+/**
+ * @brief Release data of a constant tensor that a kernel has consumed in prepare()
+ * @param keep_address Whether the kernel still refers to the address of data, e.g. as a key of
+ *                     ruy's cache of packed matrices
+ * @note  Data is released only after every kernel using the tensor has released it
+ */
+void releaseConsumedConstant(const IPortableTensor *tensor, bool keep_address = false);
+
+/**
+ * @brief Whether ruy may pack a constant tensor ahead of runs
+ * @note  Data kept on heap is charged to ExternalContext::reservePrepackedHeap()
+ */
+bool canPrepack(const IPortableTensor *tensor, ExternalContext &external_context);
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PReLULayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/PReLU.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+PReLULayer::PReLULayer() : _input(nullptr), _alpha(nullptr), _output(nullptr), _params()
+{
+  // DO NOTHING
+}
+
+void PReLULayer::configure(const IPortableTensor *input, const IPortableTensor *alpha,
+                           IPortableTensor *output)
+{
+  _input = input;
+  _alpha = alpha;
+  _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    _params.input_offset = -_input->data_offset();
+    _params.alpha_offset = -_alpha->data_offset();
+    _params.output_offset = _output->data_offset();
+
+    const double real_multiplier_1 = _input->data_scale() / _output->data_scale();
+    const double real_multiplier_2 =
+        _input->data_scale() * _alpha->data_scale() / _output->data_scale();
+    QuantizeMultiplier(real_multiplier_1, &_params.output_multiplier_1, &_params.output_shift_1);
+    QuantizeMultiplier(real_multiplier_2, &_params.output_multiplier_2, &_params.output_shift_2);
+  }
+}
+
+void PReLULayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    nnfw::cker::PReLU(getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+                      getTensorShape(_alpha), reinterpret_cast<const float *>(_alpha->buffer()),
+                      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    nnfw::cker::PReLU(_params, getTensorShape(_input),
+                      reinterpret_cast<const uint8_t *>(_input->buffer()), getTensorShape(_alpha),
+                      reinterpret_cast<const uint8_t *>(_alpha->buffer()), getTensorShape(_output),
+                      reinterpret_cast<uint8_t *>(_output->buffer()));
+  }
+  else
+  {
+    throw std::runtime_error{"PReLU: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
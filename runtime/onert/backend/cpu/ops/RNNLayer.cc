@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+RNNLayer::RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE), _external_context(nullptr), _is_hybrid(false),
+      _is_weights_packed(false), _packed_weights(new nnfw::cker::RecurrentGates())
+{
+  // DO NOTHING
+}
+
+RNNLayer::~RNNLayer() = default;
+
+void RNNLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
+                         const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                         const IPortableTensor *hidden_state_in, ir::Activation activation,
+                         IPortableTensor *output, IPortableTensor *hidden_state_out,
+                         const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr && weights != nullptr && recurrent_weights != nullptr);
+  assert(hidden_state_in != nullptr && output != nullptr && hidden_state_out != nullptr);
+
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+  _external_context = external_context;
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               weights->data_type() == OperandType::QUANT_INT8_SYMM;
+}
+
+void RNNLayer::packWeights()
+{
+  const int n_unit = getTensorShape(_weights).Dims(0);
+  const int n_input = getTensorShape(_weights).Dims(1);
+  const float *bias = _bias ? reinterpret_cast<const float *>(_bias->buffer()) : nullptr;
+
+  if (_is_hybrid)
+  {
+    const int8_t *weights = reinterpret_cast<const int8_t *>(_weights->buffer());
+    const int8_t *recurrent_weights =
+        reinterpret_cast<const int8_t *>(_recurrent_weights->buffer());
+    const float weights_scale = _weights->data_scale();
+    const float recurrent_weights_scale = _recurrent_weights->data_scale();
+    _packed_weights->pack(1, n_unit, n_input, n_unit, &weights, &weights_scale,
+                          &recurrent_weights, &recurrent_weights_scale, &bias);
+  }
+  else
+  {
+    const float *weights = reinterpret_cast<const float *>(_weights->buffer());
+    const float *recurrent_weights = reinterpret_cast<const float *>(_recurrent_weights->buffer());
+    _packed_weights->pack(1, n_unit, n_input, n_unit, &weights, &recurrent_weights, &bias);
+  }
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+  {
+    throw std::runtime_error{"RNN: unsupported data type"};
+  }
+
+  // Weights that are not constant may change on every run
+  if (!_is_weights_packed)
+  {
+    packWeights();
+  }
+
+  const int n_batch = getTensorShape(_input).Dims(0);
+  const int n_unit = getTensorShape(_weights).Dims(0);
+
+  const auto ruy_context = _external_context->leaseRuyContext();
+
+  nnfw::cker::RNN(convertActivationType(_activation), n_batch, n_unit,
+                  reinterpret_cast<const float *>(_input->buffer()), *_packed_weights,
+                  reinterpret_cast<const float *>(_hidden_state_in->buffer()),
+                  reinterpret_cast<float *>(_hidden_state_out->buffer()),
+                  reinterpret_cast<float *>(_output->buffer()), ruy_context.get());
+}
+
+void RNNLayer::prepare()
+{
+  if (_is_weights_packed || !_weights->is_constant() || !_recurrent_weights->is_constant() ||
+      (_bias && !_bias->is_constant()))
+    return;
+
+  // Constant weights are packed once, and are packed by ruy ahead of runs as well. Kernels of
+  // every execution context share weights packed from the same constants.
+  util::CompileCache::Key key;
+  key.append(std::string{"cpu.RNN.weights"})
+      .append(_weights->buffer())
+      .append(_recurrent_weights->buffer())
+      .append(_bias ? _bias->buffer() : nullptr);
+  auto shared = _external_context->findPrepared<nnfw::cker::RecurrentGates>(key);
+  if (shared)
+  {
+    _packed_weights->share(*shared);
+  }
+  else
+  {
+    packWeights();
+    auto packed = std::make_shared<nnfw::cker::RecurrentGates>();
+    packed->share(*_packed_weights);
+    _external_context->addPrepared<nnfw::cker::RecurrentGates>(key, packed);
+  }
+  _is_weights_packed = true;
+
+  // Packed weights are a copy on heap, which ruy would double by packing them
+  const auto ruy_context = _external_context->leaseRuyContext();
+  if (_external_context->reservePrepackedHeap(_packed_weights->weights_data(),
+                                              _packed_weights->weights_size()))
+    _packed_weights->prepack(ruy_context.get());
+
+  // Weights and bias are copied into _packed_weights
+  releaseConsumedConstant(_weights);
+  releaseConsumedConstant(_recurrent_weights);
+  if (_bias)
+    releaseConsumedConstant(_bias);
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
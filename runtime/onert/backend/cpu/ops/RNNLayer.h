@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class RecurrentGates;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class RNNLayer : public ::onert::exec::IFunction
+{
+public:
+  RNNLayer();
+  ~RNNLayer();
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *weights,
+                 const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                 const IPortableTensor *hidden_state_in, ir::Activation activation,
+                 IPortableTensor *output, IPortableTensor *hidden_state_out,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+  void prepare() override;
+
+private:
+  void packWeights();
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_weights;
+  const IPortableTensor *_recurrent_weights;
+  const IPortableTensor *_bias;
+  const IPortableTensor *_hidden_state_in;
+  IPortableTensor *_output;
+  IPortableTensor *_hidden_state_out;
+
+  ir::Activation _activation;
+
+  std::shared_ptr<ExternalContext> _external_context;
+
+  bool _is_hybrid;
+  bool _is_weights_packed;
+
+  // Input and recurrent weights packed into a single matrix
+  std::unique_ptr<nnfw::cker::RecurrentGates> _packed_weights;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
@@ -32,6 +32,10 @@ ReshapeLayer::ReshapeLayer() : _input(nullptr), _shape(nullptr), _output(nullptr
 
 void ReshapeLayer::reshapeGeneric()
 {
+  // Output can share memory with input in place
+  if (_output->buffer() == _input->buffer())
+    return;
+
   size_t count = _input->total_size();
   memcpy(_output->buffer(), _input->buffer(), count);
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "TopKV2Layer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/TopKV2.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TopKV2Layer::TopKV2Layer()
+    : _input(nullptr), _k(0), _output_values(nullptr), _output_indices(nullptr)
+{
+  // DO NOTHING
+}
+
+void TopKV2Layer::configure(const IPortableTensor *input, int32_t k,
+                            IPortableTensor *output_values, IPortableTensor *output_indices)
+{
+  _input = input;
+  _k = k;
+  _output_values = output_values;
+  _output_indices = output_indices;
+}
+
+template <typename T> void TopKV2Layer::topKV2()
+{
+  nnfw::cker::TopKV2(getTensorShape(_input), reinterpret_cast<const T *>(_input->buffer()), _k,
+                     reinterpret_cast<T *>(_output_values->buffer()),
+                     reinterpret_cast<int32_t *>(_output_indices->buffer()));
+}
+
+void TopKV2Layer::run()
+{
+  const auto input_shape = getTensorShape(_input);
+  const auto row_size = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  if (_k < 0 || _k > row_size)
+    throw std::runtime_error{"TopKV2: k must be in [0, size of the last dimension]"};
+  if (_output_indices->data_type() != OperandType::INT32)
+    throw std::runtime_error{"TopKV2: unsupported indices data type"};
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      topKV2<float>();
+      break;
+    case OperandType::INT32:
+      topKV2<int32_t>();
+      break;
+    case OperandType::INT64:
+      topKV2<int64_t>();
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      topKV2<uint8_t>();
+      break;
+    case OperandType::QUANT_INT8_SYMM:
+      topKV2<int8_t>();
+      break;
+    default:
+      throw std::runtime_error{"TopKV2: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+    : _input(nullptr), _kernel(nullptr), _output(nullptr),
+      _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
+      _paddingBottom(0), _strideWidth(0), _strideHeight(0), _output_multiplier(0),
+      _output_shift(0), _output_activation_min(0), _output_activation_max(0),
+      _transpose_conv_kernel(new nnfw::cker::TransposeConv()), _external_context(nullptr),
+      _prepare(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.float_activation_min = std::numeric_limits<float>::lowest();
+  op_params.float_activation_max = std::numeric_limits<float>::max();
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+         [this]() { return _external_context->leaseRuyContext(); });
+}
+
+void TransposeConvLayer::transposeConvQuant8()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = -_kernel->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = _output_activation_min;
+  op_params.quantized_activation_max = _output_activation_max;
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+         getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()),
+         [this]() { return _external_context->leaseRuyContext(); });
+}
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   const ir::PaddingType paddingType, const uint32_t paddingLeft,
+                                   const uint32_t paddingRight, const uint32_t paddingTop,
+                                   const uint32_t paddingBottom, const uint32_t strideWidth,
+                                   const uint32_t strideHeight, IPortableTensor *output,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _kernel = kernel;
+  _paddingType = paddingType;
+  _paddingLeft = paddingLeft;
+  _paddingRight = paddingRight;
+  _paddingTop = paddingTop;
+  _paddingBottom = paddingBottom;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+  _external_context = external_context;
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+
+  if (_input->is_dynamic() || _kernel->is_dynamic() || _output->is_dynamic())
+  {
+    const auto ifm_shape = _input->getShape().asFeature(_input->layout());
+    const auto ofm_shape = _output->getShape().asFeature(_input->layout());
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto ker_shape = _kernel->getShape();
+    const auto ker_height = ker_shape.dim(1);
+    const auto ker_width = ker_shape.dim(2);
+
+    ir::Stride stride;
+    stride.vertical = _strideHeight;
+    stride.horizontal = _strideWidth;
+
+    ir::Padding param_padding;
+    param_padding.type = _paddingType;
+    param_padding.param.left = _paddingLeft;
+    param_padding.param.right = _paddingRight;
+    param_padding.param.top = _paddingTop;
+    param_padding.param.bottom = _paddingBottom;
+
+    // Padding of transpose convolution is that of the convolution from ofm to ifm
+    const auto padding =
+        ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+    _paddingLeft = padding.left;
+    _paddingRight = padding.right;
+    _paddingTop = padding.top;
+    _paddingBottom = padding.bottom;
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel.setEigenDevice(_external_context->eigen_device());
+  if (_kernel->is_constant() && (_input->data_type() == OperandType::FLOAT32 ||
+                                 _input->data_type() == OperandType::QUANT_UINT8_ASYMM))
+  {
+    // Kernels of every execution context share the filter reordered from the same constant
+    util::CompileCache::Key key;
+    key.append(std::string{"cpu.TransposeConv.filter"})
+        .append(_kernel->buffer())
+        .append(_input->data_type());
+    auto shared = _external_context->findPrepared<nnfw::cker::TransposeConv>(key);
+    if (shared)
+    {
+      kernel.share(*shared);
+    }
+    else
+    {
+      if (_input->data_type() == OperandType::FLOAT32)
+      {
+        kernel.prepare(getTensorShape(_kernel),
+                       reinterpret_cast<const float *>(_kernel->buffer()));
+      }
+      else
+      {
+        kernel.prepare(getTensorShape(_kernel),
+                       reinterpret_cast<const uint8_t *>(_kernel->buffer()));
+      }
+      auto prepared = std::make_shared<nnfw::cker::TransposeConv>();
+      prepared->share(kernel);
+      _external_context->addPrepared<nnfw::cker::TransposeConv>(key, prepared);
+    }
+    // The filter is not read any longer once it is reordered
+    releaseConsumedConstant(_kernel);
+  }
+
+  // Quantization parameters of tensors do not change even if their shapes change
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    // The multiplier may exceed one, which MultiplyByQuantizedMultiplier takes as a positive shift
+    const double real_multiplier =
+        _input->data_scale() * _kernel->data_scale() / _output->data_scale();
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+    CalculateActivationRangeUint8(ir::Activation::NONE, _output, &_output_activation_min,
+                                  &_output_activation_max);
+  }
+  _prepare = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
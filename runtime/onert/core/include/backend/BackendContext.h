@@ -32,6 +32,7 @@ class ITensorRegister;
 struct ITensorRegistry;
 struct ITensorBuilder;
 struct IOptimizer;
+struct IExternalContext;
 
 class BackendContext
 {
@@ -68,6 +69,12 @@ public:
   const ir::Graph *graph() const { return _graph; }
   const std::vector<OperationInfo> &operation_list() { return _operation_list; }
   const std::vector<ir::OperandIndex> &operand_list() { return _operand_list; }
+  /**
+   * @brief Returns the context of external libraries that kernels of this backend use
+   *
+   * @return The external context, or nullptr if this backend does not have one
+   */
+  virtual std::shared_ptr<IExternalContext> external_context() { return nullptr; }
 
 private:
   const Backend *_backend{nullptr};
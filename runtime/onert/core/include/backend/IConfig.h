@@ -69,6 +69,12 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether kernels of this backend can run on multiple threads at the same time
+   *
+   * @return true if kernels can run concurrently, otherwise false
+   */
+  virtual bool supportConcurrentExecution() { return false; }
 };
 
 } // namespace backend
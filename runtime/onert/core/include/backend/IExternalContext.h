@@ -17,6 +17,11 @@
 #ifndef __ONERT_BACKEND_IEXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_IEXTERNAL_CONTEXT_H__
 
+#include "exec/ThreadPool.h"
+#include "util/CompileCache.h"
+
+#include <memory>
+
 namespace onert
 {
 namespace backend
@@ -25,7 +30,34 @@ namespace backend
 struct IExternalContext
 {
   virtual ~IExternalContext() = default;
-  virtual void setMaxNumThreads(int) = 0;
+  /**
+   * @brief Set the maximum number of threads that a kernel can use for intra-op parallelism
+   *
+   * @param max_num_threads Number of threads. If it is negative, it is up to the backend.
+   */
+  virtual void setMaxNumThreads(int max_num_threads) = 0;
+  /**
+   * @brief Set the cache where kernels keep data they prepare from constants
+   *
+   * @param cache Cache to use, or nullptr not to use any. Backends without such data ignore it.
+   */
+  virtual void setCompileCache(const std::shared_ptr<util::CompileCache> &) {}
+  /**
+   * @brief Set the thread pool for intra-op parallelism
+   *
+   * @param pool Thread pool that is shared by all backend contexts of a session
+   * @note  Backends whose kernels cannot run on it may still use its size as their thread limit
+   */
+  virtual void setThreadPool(const std::shared_ptr<exec::ThreadPool> &) {}
+  /**
+   * @brief Share what does not depend on a graph, such as data prepared from constants, with
+   *        another external context of the same backend
+   *
+   * @param other External context whose resources this uses from then on
+   * @note  It is called before kernels are generated, so that kernels of all subgraphs and
+   *        execution contexts of a session prepare each constant only once
+   */
+  virtual void share(const IExternalContext &) {}
 };
 
 } // namespace backend
@@ -20,6 +20,8 @@
 #include "backend/ITensor.h"
 #include "ir/Sparsity.h"
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -39,6 +41,11 @@ class IPortableTensor : public ITensor
 public:
   virtual ~IPortableTensor();
   virtual const ir::Sparsity *sparsity() const { return nullptr; }
+  /**
+   * @brief Get scales of channels of a tensor quantized per channel
+   * @return Scales of channels, or empty vector if the tensor is quantized per tensor
+   */
+  virtual const std::vector<float> &data_scales() const;
 
 public:
   bool has_padding() const final { return false; }
@@ -72,6 +72,13 @@ public: // methods for static tensor allocation
    *        NOTE: Useful only for static models
    */
   virtual void notifyLastUse(const ir::OperandIndex &) = 0;
+  /**
+   * @brief Let the tensor builder know that a tensor may reuse memory of another tensor in place
+   *        The operation that defines the first tensor is the last use of the second one.
+   *        Must be called right before calling @c notifyFirstUse of the first tensor
+   *        NOTE: Useful only for static models
+   */
+  virtual void notifyInPlace(const ir::OperandIndex &, const ir::OperandIndex &) {}
   /**
    * @brief Prepare the tensors
    *        Before calling this, all the tensors must be registered
@@ -22,7 +22,12 @@
 #ifndef __ONERT_BACKEND_CPU_COMMON_ALLOCATOR_H__
 #define __ONERT_BACKEND_CPU_COMMON_ALLOCATOR_H__
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -31,22 +36,68 @@ namespace backend
 namespace cpu_common
 {
 
+/**
+ * @brief Alignment of memory allocated by Allocator, which is enough for SIMD kernels
+ */
+constexpr size_t kMemoryAlignment = 64;
+
+/**
+ * @brief Class to recycle aligned memory buffers by size class
+ * @note  Buffers are not returned to the system until the pool is destroyed
+ */
+class MemoryPool
+{
+public:
+  MemoryPool() = default;
+  MemoryPool(const MemoryPool &) = delete;
+  MemoryPool &operator=(const MemoryPool &) = delete;
+  ~MemoryPool();
+
+  /**
+   * @brief Get a buffer that can hold at least @c size bytes
+   * @param[in] size Requested size
+   * @param[out] capacity Actual capacity of the returned buffer, which must be given back
+   *                      on @c release
+   * @return Aligned buffer, which is not initialized
+   */
+  uint8_t *acquire(size_t size, size_t &capacity);
+  /**
+   * @brief Give a buffer back to the pool to be reused
+   */
+  void release(uint8_t *buffer, size_t capacity);
+
+private:
+  std::mutex _mutex;
+  std::unordered_map<size_t, std::vector<uint8_t *>> _free_lists;
+};
+
 /**
  * @brief Class to allocate memory
+ * @note  Allocated memory is aligned to @c kMemoryAlignment and is not initialized
  */
 class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct a new Allocator object whose memory comes from @c pool
+   */
+  Allocator(uint32_t capacity, const std::shared_ptr<MemoryPool> &pool);
+  Allocator(const Allocator &) = delete;
+  Allocator &operator=(const Allocator &) = delete;
+  ~Allocator() { release(); }
+
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
-  uint8_t *base() const { return _base.get(); }
-  void release() { _base.reset(); }
+  uint8_t *base() const { return _base; }
+  void release();
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  uint8_t *_base;
+  size_t _capacity;
+  std::shared_ptr<MemoryPool> _pool;
 };
 
 } // namespace cpu_common
@@ -53,6 +53,14 @@ struct IMemoryPlanner
    * @param[in] index The operand index
    */
   virtual void release(const ir::OperandIndex &) = 0;
+  /**
+   * @brief Let the planner know that an operand may share memory with another operand
+   *        whose lifetime ends where the operand is defined. This is called right before
+   *        claiming the operand and planners may ignore it.
+   * @param[in] index The operand index
+   * @param[in] input_index The index of operand whose memory may be shared
+   */
+  virtual void hintInPlace(const ir::OperandIndex &, const ir::OperandIndex &) {}
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
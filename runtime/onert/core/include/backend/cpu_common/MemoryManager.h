@@ -44,12 +44,19 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  void hintInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &input_ind);
+  /**
+   * @brief Get the peak arena size planned so far, which is the size allocated by allocate()
+   * @return The peak arena size in bytes
+   */
+  uint32_t capacity() const { return _mem_planner->capacity(); }
+  const std::string &planner_id() const { return _planner_id; }
 
 private:
-  IMemoryPlanner *createMemoryPlanner();
   IMemoryPlanner *createMemoryPlanner(const std::string);
 
 private:
+  std::string _planner_id;
   ir::OperandIndexMap<Block> _tensor_mem_map;
   std::shared_ptr<IMemoryPlanner> _mem_planner;
   std::shared_ptr<Allocator> _mem_alloc;
@@ -58,7 +65,7 @@ private:
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  DynamicMemoryManager();
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
@@ -66,7 +73,11 @@ public:
   void deallocate(void);
 
 private:
+  // Dynamic tensors of operations run concurrently by the Parallel executor share this manager
+  std::mutex _mutex;
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  // Buffers of dynamic tensors are recycled across runs instead of being freed
+  std::shared_ptr<MemoryPool> _mem_pool;
 };
 
 } // namespace cpu_common
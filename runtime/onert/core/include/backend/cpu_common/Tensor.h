@@ -75,6 +75,14 @@ public:
     _buffer = alloc->base();
   }
 
+  // This works just as setBuffer but it simply overwrite existing buffer without nullptr check
+  // NOTE This is only for static tensors, which do not have Allocator
+  void overwriteBuffer(uint8_t *buffer)
+  {
+    assert(_allocator == nullptr);
+    _buffer = buffer;
+  }
+
   /**
    * @brief Mark this tensor does not have memory.
    *        Real memory deallocation should be done by caller.
@@ -85,6 +93,12 @@ public:
     _buffer = nullptr;
   }
 
+  /**
+   * @brief Release memory allocated by DynamicMemoryManager if any, and mark this tensor does not
+   *        have memory
+   */
+  void deallocBuffer();
+
 public:
   uint8_t *buffer() const override { return _buffer; }
   /**
@@ -110,6 +124,7 @@ public:
   void set_dynamic() override { _info.setDynamic(); }
   bool applyShape(const ir::Shape &new_shape) override;
   const ir::Sparsity *sparsity() const override { return _info.typeInfo().sparsity(); }
+  const std::vector<float> &data_scales() const override { return _info.typeInfo().scales(); }
 
   virtual void increase_ref()
   {
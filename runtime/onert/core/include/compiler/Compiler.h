@@ -24,10 +24,17 @@
 
 #include "ir/Graph.h"
 #include "exec/IExecutor.h"
+#include "exec/ThreadPool.h"
 
 namespace onert
 {
 
+namespace backend
+{
+class Backend;
+struct IExternalContext;
+} // namespace backend
+
 namespace compiler
 {
 
@@ -55,11 +62,21 @@ struct CompilerOptions
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
+  int parallel_threads;       //< Number of threads for Parallel executor (hardware threads if <= 0)
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
-  bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
-  bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool he_scheduler;         //< HEScheduler if true, ManualScheduler otherwise
+  bool he_profiling_mode;    //< Whether HEScheduler profiling mode ON/OFF
+  bool disable_compile;      //< Run with Interpreter if true, try compilation otherwise
+  bool fp16_enable;          //< Whether fp16 mode ON/OFF
+  int num_exec_contexts;     //< Number of execution contexts that can run at the same time
+  int num_threads;           //< Number of threads that run kernels of all execution contexts,
+                             //< including callers of kernels (no limit if <= 0)
+  int shape_plan_cache_size; //< Number of input shapes whose plans are cached (disabled if <= 0)
+  bool zero_copy_io;         //< Whether tensors use user buffers of model inputs/outputs directly
+  std::string cache_dir;     //< Directory to cache data prepared by kernels (disabled if empty)
+  int cache_max_size;        //< Total size of cached data in MB (unlimited if <= 0)
+  std::string cache_model_key; //< Hash of the model file to identify constants (hash data if empty)
+  bool disable_op_fusion;    //< Keep trailing operations as they are instead of fusing them
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -94,6 +111,11 @@ public:
    */
   bool checkCompilable();
   CompilerOptions &options() { return _options; }
+  /**
+   * @brief   Get the number of operations removed by OperationFusionPass over all subgraphs
+   * @return  The count of the last compilation, or 0 if fusion did not run
+   */
+  uint32_t fused_count() const { return _fused_count; }
 
   /**
    * @brief   Allow to compute float32 using float16 data type
@@ -102,6 +124,14 @@ public:
 
 private:
   void checkProfilerConditions();
+  /**
+   * @brief   Lower all subgraphs and create their executors
+   * @param[in] dump_graph Whether to dump graphs with the graph dump level option
+   * @param[in] thread_pool Thread pool for intra-op parallelism, or nullptr not to limit threads
+   * @return  std::shared_ptr<exec::ExecutorMap> Executors which own their tensors and kernels
+   */
+  std::shared_ptr<exec::ExecutorMap>
+  createExecutors(bool dump_graph, const std::shared_ptr<exec::ThreadPool> &thread_pool);
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
@@ -113,6 +143,10 @@ private:
   // subgraph is called.
   State _state;
   CompilerOptions _options;
+  uint32_t _fused_count = 0;
+  // The first external context of each backend, which the others share while compiling
+  std::unordered_map<const backend::Backend *, std::shared_ptr<backend::IExternalContext>>
+      _external_contexts;
 };
 
 } // namespace compiler
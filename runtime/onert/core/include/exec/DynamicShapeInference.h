@@ -56,6 +56,7 @@ public:
   void visit(const ir::operation::Comparison &op) override;
   void visit(const ir::operation::Concat &op) override;
   void visit(const ir::operation::Conv2D &op) override;
+  void visit(const ir::operation::DepthToSpace &op) override;
   void visit(const ir::operation::ElementwiseActivation &op) override;
   void visit(const ir::operation::ElementwiseBinary &op) override;
   void visit(const ir::operation::ElementwiseUnary &op) override;
@@ -64,7 +65,9 @@ public:
   void visit(const ir::operation::FullyConnected &op) override;
   void visit(const ir::operation::FusedBatchNorm &op) override;
   void visit(const ir::operation::Gather &op) override;
+  void visit(const ir::operation::InstanceNorm &op) override;
   void visit(const ir::operation::L2Normalization &op) override;
+  void visit(const ir::operation::LocalResponseNormalization &op) override;
   void visit(const ir::operation::MatrixBandPart &op) override;
   void visit(const ir::operation::OneHot &op) override;
   void visit(const ir::operation::Pack &op) override;
@@ -72,10 +75,12 @@ public:
   void visit(const ir::operation::Permute &op) override;
   void visit(const ir::operation::Pow &op) override;
   // TODO write op starting from Q
+  void visit(const ir::operation::PReLU &op) override;
   void visit(const ir::operation::Range &op) override;
   void visit(const ir::operation::Reduce &op) override;
   void visit(const ir::operation::Reshape &op) override;
   void visit(const ir::operation::ResizeBilinear &op) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &op) override;
   void visit(const ir::operation::Reverse &op) override;
   void visit(const ir::operation::Select &op) override;
   void visit(const ir::operation::Shape &op) override;
@@ -87,6 +92,7 @@ public:
   void visit(const ir::operation::StridedSlice &op) override;
   void visit(const ir::operation::SquaredDifference &op) override;
   void visit(const ir::operation::Tile &op) override;
+  void visit(const ir::operation::TopKV2 &op) override;
   void visit(const ir::operation::Transpose &op) override;
   void visit(const ir::operation::Unpack &op) override;
   // TODO write op starting from V
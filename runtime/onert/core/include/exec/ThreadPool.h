@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_THREAD_POOL_H__
+#define __ONERT_EXEC_THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "exec/IFunction.h"
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Each worker thread has its own job deque. A worker runs jobs from the front of its own deque
+ * first, so jobs are run in the order they were enqueued, and steals jobs from the back of other
+ * workers' deques when its own deque is empty. Worker threads live until the pool is destroyed so
+ * that they are reused across executions.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @brief Coustruct ThreadPool object
+   *
+   * @param num_threads Number of threads
+   */
+  ThreadPool(uint32_t num_threads = 1);
+  /**
+   * @brief Destroy ThreadPool object after the jobs that are enqueued already are finished
+   */
+  ~ThreadPool();
+  /**
+   * @brief Enqueue a function
+   *
+   * @param fn A function to be queued
+   * @note  If it is called on a worker thread of this pool, the function is pushed to the deque
+   *        of the worker. Otherwise, deques are chosen in round-robin order.
+   */
+  void enqueue(std::unique_ptr<IFunction> &&fn);
+  /**
+   * @brief Enqueue a callable object
+   *
+   * @param fn A callable object to be queued
+   */
+  void enqueue(std::function<void()> fn);
+  /**
+   * @brief Get number of jobs that are queued but not started yet
+   *
+   * @return Number of jobs
+   */
+  uint32_t numJobsInQueue();
+  /**
+   * @brief Get number of worker threads
+   *
+   * @return Number of threads
+   */
+  uint32_t numThreads() const { return static_cast<uint32_t>(_threads.size()); }
+  /**
+   * @brief Get index of the worker thread that calls this
+   *
+   * @return Index in [0, numThreads()), or -1 if the caller is not a worker thread of this pool
+   */
+  int currentWorkerIndex() const;
+
+  /**
+   * @brief Block until all jobs are finished
+   * @note  Worker threads are not terminated, so jobs can be enqueued again after this
+   */
+  void finish();
+
+private:
+  struct Worker
+  {
+    std::deque<std::unique_ptr<IFunction>> jobs;
+    std::mutex mu;
+  };
+
+private:
+  void work(uint32_t worker_index);
+  bool pop(uint32_t worker_index, std::unique_ptr<IFunction> &fn);
+  bool steal(uint32_t thief_index, std::unique_ptr<IFunction> &fn);
+
+private:
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::vector<std::thread> _threads;
+  std::mutex _mu;
+  std::condition_variable _cv_jobs;
+  std::condition_variable _cv_finish;
+  uint32_t _num_queued_jobs{0};     //< Jobs that are in deques and not reserved by workers
+  uint32_t _num_unfinished_jobs{0}; //< Jobs that are enqueued and not finished
+  bool _terminating{false};
+  std::atomic<uint32_t> _next_worker{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_THREAD_POOL_H__
@@ -95,6 +95,19 @@ public:
 public:
   const uint8_t *base(void) const override { return _mmap_base + _offset; }
 
+  /**
+   * @brief Let the pages of mapped data be dropped from memory
+   * @note  Data stays valid at the same address, since the pages are read from the file again
+   *        when they are accessed
+   */
+  void releaseResidentPages(void) const
+  {
+    if (_mmap_size > 0)
+    {
+      madvise(const_cast<uint8_t *>(_mmap_base), _mmap_size, MADV_DONTNEED);
+    }
+  }
+
 private:
   const uint8_t *_mmap_base;
   size_t _mmap_size;
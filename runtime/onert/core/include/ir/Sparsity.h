@@ -48,7 +48,7 @@ public:
    */
   const uint16_t *w1_indices() const { return _w1_indices.data(); }
   /**
-   * @brief Returns block size which is used for block sparsity
+   * @brief Returns block size as {rows, cols}, which is empty for random sparsity
    */
   const std::vector<int32_t> &block_size() const { return _block_size; }
 
@@ -35,7 +35,8 @@ public:
   TypeInfo() = delete;
 
   explicit TypeInfo(DataType type, float scale = 0, int32_t offset = 0)
-      : _type(type), _scale(scale), _offset(offset), _sparsity(nullptr)
+      : _type(type), _scale(scale), _offset(offset), _scales(), _quantized_dimension(0),
+        _sparsity(nullptr)
   {
   }
 
@@ -43,6 +44,12 @@ public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
   int32_t offset() const { return _offset; }
+  // Scales of channels, which are given only if quantized per channel
+  const std::vector<float> &scales() const { return _scales; }
+  void scales(const std::vector<float> &scales) { _scales = scales; }
+  // Axis of the channels that have their own scales
+  int32_t quantized_dimension() const { return _quantized_dimension; }
+  void quantized_dimension(int32_t dimension) { _quantized_dimension = dimension; }
   const ir::Sparsity *sparsity() const { return _sparsity.get(); }
   void sparsity(std::shared_ptr<ir::Sparsity> sparsity) { _sparsity = sparsity; }
 
@@ -54,6 +61,8 @@ private:
   // for quantization
   float _scale;
   int32_t _offset;
+  std::vector<float> _scales;
+  int32_t _quantized_dimension;
   // for sparsity
   std::shared_ptr<ir::Sparsity> _sparsity;
 };
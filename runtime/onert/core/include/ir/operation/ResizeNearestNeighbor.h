@@ -43,6 +43,7 @@ public:
     int32_t height_out;
     int32_t width_out;
     bool align_corners;
+    bool half_pixel_centers;
   };
 
 public:
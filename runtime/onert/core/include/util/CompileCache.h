@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_UTIL_COMPILE_CACHE_H__
+#define __ONERT_UTIL_COMPILE_CACHE_H__
+
+#include "ir/Data.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Directory of data that kernels prepare from constants, kept across sessions
+ *
+ * Entries are addressed by a hash of everything the data is derived from, such as the weights
+ * and kernel parameters, so there is no need to invalidate them. Weights are identified by the
+ * hash of the model file and their operand index when they are registered by @c addConstant,
+ * and by a hash of their contents otherwise. Loaded entries are memory-mapped read-only, so
+ * processes using the same model share their pages.
+ *
+ * @note Weights prepacked by ruy are kept in the cache of ruy, which cannot be exported, so they
+ *       are not stored here.
+ */
+class CompileCache
+{
+public:
+  /**
+   * @brief 128-bit hash of the inputs of the cached data
+   */
+  class Key
+  {
+  public:
+    Key &append(const void *data, size_t size);
+    template <typename T> Key &append(const T &value)
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be hashed");
+      return append(&value, sizeof(T));
+    }
+    Key &append(const std::string &str) { return append(str.data(), str.size()); }
+
+    std::string str() const;
+
+  private:
+    uint64_t _h1 = 0x6a09e667f3bcc908ULL;
+    uint64_t _h2 = 0xbb67ae8584caa73bULL;
+    uint64_t _length = 0;
+  };
+
+public:
+  /**
+   * @param dir Directory of entries, which is created if it does not exist
+   * @param max_size Total size in bytes the entries may take. The least recently used entries
+   *                 are removed to stay under it. Unlimited if 0.
+   */
+  explicit CompileCache(const std::string &dir, size_t max_size = 0);
+
+public:
+  /**
+   * @brief Hash the contents of a file, which is meant to be done once per model file
+   * @return Hash string, or an empty string if the file cannot be read
+   */
+  static std::string hashFile(const std::string &path);
+
+  /**
+   * @brief Identify a constant by @c identity instead of its contents
+   * @param data Address of the constant data that kernels read
+   * @param identity Key that changes whenever the data can change, e.g. made of the hash of the
+   *                 model file and the operand index
+   */
+  void addConstant(const void *data, const Key &identity);
+  /**
+   * @brief Start a key of data derived from a constant
+   * @return The identity given to @c data by @c addConstant, or a hash of @c size bytes of it
+   */
+  Key constantKey(const void *data, size_t size) const;
+
+  /**
+   * @brief Load data stored with @c key
+   * @return Memory-mapped data, or nullptr if there is no valid entry
+   */
+  std::shared_ptr<ir::Data> load(const Key &key) const;
+
+  /**
+   * @brief Store data with @c key
+   * @note  Failure is not an error as the data can be prepared again. The entry is written to a
+   *        temporary file and renamed, so concurrent loads never see a partial entry.
+   */
+  void store(const Key &key, const void *data, size_t size) const;
+
+private:
+  std::string path(const Key &key) const;
+  void evict(size_t incoming_size) const;
+
+private:
+  std::string _dir;
+  size_t _max_size;
+  std::unordered_map<const void *, Key> _constants;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_COMPILE_CACHE_H__
@@ -55,6 +55,8 @@ ir::Shape inferConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape
                            const ir::operation::Conv2D::Param &param,
                            ir::Layout layout = ir::Layout::NHWC);
 
+ir::Shape inferDepthToSpaceShape(const ir::Shape &in_shape, const int32_t block_size);
+
 ir::Shape inferDepthwiseConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape,
                                     const ir::operation::DepthwiseConv2D::Param &param,
                                     ir::Layout layout = ir::Layout::NHWC);
@@ -135,6 +137,8 @@ ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSlic
 ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier,
                          const int32_t multiplier_size);
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, const int32_t k);
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm, const int32_t rank);
 
 ir::Shape inferUnpackShape(const ir::Shape &input_shape, int axis, int rank);
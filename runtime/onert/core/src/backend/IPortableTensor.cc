@@ -25,5 +25,11 @@ namespace backend
 // With this as a key function, `dynamic_cast` works across dl
 IPortableTensor::~IPortableTensor() {}
 
+const std::vector<float> &IPortableTensor::data_scales() const
+{
+  static const std::vector<float> per_tensor_scales;
+  return per_tensor_scales;
+}
+
 } // namespace backend
 } // namespace onert
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CONTROLFLOW_EXTERNAL_CONTEXT_H__
+#define __ONERT_BACKEND_CONTROLFLOW_EXTERNAL_CONTEXT_H__
+
+#include <backend/IExternalContext.h>
+#include <exec/ThreadPool.h>
+
+#include <memory>
+
+namespace onert
+{
+namespace backend
+{
+namespace controlflow
+{
+
+class ExternalContext : public IExternalContext
+{
+public:
+  void setMaxNumThreads(int) override {}
+
+  void setThreadPool(const std::shared_ptr<exec::ThreadPool> &pool) override
+  {
+    _thread_pool = pool;
+  }
+
+  /**
+   * @brief Returns the thread pool of the session that permutations are split onto
+   * @return The thread pool, or nullptr if permutations run on the caller thread only
+   */
+  const std::shared_ptr<exec::ThreadPool> &thread_pool() const { return _thread_pool; }
+
+private:
+  std::shared_ptr<exec::ThreadPool> _thread_pool;
+};
+
+} // namespace controlflow
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CONTROLFLOW_EXTERNAL_CONTEXT_H__
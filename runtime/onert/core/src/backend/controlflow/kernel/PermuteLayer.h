@@ -17,6 +17,7 @@
 #ifndef __ONERT_BACKEND_CONTROLFLOW_KERNEL_PERMUTELAYER_H__
 #define __ONERT_BACKEND_CONTROLFLOW_KERNEL_PERMUTELAYER_H__
 
+#include "../ExternalContext.h"
 #include "backend/ITensorBuilder.h"
 #include "exec/IPermuteFunction.h"
 #include "exec/IExecutor.h"
@@ -33,11 +34,13 @@ namespace kernel
 class PermuteLayer : public onert::exec::IPermuteFunction
 {
 public:
-  PermuteLayer(const std::vector<ITensor *> &src_tensors, const std::vector<ITensor *> &dst_tensors)
+  PermuteLayer(const std::vector<ITensor *> &src_tensors, const std::vector<ITensor *> &dst_tensors,
+               const std::shared_ptr<ExternalContext> &external_context)
   {
     assert(src_tensors.size() == dst_tensors.size());
     _src_tensors = src_tensors;
     _dst_tensors = dst_tensors;
+    _thread_pool = external_context->thread_pool();
   }
 
   void optimize() override
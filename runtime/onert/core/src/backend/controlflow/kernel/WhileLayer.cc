@@ -21,6 +21,93 @@
 #include <misc/polymorphic_downcast.h>
 #include "PermuteLayer.h"
 
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::backend;
+
+/**
+ * @brief Loop-carried tensors that share double buffers instead of being copied on every iteration
+ */
+struct LoopCarriedTensors
+{
+  size_t index;
+  cpu_common::Tensor *body_input;
+  cpu_common::Tensor *body_output;
+  cpu_common::Tensor *cond_input; //< nullptr if cond subgraph does not use it
+  // Buffers planned for the tensors, which are restored after the loop
+  uint8_t *body_input_buffer;
+  uint8_t *body_output_buffer;
+  uint8_t *cond_input_buffer;
+};
+
+cpu_common::Tensor *asStaticNativeTensor(ITensor *tensor)
+{
+  auto native_tensor = dynamic_cast<cpu_common::Tensor *>(tensor);
+  if (native_tensor == nullptr || native_tensor->is_dynamic() || native_tensor->is_constant() ||
+      native_tensor->buffer() == nullptr)
+    return nullptr;
+  return native_tensor;
+}
+
+bool isSameTensorType(const ITensor &lhs, const ITensor &rhs)
+{
+  return lhs.layout() == rhs.layout() && lhs.data_type() == rhs.data_type() &&
+         lhs.getShape() == rhs.getShape() && lhs.total_size() == rhs.total_size();
+}
+
+/**
+ * @brief Find loop-carried tensors which the next iteration can read in place, that is, body
+ *        outputs whose type is the same as that of body inputs (and cond inputs)
+ */
+std::vector<LoopCarriedTensors> findLoopCarriedTensors(exec::ExecutorBase *cond_exec,
+                                                       exec::ExecutorBase *body_exec)
+{
+  const auto &cond_graph = cond_exec->graph();
+  const auto &body_graph = body_exec->graph();
+  const auto &cond_inputs = cond_exec->getInputTensors();
+  const auto &cond_outputs = cond_exec->getOutputTensors();
+  const auto &body_inputs = body_exec->getInputTensors();
+  const auto &body_outputs = body_exec->getOutputTensors();
+  auto count = [](const std::vector<ITensor *> &tensors, const ITensor *tensor) {
+    return std::count(tensors.begin(), tensors.end(), tensor);
+  };
+
+  std::vector<LoopCarriedTensors> ret;
+  for (size_t i = 0; i < body_inputs.size(); ++i)
+  {
+    const auto &body_input_index = body_graph.getInputs().at(i);
+    if (body_graph.operands().at(body_input_index).getUses().size() == 0 ||
+        body_graph.getOutputs().contains(body_input_index))
+      continue;
+
+    auto body_input = asStaticNativeTensor(body_inputs.at(i));
+    auto body_output = asStaticNativeTensor(body_outputs.at(i));
+    if (body_input == nullptr || body_output == nullptr || count(body_inputs, body_output) > 0 ||
+        count(body_outputs, body_input) > 0 || count(body_outputs, body_output) > 1 ||
+        !isSameTensorType(*body_input, *body_output))
+      continue;
+
+    cpu_common::Tensor *cond_input = nullptr;
+    if (cond_graph.operands().at(cond_graph.getInputs().at(i)).getUses().size() > 0)
+    {
+      cond_input = asStaticNativeTensor(cond_inputs.at(i));
+      if (cond_input == nullptr || count(cond_inputs, cond_input) > 1 ||
+          count(cond_outputs, cond_input) > 0 || !isSameTensorType(*cond_input, *body_output))
+        continue;
+    }
+
+    ret.push_back({i, body_input, body_output, cond_input, body_input->buffer(),
+                   body_output->buffer(), cond_input ? cond_input->buffer() : nullptr});
+  }
+  return ret;
+}
+
+} // namespace
+
 namespace onert
 {
 namespace backend
@@ -34,10 +121,12 @@ WhileLayer::WhileLayer(const std::vector<backend::ITensor *> input_tensors,
                        const std::vector<backend::ITensor *> output_tensors,
                        const ir::OperandIndexSequence &output_indices, const ir::Graph &graph,
                        const ir::SubgraphIndex &cond_subg_index,
-                       const ir::SubgraphIndex &body_subg_index, exec::ExecutorMap *executor_map)
+                       const ir::SubgraphIndex &body_subg_index, exec::ExecutorMap *executor_map,
+                       const std::shared_ptr<ExternalContext> &external_context)
     : _cond_subg_index{cond_subg_index}, _body_subg_index{body_subg_index},
       _output_indices{output_indices}, _graph{graph}, _input_tensors{input_tensors},
-      _output_tensors{output_tensors}, _executor_map{executor_map}
+      _output_tensors{output_tensors}, _executor_map{executor_map},
+      _external_context{external_context}
 {
   // At this point, executor_map may not have executors of cond subg and body subg
 }
@@ -54,6 +143,8 @@ void WhileLayer::run()
   // // Run cond subg
   // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
   // "_dst_tensors"
+  // Loop-carried tensors which can be read in place are not copied between iterations. Body inputs
+  // and outputs of them are bound to double buffers that are swapped on every iteration.
   auto cond_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
       _executor_map->at(_cond_subg_index).get());
   auto body_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
@@ -62,6 +153,13 @@ void WhileLayer::run()
   const auto &cond_graph = cond_exec->graph();
   const auto &body_graph = body_exec->graph();
 
+  const auto loop_carried_tensors = findLoopCarriedTensors(cond_exec, body_exec);
+  std::vector<bool> is_loop_carried(_input_tensors.size(), false);
+  for (const auto &tensors : loop_carried_tensors)
+  {
+    is_loop_carried[tensors.index] = true;
+  }
+
   std::vector<backend::ITensor *> input_tensors;
   std::vector<backend::ITensor *> cond_input_tensors;
   std::vector<backend::ITensor *> body_input_tensors;
@@ -81,7 +179,7 @@ void WhileLayer::run()
     }
   }
   const auto permute_op_input_to_cond_input =
-      std::make_shared<PermuteLayer>(input_tensors, cond_input_tensors);
+      std::make_shared<PermuteLayer>(input_tensors, cond_input_tensors, _external_context);
 
   // Add only used tensors among outputs of while operation
   assert(_output_indices.size() == _input_tensors.size());
@@ -99,7 +197,7 @@ void WhileLayer::run()
     }
   }
   const auto permute_op_input_to_op_output =
-      std::make_shared<PermuteLayer>(input_tensors, output_tensors);
+      std::make_shared<PermuteLayer>(input_tensors, output_tensors, _external_context);
 
   // Add all tensors with unused tensors in body subgraph because unused input tensors will be
   // copied output tensors in body subgraph
@@ -107,13 +205,15 @@ void WhileLayer::run()
   input_tensors = _input_tensors;
   body_input_tensors = body_exec->getInputTensors();
   const auto permute_op_input_to_body_input =
-      std::make_shared<PermuteLayer>(input_tensors, body_input_tensors);
+      std::make_shared<PermuteLayer>(input_tensors, body_input_tensors, _external_context);
 
   // Add only used tensors in cond subgraph
   assert(cond_graph.getInputs().size() == body_exec->getOutputTensors().size());
   assert(cond_graph.getInputs().size() == cond_exec->getInputTensors().size());
   body_output_tensors.clear();
   cond_input_tensors.clear();
+  std::vector<backend::ITensor *> uncarried_body_output_tensors;
+  std::vector<backend::ITensor *> uncarried_cond_input_tensors;
   for (uint32_t i = 0; i < cond_graph.getInputs().size(); ++i)
   {
     const auto &cond_input = cond_graph.operands().at(cond_graph.getInputs().at(i));
@@ -121,16 +221,25 @@ void WhileLayer::run()
     {
       body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
       cond_input_tensors.emplace_back(cond_exec->getInputTensors().at(i));
+      if (!is_loop_carried[i])
+      {
+        uncarried_body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
+        uncarried_cond_input_tensors.emplace_back(cond_exec->getInputTensors().at(i));
+      }
     }
   }
   const auto permute_body_output_to_cond_input =
-      std::make_shared<PermuteLayer>(body_output_tensors, cond_input_tensors);
+      std::make_shared<PermuteLayer>(body_output_tensors, cond_input_tensors, _external_context);
+  const auto permute_uncarried_body_output_to_cond_input = std::make_shared<PermuteLayer>(
+      uncarried_body_output_tensors, uncarried_cond_input_tensors, _external_context);
 
   // Add only used tensors in body subgraph
   assert(body_graph.getInputs().size() == body_exec->getOutputTensors().size());
   assert(body_graph.getInputs().size() == body_exec->getInputTensors().size());
   body_output_tensors.clear();
   body_input_tensors.clear();
+  uncarried_body_output_tensors.clear();
+  std::vector<backend::ITensor *> uncarried_body_input_tensors;
   for (uint32_t i = 0; i < body_graph.getInputs().size(); ++i)
   {
     const auto &body_input_index = body_graph.getInputs().at(i);
@@ -140,10 +249,17 @@ void WhileLayer::run()
     {
       body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
       body_input_tensors.emplace_back(body_exec->getInputTensors().at(i));
+      if (!is_loop_carried[i])
+      {
+        uncarried_body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
+        uncarried_body_input_tensors.emplace_back(body_exec->getInputTensors().at(i));
+      }
     }
   }
   const auto permute_body_output_to_body_input =
-      std::make_shared<PermuteLayer>(body_output_tensors, body_input_tensors);
+      std::make_shared<PermuteLayer>(body_output_tensors, body_input_tensors, _external_context);
+  const auto permute_uncarried_body_output_to_body_input = std::make_shared<PermuteLayer>(
+      uncarried_body_output_tensors, uncarried_body_input_tensors, _external_context);
 
   // Add only used tensors among outputs of while operation
   assert(_output_indices.size() == body_exec->getOutputTensors().size());
@@ -161,14 +277,16 @@ void WhileLayer::run()
     }
   }
   const auto permute_body_output_to_op_output =
-      std::make_shared<PermuteLayer>(body_output_tensors, output_tensors);
+      std::make_shared<PermuteLayer>(body_output_tensors, output_tensors, _external_context);
 
   // Remove copying of unused tensor
   permute_op_input_to_cond_input->prepare();
   permute_op_input_to_op_output->prepare();
   permute_op_input_to_body_input->prepare();
   permute_body_output_to_cond_input->prepare();
+  permute_uncarried_body_output_to_cond_input->prepare();
   permute_body_output_to_body_input->prepare();
+  permute_uncarried_body_output_to_body_input->prepare();
   permute_body_output_to_op_output->prepare();
 
   VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
@@ -189,29 +307,103 @@ void WhileLayer::run()
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
   };
 
+  // Whether loop-carried tensors are bound to double buffers
+  bool carrying = false;
+
   const auto body_execute_with_body_outputs = [&]() {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(body_exec->getOutputTensors(), permute_body_output_to_body_input);
+    body_exec->execute(body_exec->getOutputTensors(),
+                       carrying ? permute_uncarried_body_output_to_body_input
+                                : permute_body_output_to_body_input);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
   };
 
   std::function<void()> body_execute = body_execute_with_op_inputs;
   const auto cond_execute = [&]() {
     VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-    cond_exec->execute(body_exec->getOutputTensors(), permute_body_output_to_cond_input);
+    cond_exec->execute(body_exec->getOutputTensors(),
+                       carrying ? permute_uncarried_body_output_to_cond_input
+                                : permute_body_output_to_cond_input);
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
   };
   auto permute_to_outputs_fn = permute_op_input_to_op_output;
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor))
+  // Each loop-carried tensor has two buffers. Body inputs use one of them and body outputs (and
+  // cond inputs) use the other, and they are swapped on every iteration.
+  size_t input_buffer_index = 0;
+  const auto bind_double_buffers = [&]() {
+    for (const auto &tensors : loop_carried_tensors)
+    {
+      const size_t size = (tensors.body_input->total_size() + cpu_common::kMemoryAlignment - 1) /
+                          cpu_common::kMemoryAlignment * cpu_common::kMemoryAlignment;
+      auto &buffer = _loop_buffers[tensors.index];
+      if (buffer == nullptr)
+        buffer = std::make_unique<cpu_common::Allocator>(2 * size);
+
+      const auto input_buffer = buffer->base() + input_buffer_index * size;
+      const auto output_buffer = buffer->base() + (1 - input_buffer_index) * size;
+      tensors.body_input->overwriteBuffer(input_buffer);
+      tensors.body_output->overwriteBuffer(output_buffer);
+      if (tensors.cond_input)
+        tensors.cond_input->overwriteBuffer(output_buffer);
+    }
+    input_buffer_index = 1 - input_buffer_index;
+  };
+  // Tensors can become dynamic in the loop, and then they are allocated by dynamic tensor manager
+  const auto is_carrying_valid = [&]() {
+    return std::all_of(loop_carried_tensors.begin(), loop_carried_tensors.end(),
+                       [](const LoopCarriedTensors &tensors) {
+                         return !tensors.body_input->is_dynamic() &&
+                                !tensors.body_output->is_dynamic() &&
+                                (!tensors.cond_input || !tensors.cond_input->is_dynamic());
+                       });
+  };
+  // Body outputs keep their current buffers so that they are copied to inputs after this
+  const auto stop_carrying = [&]() {
+    for (const auto &tensors : loop_carried_tensors)
+    {
+      if (!tensors.body_input->is_dynamic())
+        tensors.body_input->overwriteBuffer(tensors.body_input_buffer);
+      if (tensors.cond_input && !tensors.cond_input->is_dynamic())
+        tensors.cond_input->overwriteBuffer(tensors.cond_input_buffer);
+    }
+    carrying = false;
+  };
+  const auto restore_buffers = [&]() {
+    stop_carrying();
+    for (const auto &tensors : loop_carried_tensors)
+    {
+      if (!tensors.body_output->is_dynamic())
+        tensors.body_output->overwriteBuffer(tensors.body_output_buffer);
+    }
+  };
+
+  try
+  {
+    carrying = !loop_carried_tensors.empty();
+
+    // Loop while Cond subgraph's output is true
+    while (getResultCond(cond_output_tensor))
+    {
+      if (carrying && !is_carrying_valid())
+        stop_carrying();
+      if (carrying)
+        bind_double_buffers();
+      body_execute();
+      if (carrying && !is_carrying_valid())
+        stop_carrying();
+      cond_execute();
+      body_execute = body_execute_with_body_outputs;
+      permute_to_outputs_fn = permute_body_output_to_op_output;
+    }
+    permute_to_outputs_fn->run();
+  }
+  catch (...)
   {
-    body_execute();
-    cond_execute();
-    body_execute = body_execute_with_body_outputs;
-    permute_to_outputs_fn = permute_body_output_to_op_output;
+    restore_buffers();
+    throw;
   }
-  permute_to_outputs_fn->run();
+  restore_buffers();
 }
 
 } // namespace kernel
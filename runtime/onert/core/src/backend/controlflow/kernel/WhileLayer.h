@@ -17,12 +17,18 @@
 #ifndef __ONERT_BACKEND_CONTROLFLOW_KERNEL_WHILE_LAYER_H__
 #define __ONERT_BACKEND_CONTROLFLOW_KERNEL_WHILE_LAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/ITensor.h>
+#include <backend/cpu_common/Allocator.h>
 #include <exec/IExecutor.h>
 #include <exec/IFunction.h>
 #include <ir/OperandIndexSequence.h>
 #include <ir/Graph.h>
 
+#include <memory>
+#include <unordered_map>
+
 namespace onert
 {
 namespace backend
@@ -39,7 +45,8 @@ public:
              const std::vector<backend::ITensor *> output_tensors,
              const ir::OperandIndexSequence &output_indices, const ir::Graph &graph,
              const ir::SubgraphIndex &cond_subg_index, const ir::SubgraphIndex &body_subg_index,
-             exec::ExecutorMap *executor_map);
+             exec::ExecutorMap *executor_map,
+             const std::shared_ptr<ExternalContext> &external_context);
 
 public:
   void run() override;
@@ -52,6 +59,9 @@ private:
   const std::vector<backend::ITensor *> _input_tensors;
   const std::vector<backend::ITensor *> _output_tensors;
   exec::ExecutorMap *_executor_map;
+  const std::shared_ptr<ExternalContext> _external_context;
+  // Double buffers of loop-carried tensors by index of While operation's input
+  std::unordered_map<size_t, std::unique_ptr<cpu_common::Allocator>> _loop_buffers;
 };
 
 } // namespace kernel
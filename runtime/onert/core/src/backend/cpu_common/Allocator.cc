@@ -18,6 +18,11 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
 namespace onert
 {
 namespace backend
@@ -25,12 +30,95 @@ namespace backend
 namespace cpu_common
 {
 
-Allocator::Allocator(uint32_t capacity)
+namespace
+{
+
+size_t alignedSize(size_t size)
+{
+  // Never allocate 0 bytes to get a valid base pointer always
+  size = std::max(size, static_cast<size_t>(1));
+  return (size + kMemoryAlignment - 1) / kMemoryAlignment * kMemoryAlignment;
+}
+
+// Power of 2 size classes so that buffers of dynamic tensors whose sizes vary over runs can be
+// reused
+size_t sizeClass(size_t size)
+{
+  size_t capacity = kMemoryAlignment;
+  while (capacity < size)
+    capacity <<= 1;
+  return capacity;
+}
+
+uint8_t *allocateAligned(size_t capacity)
+{
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, kMemoryAlignment, capacity) != 0)
+    throw std::bad_alloc{};
+  return static_cast<uint8_t *>(ptr);
+}
+
+} // namespace
+
+MemoryPool::~MemoryPool()
+{
+  for (auto &free_list : _free_lists)
+  {
+    for (auto buffer : free_list.second)
+      std::free(buffer);
+  }
+}
+
+uint8_t *MemoryPool::acquire(size_t size, size_t &capacity)
+{
+  capacity = sizeClass(size);
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto &free_list = _free_lists[capacity];
+    if (!free_list.empty())
+    {
+      auto buffer = free_list.back();
+      free_list.pop_back();
+      return buffer;
+    }
+  }
+  return allocateAligned(capacity);
+}
+
+void MemoryPool::release(uint8_t *buffer, size_t capacity)
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  std::lock_guard<std::mutex> lock{_mutex};
+  _free_lists[capacity].push_back(buffer);
+}
+
+Allocator::Allocator(uint32_t capacity) : _capacity{alignedSize(capacity)}, _pool{nullptr}
+{
+  _base = allocateAligned(_capacity);
 
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
-  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
+  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base) << std::endl;
+}
+
+Allocator::Allocator(uint32_t capacity, const std::shared_ptr<MemoryPool> &pool) : _pool{pool}
+{
+  assert(_pool);
+  _base = _pool->acquire(capacity, _capacity);
+
+  VERBOSE(ALLOC) << "allocation capacity: " << capacity << " (pooled " << _capacity << ")"
+                 << std::endl;
+  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base) << std::endl;
+}
+
+void Allocator::release()
+{
+  if (_base == nullptr)
+    return;
+
+  if (_pool)
+    _pool->release(_base, _capacity);
+  else
+    std::free(_base);
+  _base = nullptr;
 }
 
 } // namespace cpu_common
@@ -20,6 +20,7 @@
 
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
+#include "util/logging.h"
 
 namespace onert
 {
@@ -28,23 +29,18 @@ namespace backend
 namespace cpu_common
 {
 
-MemoryManager::MemoryManager() : _mem_planner{createMemoryPlanner()}
+MemoryManager::MemoryManager()
+    : MemoryManager(util::getConfigString(util::config::CPU_MEMORY_PLANNER))
 {
   // DO NOTHING
 }
 
 MemoryManager::MemoryManager(const std::string planner_id)
-    : _mem_planner{createMemoryPlanner(planner_id)}
+    : _planner_id{planner_id}, _mem_planner{createMemoryPlanner(planner_id)}
 {
   // DO NOTHING
 }
 
-cpu_common::IMemoryPlanner *MemoryManager::createMemoryPlanner()
-{
-  auto planner_id = util::getConfigString(util::config::CPU_MEMORY_PLANNER);
-  return cpu_common::MemoryPlannerFactory::get().create(planner_id);
-}
-
 cpu_common::IMemoryPlanner *MemoryManager::createMemoryPlanner(const std::string planner_id)
 {
   return cpu_common::MemoryPlannerFactory::get().create(planner_id);
@@ -52,15 +48,26 @@ cpu_common::IMemoryPlanner *MemoryManager::createMemoryPlanner(const std::string
 
 void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
 {
-  _mem_planner->claim(ind, size);
+  // Keep every tensor in the arena aligned as well as the base pointer
+  const uint32_t aligned_size =
+      (size + kMemoryAlignment - 1) / kMemoryAlignment * kMemoryAlignment;
+  _mem_planner->claim(ind, aligned_size);
 }
 
 void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->release(ind); }
 
+void MemoryManager::hintInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &input_ind)
+{
+  _mem_planner->hintInPlace(ind, input_ind);
+}
+
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<cpu_common::Allocator>(_mem_planner->capacity());
+  _mem_alloc = std::make_shared<cpu_common::Allocator>(capacity());
   assert(_mem_alloc->base());
+
+  VERBOSE(MemoryManager) << "Peak arena size of " << _planner_id << " planner: " << capacity()
+                         << " bytes" << std::endl;
 }
 
 uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
@@ -70,19 +77,27 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+DynamicMemoryManager::DynamicMemoryManager() : _mem_pool{std::make_shared<MemoryPool>()}
+{
+  // DO NOTHING
+}
+
 std::shared_ptr<cpu_common::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                       uint32_t capacity)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   auto find = _mem_alloc_map.find(tensor);
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<cpu_common::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  auto alloc = std::make_shared<cpu_common::Allocator>(capacity, _mem_pool);
+  _mem_alloc_map[tensor] = alloc;
+  return alloc;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   auto find = _mem_alloc_map.find(tensor);
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
@@ -93,6 +108,7 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
 
 void DynamicMemoryManager::deallocate(void)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   for (auto &mem_alloc : _mem_alloc_map)
   {
     // Release memory buffer of mem_alloc
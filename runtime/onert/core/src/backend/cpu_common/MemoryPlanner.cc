@@ -210,6 +210,61 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+void InPlacePlanner::hintInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &input_ind)
+{
+  _hints[ind] = input_ind;
+}
+
+void InPlacePlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(size != 0);
+
+  auto hint = _hints.find(ind);
+  if (hint != _hints.end() && _live_operands.find(hint->second) != _live_operands.end())
+  {
+    const auto root = _roots.at(hint->second);
+    if (size <= _sizes.at(root))
+    {
+      _roots[ind] = root;
+      _sizes[ind] = size;
+      _num_live_sharers[root]++;
+      _live_operands.emplace(ind);
+
+      VERBOSE(IP_PLANNER) << "claim(#" << ind.value() << "): in-place of #" << root.value()
+                          << std::endl;
+      return;
+    }
+  }
+
+  _planner.claim(ind, size);
+  _roots[ind] = ind;
+  _sizes[ind] = size;
+  _num_live_sharers[ind] = 1;
+  _live_operands.emplace(ind);
+}
+
+void InPlacePlanner::release(const ir::OperandIndex &ind)
+{
+  const auto root = _roots.at(ind);
+  _live_operands.erase(ind);
+
+  assert(_num_live_sharers[root] > 0);
+  if (--_num_live_sharers[root] == 0)
+    _planner.release(root);
+}
+
+InPlacePlanner::MemoryPlans &InPlacePlanner::memory_plans()
+{
+  const auto &root_plans = _planner.memory_plans();
+  for (const auto &pair : _roots)
+  {
+    const auto &ind = pair.first;
+    const auto &root = pair.second;
+    _mem_plans[ind] = {root_plans.at(root).offset, _sizes.at(ind)};
+  }
+  return _mem_plans;
+}
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
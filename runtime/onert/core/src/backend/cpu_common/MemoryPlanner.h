@@ -153,6 +153,54 @@ private:
   std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
 };
 
+/**
+ * @brief Class to plan memory by WIC algorithm with in-place reuse
+ *        An operand that is hinted by @c hintInPlace shares the memory of the hinted operand
+ *        if it is still alive and large enough. Operands sharing memory are planned as one operand
+ *        whose lifetime ends when all of them are released.
+ */
+class InPlacePlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Claim memory for operand by sharing hinted operand's memory or by WIC algorithm
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Keep the hint to be used at claim
+   * @param[in] index The operand index
+   * @param[in] input_index The index of operand whose memory may be shared
+   */
+  void hintInPlace(const ir::OperandIndex &, const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override { return _planner.capacity(); }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+
+private:
+  WICPlanner _planner;
+  MemoryPlans _mem_plans;
+  ir::OperandIndexMap<ir::OperandIndex> _hints;
+  // Operand whose memory is shared by each operand (itself if it does not share memory)
+  ir::OperandIndexMap<ir::OperandIndex> _roots;
+  ir::OperandIndexMap<size_t> _sizes;
+  ir::OperandIndexMap<uint32_t> _num_live_sharers;
+  std::unordered_set<ir::OperandIndex> _live_operands;
+};
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
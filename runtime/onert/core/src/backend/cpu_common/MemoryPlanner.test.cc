@@ -17,12 +17,38 @@
 #include <gtest/gtest.h>
 
 #include "MemoryPlanner.h"
+#include "backend/cpu_common/MemoryManager.h"
 #include "ir/Index.h"
 
 TEST(Allocator, allocate_test)
 {
   ::onert::backend::cpu_common::Allocator allocator(1024);
   ASSERT_NE(allocator.base(), nullptr);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(allocator.base()) %
+                ::onert::backend::cpu_common::kMemoryAlignment,
+            0);
+}
+
+TEST(Allocator, pooled_allocate_test)
+{
+  auto pool = std::make_shared<::onert::backend::cpu_common::MemoryPool>();
+
+  uint8_t *base = nullptr;
+  {
+    ::onert::backend::cpu_common::Allocator allocator(1000, pool);
+    base = allocator.base();
+    ASSERT_NE(base, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(base) % ::onert::backend::cpu_common::kMemoryAlignment,
+              0);
+  }
+
+  // A buffer of the same size class is reused
+  ::onert::backend::cpu_common::Allocator allocator(1024, pool);
+  ASSERT_EQ(allocator.base(), base);
+
+  // A buffer in use is not given to others
+  ::onert::backend::cpu_common::Allocator other(1024, pool);
+  ASSERT_NE(other.base(), base);
 }
 
 TEST(BumpPlanner, claim_test)
@@ -191,3 +217,88 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(InPlacePlanner, claim_release_test)
+{
+  ::onert::backend::cpu_common::InPlacePlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto hint = [&planner](uint32_t index, uint32_t input_index) {
+    planner.hintInPlace(onert::ir::OperandIndex{index}, onert::ir::OperandIndex{input_index});
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  claim(0, 20);
+  hint(1, 0);
+  claim(1, 20);
+  release(0);
+  hint(2, 1);
+  claim(2, 20);
+  release(1);
+  claim(3, 10);
+  // Too large to reuse memory of #3
+  hint(4, 3);
+  claim(4, 20);
+  release(2);
+  release(3);
+  release(4);
+
+  // #0, #1 and #2 share the same memory
+  verify(0, 20, 0);
+  verify(1, 20, 0);
+  verify(2, 20, 0);
+
+  verify(4, 20, 20);
+  verify(3, 10, 40);
+
+  ASSERT_EQ(planner.capacity(), 50);
+}
+
+TEST(MemoryManager, capacity_test)
+{
+  // A chain of two in-place operations followed by two smaller tensors
+  auto plan = [](const std::string &planner_id) {
+    ::onert::backend::cpu_common::MemoryManager mgr{planner_id};
+    auto claim = [&mgr](uint32_t index, uint32_t size) {
+      mgr.claimPlan(onert::ir::OperandIndex{index}, size);
+    };
+    auto hint = [&mgr](uint32_t index, uint32_t input_index) {
+      mgr.hintInPlace(onert::ir::OperandIndex{index}, onert::ir::OperandIndex{input_index});
+    };
+    auto release = [&mgr](uint32_t index) { mgr.releasePlan(onert::ir::OperandIndex{index}); };
+
+    claim(0, 256);
+    hint(1, 0);
+    claim(1, 256);
+    release(0);
+    hint(2, 1);
+    claim(2, 256);
+    release(1);
+    claim(3, 128);
+    release(2);
+    claim(4, 128);
+    release(3);
+    release(4);
+    return mgr.capacity();
+  };
+
+  ASSERT_EQ(plan("Bump"), 1024);
+  ASSERT_EQ(plan("FirstFit"), 512);
+  ASSERT_EQ(plan("WIC"), 512);
+  ASSERT_EQ(plan("InPlace"), 384);
+}
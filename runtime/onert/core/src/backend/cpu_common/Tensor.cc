@@ -43,6 +43,16 @@ size_t Tensor::calcOffset(const ir::Coordinates &coords) const
 
 void Tensor::setShape(const ir::Shape &new_shape) { _info.shape(new_shape); }
 
+void Tensor::deallocBuffer()
+{
+  if (_allocator != nullptr)
+  {
+    assert(_dynamic_mem_mgr);
+    _dynamic_mem_mgr->deallocate(this);
+  }
+  resetBuffer();
+}
+
 bool Tensor::applyShape(const ir::Shape &new_shape)
 {
   bool previously_dynamic = is_dynamic();
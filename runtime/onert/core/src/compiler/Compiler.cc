@@ -23,30 +23,178 @@
 #include "Fp32ToFp16Converter.h"
 
 #include <backend/controlflow/Config.h>
+#include "backend/IExternalContext.h"
 #include "compiler/BackendManager.h"
 #include "compiler/IScheduler.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
 #include "compiler/StaticShapeInference.h"
+#include "compiler/pass/ConstantFoldingPass.h"
 #include "compiler/pass/ConstantOutputPass.h"
+#include "compiler/pass/OperationFusionPass.h"
 #include "compiler/pass/PassRunner.h"
 #include "exec/ExecTime.h"
+#include "exec/MultiContextExecutor.h"
+#include "exec/ThreadPool.h"
 #include "ir/operation/LowerInfo.h"
 #include "ir/verifier/Verifier.h"
 #include "dumper/dot/DotDumper.h"
 #include "compiler/Linear.h"
 #include "interp/InterpExecutor.h"
+#include "util/CompileCache.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+
 namespace onert
 {
 
 namespace compiler
 {
 
+namespace
+{
+
+// Whether OperationFusionPass runs, which makes new constants for fused operations
+bool fusesOperations(const CompilerOptions &options)
+{
+  // Fusion replaces operations with new ones of new indices, which OP_BACKEND_MAP cannot follow
+  return !options.disable_op_fusion && options.manual_scheduler_options.index_to_backend.empty();
+}
+
+/**
+ * @brief Give backends the cache of data prepared by kernels if a cache directory is given
+ */
+void setCompileCache(const LoweredGraph &lowered_graph, const ir::SubgraphIndex &subg_index,
+                     const CompilerOptions &options)
+{
+  if (options.cache_dir.empty())
+    return;
+
+  const size_t max_size = std::max(options.cache_max_size, 0);
+  auto cache = std::make_shared<util::CompileCache>(options.cache_dir, max_size * 1024 * 1024);
+
+  // Constants of the model file are identified by their operand index. Others, such as those
+  // made by passes, have the same indices as long as the passes run the same way.
+  if (!options.cache_model_key.empty())
+  {
+    const auto &graph = lowered_graph.graph();
+    graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+      if (!obj.isConstant())
+        return;
+      util::CompileCache::Key identity;
+      identity.append(options.cache_model_key)
+          .append(fusesOperations(options))
+          .append(subg_index.value())
+          .append(ind.value());
+      cache->addConstant(obj.data()->base(), identity);
+    });
+  }
+
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    auto external_context = pair.second->external_context();
+    if (external_context)
+      external_context->setCompileCache(cache);
+  }
+}
+
+/**
+ * @brief Let external contexts share resources with the first external context of their backend
+ */
+void shareExternalContexts(
+    const LoweredGraph &lowered_graph,
+    std::unordered_map<const backend::Backend *, std::shared_ptr<backend::IExternalContext>>
+        &first_contexts)
+{
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    auto external_context = pair.second->external_context();
+    if (!external_context)
+      continue;
+    const auto &first = first_contexts.emplace(pair.first, external_context).first->second;
+    if (first != external_context)
+      external_context->share(*first);
+  }
+}
+
+/**
+ * @brief Threads that NUM_THREADS is split into
+ *
+ * NUM_THREADS bounds the threads that run kernels of a session. Kernels are called by up to
+ * num_callers threads at the same time, which are the threads of users for each execution context
+ * or the workers of the Parallel executor. The other threads help the callers: the intra-op thread
+ * pool that all subgraphs and execution contexts share, and the workers of ruy, which cannot run
+ * on the pool and keep up to (max_num_threads - 1) threads besides the caller per ruy context that
+ * runs at the same time. So the pool takes half of the rest, and ruy of each caller takes an equal
+ * share of the other half. Idle workers of the Parallel executor, which has its own workers for
+ * each subgraph and backend, are not counted.
+ */
+struct ThreadBudget
+{
+  int num_callers;
+  int num_intra_op_threads;
+  int num_ruy_threads;
+};
+
+ThreadBudget splitThreads(const CompilerOptions &options)
+{
+  ThreadBudget budget;
+  budget.num_callers = static_cast<int>(ExecutorFactory::numInterOpThreads(options)) *
+                       std::max(options.num_exec_contexts, 1);
+  const int num_helpers = std::max(options.num_threads - budget.num_callers, 0);
+  // The pool needs one thread at least, which goes beyond NUM_THREADS only if callers take all
+  budget.num_intra_op_threads = std::max((num_helpers + 1) / 2, 1);
+  budget.num_ruy_threads =
+      1 + std::max(num_helpers - budget.num_intra_op_threads, 0) / budget.num_callers;
+  return budget;
+}
+
+/**
+ * @brief Create the thread pool that kernels use for intra-op parallelism
+ *
+ * @return The thread pool, or nullptr if the number of threads is not limited
+ * @note   The pool is shared by all subgraphs and execution contexts so that If/While bodies and
+ *         concurrent executions do not add threads beyond NUM_THREADS
+ */
+std::shared_ptr<exec::ThreadPool> createIntraOpThreadPool(const CompilerOptions &options)
+{
+  if (options.num_threads <= 0)
+    return nullptr;
+
+  const auto budget = splitThreads(options);
+  VERBOSE(Compiler) << "Threads of " << budget.num_callers << " caller(s) : "
+                    << budget.num_intra_op_threads << " on the intra-op pool, "
+                    << budget.num_ruy_threads << " for ruy of each caller" << std::endl;
+  return std::make_shared<exec::ThreadPool>(budget.num_intra_op_threads);
+}
+
+/**
+ * @brief Give backends the thread pool for intra-op parallelism and their share of threads
+ */
+void setThreadPool(const LoweredGraph &lowered_graph, const CompilerOptions &options,
+                   const std::shared_ptr<exec::ThreadPool> &thread_pool)
+{
+  if (!thread_pool)
+    return;
+
+  const auto budget = splitThreads(options);
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    auto external_context = pair.second->external_context();
+    if (external_context)
+    {
+      external_context->setThreadPool(thread_pool);
+      external_context->setMaxNumThreads(budget.num_ruy_threads);
+    }
+  }
+}
+
+} // namespace
+
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
 {
   CompilerOptions options;
@@ -56,10 +204,18 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
+  options.parallel_threads = util::getConfigInt(util::config::PARALLEL_THREADS);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.num_exec_contexts = util::getConfigInt(util::config::EXEC_CONTEXTS);
+  options.num_threads = util::getConfigInt(util::config::NUM_THREADS);
+  options.shape_plan_cache_size = util::getConfigInt(util::config::SHAPE_PLAN_CACHE_SIZE);
+  options.zero_copy_io = util::getConfigBool(util::config::ZERO_COPY_IO);
+  options.cache_dir = util::getConfigString(util::config::COMPILE_CACHE_DIR);
+  options.cache_max_size = util::getConfigInt(util::config::COMPILE_CACHE_MAX_SIZE);
+  options.disable_op_fusion = util::getConfigBool(util::config::DISABLE_OP_FUSION);
 #ifdef RUY_PROFILER
   options.op_seq_max_node = 1;
 #endif
@@ -140,12 +296,6 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
         backend::controlflow::Config::ID;
   }
 
-  // FIXME This is a workaround for bcq operations, should remove it
-  {
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
-  }
-
   {
     VERBOSE(Compiler) << std::boolalpha;
     VERBOSE(Compiler) << "==== Compiler Options ====" << std::endl;
@@ -157,17 +307,44 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
+    VERBOSE(Compiler) << "parallel_threads         : " << _options.parallel_threads << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "num_exec_contexts        : " << _options.num_exec_contexts << std::endl;
+    VERBOSE(Compiler) << "num_threads              : " << _options.num_threads << std::endl;
+    VERBOSE(Compiler) << "shape_plan_cache_size    : " << _options.shape_plan_cache_size
+                      << std::endl;
+    VERBOSE(Compiler) << "zero_copy_io             : " << _options.zero_copy_io << std::endl;
+    VERBOSE(Compiler) << "cache_dir                : " << _options.cache_dir << std::endl;
+    VERBOSE(Compiler) << "cache_max_size           : " << _options.cache_max_size << std::endl;
+    VERBOSE(Compiler) << "cache_model_key          : " << _options.cache_model_key << std::endl;
+    VERBOSE(Compiler) << "disable_op_fusion        : " << _options.disable_op_fusion << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
   }
 
+  const bool fuse_operations = fusesOperations(_options);
+  _fused_count = 0;
+
   _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
+    // Constant folding may turn model outputs into constants, so run it before ConstantOutputPass
+    pass::ConstantFoldingPass folding{subg};
+    folding.run();
+    VERBOSE(Compiler) << "Folded operations : " << folding.folded_count() << std::endl;
+
     // Mandatory passes
     pass::PassRunner{}.append(std::make_unique<pass::ConstantOutputPass>(subg)).run();
+
+    // Optimizations
+    if (fuse_operations)
+    {
+      pass::OperationFusionPass fusion{subg};
+      fusion.run();
+      _fused_count += fusion.fused_count();
+      VERBOSE(Compiler) << "Fused operations : " << fusion.fused_count() << std::endl;
+    }
   });
 
   /***************************************************
@@ -198,10 +375,51 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   if (_options.he_profiling_mode)
     checkProfilerConditions();
 
+  // Each execution context owns its own lowered graphs, tensors and kernels so that executions on
+  // different contexts do not touch the same non-constant tensors. Constant operand data is shared
+  // among contexts as backends refer to the data of the original operands, and data that kernels
+  // prepare from constants is shared through external contexts.
+  const auto num_contexts = std::max(_options.num_exec_contexts, 1);
+  std::vector<std::shared_ptr<exec::ExecutorMap>> contexts;
+  const auto thread_pool = createIntraOpThreadPool(_options);
+  for (int i = 0; i < num_contexts; ++i)
+  {
+    // Dump graphs only once as all contexts are lowered in the same way
+    contexts.emplace_back(createExecutors(i == 0, thread_pool));
+  }
+
+  _subgraphs->iterate(
+      [&](const ir::SubgraphIndex &, ir::Graph &subg) { subg.setSubgraphs(nullptr); });
+  _subgraphs.reset();
+  _external_contexts.clear();
+
+  if (contexts.size() == 1)
+  {
+    executors = contexts.front();
+  }
+  else
+  {
+    executors = std::make_shared<exec::ExecutorMap>();
+    executors->emplace(ir::SubgraphIndex{0},
+                       std::make_unique<exec::MultiContextExecutor>(std::move(contexts)));
+  }
+
+  /********************************
+   * Code generation phase finished
+   ********************************/
+  _state = State::COMPILED;
+  return executors;
+}
+
+std::shared_ptr<exec::ExecutorMap>
+Compiler::createExecutors(bool dump_graph, const std::shared_ptr<exec::ThreadPool> &thread_pool)
+{
   /***************************************************
    * Backend independent analysis & optimization phase
    ***************************************************/
-  auto dump_level = static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level);
+  auto dump_level = dump_graph
+                        ? static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level)
+                        : dumper::dot::DotDumper::OFF;
 
   // Lower: Assign backend
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
@@ -228,12 +446,8 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
       // NOTE: the only acl_cl backend enables fp16 mode
       Fp32ToFp16Converter(*lowered_subgs[index]).run();
     }
-
-    subg.setSubgraphs(nullptr);
   });
 
-  _subgraphs.reset();
-
   // Shape inference.
   {
     const auto primary_subg_idx = ir::SubgraphIndex{0};
@@ -263,7 +477,7 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
 
-  executors = std::make_shared<exec::ExecutorMap>();
+  auto executors = std::make_shared<exec::ExecutorMap>();
   for (auto &pair : lowered_subgs)
   {
     const auto &subg_index = pair.first;
@@ -278,16 +492,15 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     ir::OperationDumper dumper("START SUBGRAPH " + std::to_string(subg_index.value()));
     lowered_subg->graph().operations().iterate(
         [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
+    shareExternalContexts(*lowered_subg, _external_contexts);
+    setCompileCache(*lowered_subg, subg_index, _options);
+    setThreadPool(*lowered_subg, _options, thread_pool);
     auto executor = std::unique_ptr<exec::IExecutor>{
         ExecutorFactory::get().create(std::move(lowered_subg), _options, executors)};
     executor->setIndexedRanks(indexed_ranks);
     executors->insert(std::make_pair(subg_index, std::move(executor)));
   }
 
-  /********************************
-   * Code generation phase finished
-   ********************************/
-  _state = State::COMPILED;
   return executors;
 }
 
@@ -27,6 +27,7 @@
 #include "compiler/Linear.h"
 #include "compiler/TensorBuilders.h"
 #include "backend/IConstantInitializer.h"
+#include "backend/IExternalContext.h"
 #include "backend/IKernelGenerator.h"
 #include "backend/IOptimizer.h"
 #include "backend/IPortableTensor.h"
@@ -35,7 +36,12 @@
 #include "backend/controlflow/KernelGenerator.h"
 #include "backend/controlflow/UserTensor.h"
 #include "backend/controlflow/TensorBuilder.h"
+#include "backend/cpu_common/Tensor.h"
+#include "ir/operation/Permute.h"
+#include <algorithm>
 #include <memory>
+#include <thread>
+#include <unordered_set>
 
 namespace onert
 {
@@ -66,6 +72,52 @@ private:
   std::shared_ptr<backend::IConfig> _config;
 };
 
+/**
+ * @brief Find tensors that are permuted from model inputs or to model outputs, and let the
+ *        executor bind them to user buffers directly
+ */
+void setZeroCopyTensors(exec::ExecutorBase *exec, const compiler::TensorRegistries &tensor_regs)
+{
+  const auto &graph = exec->graph();
+  std::unordered_set<backend::cpu_common::Tensor *> found_tensors;
+
+  auto find_tensor = [&](const ir::OperationIndex &op_ind,
+                         bool input) -> backend::cpu_common::Tensor * {
+    if (!op_ind.valid())
+      return nullptr;
+    const auto &op = graph.operations().at(op_ind);
+    if (op.opcode() != ir::OpCode::Permute ||
+        static_cast<const ir::operation::Permute &>(op).getPermuteType() !=
+            ir::operation::Permute::Type::COPY)
+      return nullptr;
+
+    const auto ind = input ? op.getOutputs().at(0) : op.getInputs().at(0);
+    if (graph.getInputs().contains(ind) || graph.getOutputs().contains(ind))
+      return nullptr;
+    auto tensor = dynamic_cast<backend::cpu_common::Tensor *>(tensor_regs.getITensor(ind));
+    if (tensor == nullptr || tensor->is_constant() || tensor->is_dynamic() ||
+        tensor->buffer() == nullptr || found_tensors.count(tensor) > 0)
+      return nullptr;
+    found_tensors.emplace(tensor);
+    return tensor;
+  };
+
+  std::vector<backend::cpu_common::Tensor *> inputs;
+  for (const auto &ind : graph.getInputs())
+  {
+    const auto &uses = graph.operands().at(ind).getUses();
+    inputs.emplace_back(uses.size() == 1 ? find_tensor(*uses.begin(), true) : nullptr);
+  }
+
+  std::vector<backend::cpu_common::Tensor *> outputs;
+  for (const auto &ind : graph.getOutputs())
+  {
+    outputs.emplace_back(find_tensor(graph.operands().at(ind).getDef(), false));
+  }
+
+  exec->setZeroCopyTensors(inputs, outputs);
+}
+
 } // namespace
 } // namespace onert
 
@@ -80,6 +132,21 @@ ExecutorFactory &ExecutorFactory::get()
   return singleton;
 }
 
+uint32_t ExecutorFactory::numInterOpThreads(const compiler::CompilerOptions &options)
+{
+  if (options.executor != "Parallel")
+    return 1;
+
+  // Use as many threads as hardware threads if the number of threads is not given
+  uint32_t num_threads =
+      options.parallel_threads > 0
+          ? static_cast<uint32_t>(options.parallel_threads)
+          : std::max(std::thread::hardware_concurrency(), static_cast<uint32_t>(1));
+  if (options.num_threads > 0)
+    num_threads = std::min(num_threads, static_cast<uint32_t>(options.num_threads));
+  return num_threads;
+}
+
 ExecutorFactory::ExecutorFactory()
 {
   _map["Linear"] = createLinearExecutor;
@@ -355,9 +422,17 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     });
   }
 
-  auto exec =
-      new exec::LinearExecutor{std::move(lowered_graph), input_tensors, output_tensors, tensor_regs,
-                               std::move(code_map),      order};
+  const auto shape_plan_cache_size =
+      static_cast<size_t>(std::max(options.shape_plan_cache_size, 0));
+  auto exec = new exec::LinearExecutor{std::move(lowered_graph), input_tensors,
+                                       output_tensors,           tensor_regs,
+                                       std::move(code_map),      order,
+                                       shape_plan_cache_size};
+
+  if (options.is_primary_subgraph && options.zero_copy_io)
+  {
+    setZeroCopyTensors(exec, tensor_regs);
+  }
 
   if (!options.trace_filepath.empty())
   {
@@ -465,7 +540,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   if (parallel)
   {
     exec = new exec::ParallelExecutor{std::move(lowered_graph), input_tensors, output_tensors,
-                                      tensor_regs, std::move(code_map)};
+                                      tensor_regs, std::move(code_map), numInterOpThreads(options)};
   }
   else
   {
@@ -486,6 +561,11 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec = dataflow_exec;
   }
 
+  if (options.is_primary_subgraph && options.zero_copy_io)
+  {
+    setZeroCopyTensors(exec, tensor_regs);
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
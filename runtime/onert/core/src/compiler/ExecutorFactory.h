@@ -39,6 +39,11 @@ public:
                           const compiler::CompilerOptions &options,
                           const std::shared_ptr<exec::ExecutorMap> &executor_map);
 
+  /**
+   * @brief Get the number of threads that run operations concurrently (inter-op parallelism)
+   */
+  static uint32_t numInterOpThreads(const compiler::CompilerOptions &options);
+
 private:
   ExecutorFactory();
 
@@ -62,6 +62,54 @@ void Linear::dump(const compiler::LoweredGraph &lowered_graph,
   }
 }
 
+ir::OperandIndexSequence Linear::getInPlaceCandidates(const ir::Graph &graph,
+                                                      const ir::Operation &op)
+{
+  ir::OperandIndexSequence candidates;
+  if (op.getOutputs().size() != 1 || op.getInputs().size() == 0)
+    return candidates;
+
+  // Operations that only reinterpret the data keep its bytes, while elementwise operations
+  // need the exact shape so that a broadcast input is not aliased
+  bool same_shape_only = true;
+  switch (op.opcode())
+  {
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+    case ir::OpCode::ExpandDims:
+      same_shape_only = false;
+      candidates.append(op.getInputs().at(0));
+      break;
+    case ir::OpCode::ElementwiseActivation:
+      candidates.append(op.getInputs().at(0));
+      break;
+    case ir::OpCode::BinaryArithmetic:
+      candidates = op.getInputs();
+      break;
+    default:
+      return candidates;
+  }
+
+  const auto output_ind = op.getOutputs().at(0);
+  const auto &output = graph.operands().at(output_ind);
+  ir::OperandIndexSequence result;
+  for (const auto &ind : candidates | ir::Remove::UNDEFINED)
+  {
+    const auto &input = graph.operands().at(ind);
+    // Model inputs and outputs are given by users, and constants are not in the arena
+    if (input.isConstant() || graph.getInputs().contains(ind) ||
+        graph.getOutputs().contains(ind) || graph.getOutputs().contains(output_ind))
+      continue;
+    if (input.info().typeInfo().type() != output.info().typeInfo().type())
+      continue;
+    if (same_shape_only ? input.info().shape() != output.info().shape()
+                        : input.operandSize() != output.operandSize())
+      continue;
+    result.append(ind);
+  }
+  return result;
+}
+
 void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
                          const std::vector<ir::OpSequenceIndex> &order)
 {
@@ -157,13 +205,25 @@ void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
     const auto &op_seq = lowered_graph.op_seqs().at(op_seq_ind);
     for (const auto &op_idx : op_seq.operations())
     {
-      for (const auto &ind : graph.operations().at(op_idx).getOutputs() | ir::Remove::DUPLICATED |
-                                 ir::Remove::UNDEFINED)
+      const auto &op = graph.operations().at(op_idx);
+      for (const auto &ind : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
       {
         assert(def_map.find(ind) != def_map.end());
         if (def_map[ind])
         {
           def_map[ind] = 0;
+
+          // Let the output reuse memory of an input that is not used after this operation
+          for (const auto &input_ind : getInPlaceCandidates(graph, op))
+          {
+            if (uses_map[input_ind] == 1 &&
+                tensor_builder_map[input_ind] == tensor_builder_map[ind])
+            {
+              tensor_builder_map[ind]->notifyInPlace(ind, input_ind);
+              break;
+            }
+          }
+
           tensor_builder_map[ind]->notifyFirstUse(ind);
         }
       }
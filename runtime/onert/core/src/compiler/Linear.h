@@ -46,6 +46,13 @@ public:
                    const std::vector<ir::OpSequenceIndex> &order);
   static void planTensors(const compiler::LoweredGraph &lowered_graph,
                           const std::vector<ir::OpSequenceIndex> &order);
+  /**
+   * @brief Get inputs whose memory the output of the operation can reuse in place
+   *        Such operations either do not touch data or compute each output element only from
+   *        input elements at the same position
+   */
+  static ir::OperandIndexSequence getInPlaceCandidates(const ir::Graph &graph,
+                                                       const ir::Operation &op);
 };
 
 } // namespace compiler
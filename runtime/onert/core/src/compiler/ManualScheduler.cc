@@ -70,6 +70,13 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
   }
   // By default, Custom uses cpu backend
   op_type_map[ir::OpCode::Custom] = BackendManager::get().get("cpu");
+  // By default, prefer an external bcq backend for BCQ operations when one is loaded
+  auto bcq_backend = BackendManager::get().get("bcq");
+  if (bcq_backend != nullptr)
+  {
+    op_type_map.emplace(ir::OpCode::BCQFullyConnected, bcq_backend);
+    op_type_map.emplace(ir::OpCode::BCQGather, bcq_backend);
+  }
 
   graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &operation) {
     auto itr = op_type_map.find(operation.opcode());
@@ -17,6 +17,9 @@
 #include "OperationValidator.h"
 
 #include "ir/Graph.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/FullyConnected.h"
 
 #define OP_REQUIRES(EXP)                                                                         \
   do                                                                                             \
@@ -39,8 +42,69 @@ void OperationValidator::operator()()
 {
   assert(_graph.subgraphs() == nullptr);
 
-  _graph.operations().iterate(
-      [&](const ir::OperationIndex &, const ir::Operation &node) { node.accept(*this); });
+  _graph.operations().iterate([&](const ir::OperationIndex &, const ir::Operation &node) {
+    checkPerChannelQuantization(node);
+    node.accept(*this);
+  });
+}
+
+void OperationValidator::checkPerChannelQuantization(const ir::Operation &node)
+{
+  // Only weights and bias of int8 Conv2D, DepthwiseConv2D and FullyConnected may be quantized per
+  // channel, with their output channels as the quantized dimension. Other kernels would read only
+  // the first scale.
+  auto channel_axis = [&](uint32_t input_pos) {
+    const auto input_type = _ctx.at(node.getInputs().at(0)).typeInfo().type();
+    if (input_type != ir::DataType::QUANT_INT8_SYMM)
+      return -1;
+
+    switch (node.opcode())
+    {
+      case ir::OpCode::Conv2D:
+        // Kernel: [depth_out, kernel_height, kernel_width, depth_in]
+        if (input_pos == ir::operation::Conv2D::Input::KERNEL ||
+            input_pos == ir::operation::Conv2D::Input::BIAS)
+          return 0;
+        break;
+      case ir::OpCode::DepthwiseConv2D:
+        // Kernel: [1, kernel_height, kernel_width, depth_out]
+        if (input_pos == ir::operation::DepthwiseConv2D::Input::KERNEL)
+          return 3;
+        if (input_pos == ir::operation::DepthwiseConv2D::Input::BIAS)
+          return 0;
+        break;
+      case ir::OpCode::FullyConnected:
+        // Weights: [num_units, input_size]
+        if (input_pos == ir::operation::FullyConnected::Input::WEIGHT ||
+            input_pos == ir::operation::FullyConnected::Input::BIAS)
+          return 0;
+        break;
+      default:
+        break;
+    }
+    return -1;
+  };
+
+  const auto &inputs = node.getInputs();
+  for (uint32_t pos = 0; pos < inputs.size(); ++pos)
+  {
+    const auto index = inputs.at(pos);
+    if (index.undefined())
+      continue;
+
+    const auto &operand = _ctx.at(index);
+    const auto &scales = operand.typeInfo().scales();
+    if (scales.empty())
+      continue;
+
+    const auto axis = channel_axis(pos);
+    OP_REQUIRES(axis >= 0 && operand.typeInfo().quantized_dimension() == axis);
+    OP_REQUIRES(axis < operand.shape().rank() &&
+                static_cast<size_t>(operand.shape().dim(axis)) == scales.size());
+  }
+
+  for (const auto &index : node.getOutputs() | ir::Remove::UNDEFINED)
+    OP_REQUIRES(_ctx.at(index).typeInfo().scales().empty());
 }
 
 void OperationValidator::visit(const ir::operation::ElementwiseActivation &node)
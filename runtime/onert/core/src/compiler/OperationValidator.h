@@ -45,6 +45,9 @@ public:
 public:
   void visit(const ir::operation::ElementwiseActivation &node) override;
 
+private:
+  void checkPerChannelQuantization(const ir::Operation &node);
+
 private:
   // TODO Remove _ctx field
   const ir::Graph &_graph;
@@ -915,6 +915,31 @@ void ShapeValidator::visit(const ir::operation::ResizeBilinear &node)
   OP_REQUIRES(!align_corners || !half_pixel_centers);
 }
 
+void ShapeValidator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT)};
+
+  if (node.getInputs().size() == 2)
+  {
+    const auto size_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::SIZE)};
+    OP_REQUIRES(_ctx.at(size_index).typeInfo().type() == ir::DataType::INT32);
+    OP_REQUIRES(_ctx.at(size_index).shape() == ir::Shape{2});
+  }
+
+  if (_ctx.at(output_index).info().isDynamic())
+  {
+    return;
+  }
+  OP_REQUIRES(_ctx.at(input_index).shape().rank() == 4);
+  OP_REQUIRES(_ctx.at(output_index).shape().rank() == 4);
+
+  auto align_corners = node.param().align_corners;
+  auto half_pixel_centers = node.param().half_pixel_centers;
+
+  OP_REQUIRES(!align_corners || !half_pixel_centers);
+}
+
 void ShapeValidator::visit(const ir::operation::Reverse &node)
 {
   const auto output_index{node.getOutputs().at(0)};
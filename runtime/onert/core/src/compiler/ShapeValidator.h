@@ -75,6 +75,7 @@ public:
   void visit(const ir::operation::Split &node) override;
   void visit(const ir::operation::Shape &node) override;
   void visit(const ir::operation::ResizeBilinear &node) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &node) override;
   void visit(const ir::operation::Reverse &node) override;
   void visit(const ir::operation::If &node) override;
   void visit(const ir::operation::While &node) override;
@@ -254,6 +254,20 @@ void StaticShapeInferer::visit(const ir::operation::Conv2D &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::DepthToSpace &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::DepthToSpace::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  ir::Shape new_shape =
+      shape_inference::inferDepthToSpaceShape(input.info().shape(), op.param().block_size);
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::ElementwiseActivation &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseActivation::Input::INPUT));
@@ -444,11 +458,22 @@ void StaticShapeInferer::visit(const ir::operation::If &op)
   }
 }
 
+void StaticShapeInferer::visit(const ir::operation::InstanceNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::InstanceNorm::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::L2Normalization &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::LocalResponseNormalization &op)
+{
+  handleSimpleUnaryOp(op,
+                      op.getInputs().at(ir::operation::LocalResponseNormalization::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::MatrixBandPart &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::MatrixBandPart::Input::INPUT));
@@ -549,6 +574,12 @@ void StaticShapeInferer::visit(const ir::operation::Pow &op)
                            op.getInputs().at(ir::operation::Pow::Input::RHS));
 }
 
+void StaticShapeInferer::visit(const ir::operation::PReLU &op)
+{
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::PReLU::Input::INPUT),
+                           op.getInputs().at(ir::operation::PReLU::Input::ALPHA));
+}
+
 void StaticShapeInferer::visit(const ir::operation::Range &op)
 {
   const auto start_idx{op.getInputs().at(ir::operation::Range::Input::START)};
@@ -725,6 +756,46 @@ void StaticShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   }
 }
 
+void StaticShapeInferer::visit(const ir::operation::ResizeNearestNeighbor &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  int32_t height_out, width_out;
+  if (op.getInputs().size() == 2)
+  {
+    auto &size =
+        _operands.at(op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::SIZE));
+    if (!size.isConstant())
+    {
+      output.info().setDynamic();
+      _return_has_dynamic_tensor = true;
+      return;
+    }
+    const auto size_v = size.asVector<std::int32_t>();
+    height_out = size_v[0];
+    width_out = size_v[1];
+  }
+  else
+  {
+    height_out = op.param().height_out;
+    width_out = op.param().width_out;
+  }
+
+  // ResizeNearestNeighbor has the same output shape as ResizeBilinear
+  ir::Shape new_shape =
+      shape_inference::inferResizeBilinearShape(input.shape(), height_out, width_out);
+
+  if (new_shape != output.shape())
+  {
+    output.info().shape(new_shape);
+  }
+}
+
 void StaticShapeInferer::visit(const ir::operation::Reverse &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::Input::INPUT));
@@ -958,6 +1029,21 @@ void StaticShapeInferer::visit(const ir::operation::Tile &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  ir::Shape new_shape = shape_inference::inferTopKV2Shape(input.info().shape(), op.param().k);
+
+  // values and indices have the same shape
+  for (const auto output_idx : op.getOutputs())
+  {
+    ir::Operand &output = _operands.at(output_idx);
+    output.info().shape(new_shape);
+  }
+}
+
 void StaticShapeInferer::visit(const ir::operation::Transpose &op)
 {
   const auto input_idx{op.getInputs().at(ir::operation::Transpose::Input::INPUT)};
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConstantFoldingPass.h"
+
+#include "ir/Graph.h"
+#include "ir/OperationVisitor.h"
+#include "util/ShapeInference.h"
+#include "util/logging.h"
+
+#include <cker/Shape.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Pack.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Transpose.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+namespace
+{
+
+nnfw::cker::Shape convertShape(const ir::Shape &shape)
+{
+  return nnfw::cker::Shape(shape.rank(), shape.dims().data());
+}
+
+// Call @c fn with a value of the C++ type of @c type. Returns false if @c type is not supported.
+template <typename Fn> bool dispatchDataType(ir::DataType type, Fn fn)
+{
+  switch (type)
+  {
+    case ir::DataType::FLOAT32:
+      fn(float{});
+      return true;
+    case ir::DataType::INT32:
+      fn(int32_t{});
+      return true;
+    case ir::DataType::UINT32:
+      fn(uint32_t{});
+      return true;
+    case ir::DataType::UINT8:
+      fn(uint8_t{});
+      return true;
+    case ir::DataType::BOOL8:
+      fn(bool{});
+      return true;
+    case ir::DataType::INT64:
+      fn(int64_t{});
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Call @c fn with an unsigned integer type of @c size bytes, for operations that only move data
+template <typename Fn> bool dispatchElementSize(size_t size, Fn fn)
+{
+  switch (size)
+  {
+    case 1:
+      fn(uint8_t{});
+      return true;
+    case 2:
+      fn(uint16_t{});
+      return true;
+    case 4:
+      fn(uint32_t{});
+      return true;
+    case 8:
+      fn(uint64_t{});
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Compute the output of an operation whose inputs are all constant
+ *
+ * After @c accept(), @c evaluated() tells whether the operation was computed. If so, @c shape()
+ * and @c data() hold the output.
+ */
+class ConstantEvaluator : public ir::OperationVisitor
+{
+public:
+  ConstantEvaluator(const ir::Graph &graph, size_t max_size) : _graph{graph}, _max_size{max_size}
+  {
+  }
+
+public:
+  bool evaluated() const { return _evaluated; }
+  const ir::Shape &shape() const { return _shape; }
+  const std::vector<uint8_t> &data() const { return _data; }
+
+public:
+  void visit(const ir::operation::Concat &op) override;
+  void visit(const ir::operation::ElementwiseUnary &op) override;
+  void visit(const ir::operation::ExpandDims &op) override;
+  void visit(const ir::operation::Fill &op) override;
+  void visit(const ir::operation::Pack &op) override;
+  void visit(const ir::operation::Reshape &op) override;
+  void visit(const ir::operation::Shape &op) override;
+  void visit(const ir::operation::Squeeze &op) override;
+  void visit(const ir::operation::StridedSlice &op) override;
+  void visit(const ir::operation::Transpose &op) override;
+
+private:
+  const ir::Operand &operand(const ir::OperandIndex &index) const
+  {
+    return _graph.operands().at(index);
+  }
+  template <typename T> const T *buffer(const ir::OperandIndex &index) const
+  {
+    return reinterpret_cast<const T *>(operand(index).data()->base());
+  }
+  // Whether operations that only move data can write @c input as @c output
+  bool isSameType(const ir::OperandIndex &input, const ir::OperandIndex &output) const
+  {
+    return operand(input).typeInfo() == operand(output).typeInfo();
+  }
+  // Returns false if the output would be larger than the limit, which leaves it to runtime
+  bool allocate(const ir::Shape &shape, ir::DataType type)
+  {
+    const auto &dims = shape.dims();
+    if (std::any_of(dims.begin(), dims.end(), [](int32_t dim) { return dim < 0; }))
+      return false;
+    const auto elem_size = ir::sizeOfDataType(type);
+    const auto num_elements = shape.num_elements();
+    if (num_elements > _max_size / elem_size)
+      return false;
+    _shape = shape;
+    _data.resize(num_elements * elem_size);
+    return true;
+  }
+  void copyInput(const ir::Operation &op, const ir::Shape &shape);
+
+private:
+  const ir::Graph &_graph;
+  const size_t _max_size;
+  bool _evaluated = false;
+  ir::Shape _shape;
+  std::vector<uint8_t> _data;
+};
+
+void ConstantEvaluator::copyInput(const ir::Operation &op, const ir::Shape &shape)
+{
+  const auto input_index = op.getInputs().at(0);
+  const auto output_index = op.getOutputs().at(0);
+  const auto *data = operand(input_index).data();
+  if (!isSameType(input_index, output_index) || data->size() > _max_size ||
+      shape.num_elements() != operand(input_index).shape().num_elements())
+    return;
+
+  _shape = shape;
+  _data.assign(data->base(), data->base() + data->size());
+  _evaluated = true;
+}
+
+void ConstantEvaluator::visit(const ir::operation::Concat &op)
+{
+  const auto output_index = op.getOutputs().at(0);
+  shape_inference::Shapes input_shapes;
+  std::vector<nnfw::cker::Shape> cker_shapes;
+  for (const auto &input_index : op.getInputs())
+  {
+    if (!isSameType(input_index, output_index))
+      return;
+    input_shapes.emplace_back(operand(input_index).shape());
+    cker_shapes.emplace_back(convertShape(operand(input_index).shape()));
+  }
+
+  const auto rank = input_shapes[0].rank();
+  const auto axis = (op.param().axis < 0) ? op.param().axis + rank : op.param().axis;
+  if (rank > 4 || axis < 0 || axis >= rank)
+    return;
+
+  if (!allocate(shape_inference::inferConcatShape(input_shapes, op.param()),
+                operand(output_index).typeInfo().type()))
+    return;
+
+  nnfw::cker::ConcatenationParams params;
+  params.axis = axis;
+  params.inputs_count = op.getInputs().size();
+  std::vector<const nnfw::cker::Shape *> shape_ptrs;
+  for (const auto &cker_shape : cker_shapes)
+    shape_ptrs.emplace_back(&cker_shape);
+
+  _evaluated = dispatchElementSize(
+      ir::sizeOfDataType(operand(output_index).typeInfo().type()), [&](auto tag) {
+        using T = decltype(tag);
+        std::vector<const T *> input_ptrs;
+        for (const auto &input_index : op.getInputs())
+          input_ptrs.emplace_back(buffer<T>(input_index));
+        nnfw::cker::Concatenation<T>(params, shape_ptrs.data(), input_ptrs.data(),
+                                     convertShape(_shape), reinterpret_cast<T *>(_data.data()));
+      });
+}
+
+void ConstantEvaluator::visit(const ir::operation::ElementwiseUnary &op)
+{
+  if (op.param().op_type != ir::operation::ElementwiseUnary::Type::CAST)
+    return;
+
+  const auto &input = operand(op.getInputs().at(ir::operation::ElementwiseUnary::Input::INPUT));
+  const auto output_type = operand(op.getOutputs().at(0)).typeInfo().type();
+  const auto num_elements = input.shape().num_elements();
+  if (!allocate(input.shape(), output_type))
+    return;
+
+  bool converted = false;
+  const bool supported = dispatchDataType(input.typeInfo().type(), [&](auto in_tag) {
+    using From = decltype(in_tag);
+    const auto *in = reinterpret_cast<const From *>(input.data()->base());
+    converted = dispatchDataType(output_type, [&](auto out_tag) {
+      using To = decltype(out_tag);
+      std::transform(in, in + num_elements, reinterpret_cast<To *>(_data.data()),
+                     [](From a) { return static_cast<To>(a); });
+    });
+  });
+  _evaluated = supported && converted;
+}
+
+void ConstantEvaluator::visit(const ir::operation::ExpandDims &op)
+{
+  const auto &axis = operand(op.getInputs().at(ir::operation::ExpandDims::Input::AXIS));
+  if (axis.typeInfo().type() != ir::DataType::INT32)
+    return;
+
+  const auto &input_shape = operand(op.getInputs().at(0)).shape();
+  const auto axis_value =
+      buffer<int32_t>(op.getInputs().at(ir::operation::ExpandDims::Input::AXIS))[0];
+  copyInput(op, shape_inference::inferExpandDimsShape(input_shape, axis_value));
+}
+
+void ConstantEvaluator::visit(const ir::operation::Fill &op)
+{
+  const auto dims_index = op.getInputs().at(ir::operation::Fill::Input::INPUT);
+  const auto value_index = op.getInputs().at(ir::operation::Fill::Input::VALUE);
+  const auto output_index = op.getOutputs().at(0);
+  if (operand(dims_index).typeInfo().type() != ir::DataType::INT32 ||
+      operand(value_index).shape().num_elements() != 1 || !isSameType(value_index, output_index))
+    return;
+
+  const auto &dims_shape = operand(dims_index).shape();
+  if (!allocate(shape_inference::inferFillShape(dims_shape, buffer<int32_t>(dims_index)),
+                operand(output_index).typeInfo().type()))
+    return;
+
+  // Repeat the bytes of the value, so any element type works
+  const auto *value = operand(value_index).data();
+  for (size_t offset = 0; offset + value->size() <= _data.size(); offset += value->size())
+    std::memcpy(_data.data() + offset, value->base(), value->size());
+  _evaluated = true;
+}
+
+void ConstantEvaluator::visit(const ir::operation::Pack &op)
+{
+  const auto output_index = op.getOutputs().at(0);
+  for (const auto &input_index : op.getInputs())
+  {
+    if (!isSameType(input_index, output_index))
+      return;
+  }
+
+  const auto &input_shape = operand(op.getInputs().at(0)).shape();
+  const auto rank = input_shape.rank() + 1;
+  const auto axis = (op.param().axis < 0) ? op.param().axis + rank : op.param().axis;
+  if (axis < 0 || axis >= rank)
+    return;
+
+  if (!allocate(shape_inference::inferPackShape(input_shape, axis, rank, op.param().num),
+                operand(output_index).typeInfo().type()))
+    return;
+
+  nnfw::cker::PackParams params;
+  params.axis = axis;
+  params.inputs_count = op.getInputs().size();
+
+  _evaluated = dispatchElementSize(
+      ir::sizeOfDataType(operand(output_index).typeInfo().type()), [&](auto tag) {
+        using T = decltype(tag);
+        std::vector<const T *> input_ptrs;
+        for (const auto &input_index : op.getInputs())
+          input_ptrs.emplace_back(buffer<T>(input_index));
+        nnfw::cker::Pack<T>(params, input_ptrs.data(), convertShape(_shape),
+                            reinterpret_cast<T *>(_data.data()));
+      });
+}
+
+void ConstantEvaluator::visit(const ir::operation::Reshape &op)
+{
+  const auto num_elements = operand(op.getInputs().at(0)).shape().num_elements();
+  if (op.getInputs().size() == 2)
+  {
+    const auto shape_index = op.getInputs().at(ir::operation::Reshape::Input::SHAPE);
+    if (operand(shape_index).typeInfo().type() != ir::DataType::INT32)
+      return;
+    copyInput(op, shape_inference::inferReshapeShape(buffer<int32_t>(shape_index),
+                                                     operand(shape_index).shape().num_elements(),
+                                                     num_elements));
+  }
+  else if (op.param().new_shape.size() != 0)
+  {
+    const auto &new_shape = op.param().new_shape;
+    copyInput(op, shape_inference::inferReshapeShape(new_shape.data(), new_shape.size(),
+                                                     num_elements));
+  }
+}
+
+void ConstantEvaluator::visit(const ir::operation::Shape &op)
+{
+  const auto &input_shape = operand(op.getInputs().at(0)).shape();
+  const auto output_type = operand(op.getOutputs().at(0)).typeInfo().type();
+  if (output_type != ir::DataType::INT32 && output_type != ir::DataType::INT64)
+    return;
+
+  ir::Shape output_shape;
+  output_shape.append(input_shape.rank());
+  if (!allocate(output_shape, output_type))
+    return;
+
+  dispatchDataType(output_type, [&](auto tag) {
+    using T = decltype(tag);
+    auto *out = reinterpret_cast<T *>(_data.data());
+    for (int i = 0; i < input_shape.rank(); ++i)
+      out[i] = static_cast<T>(input_shape.dim(i));
+  });
+  _evaluated = true;
+}
+
+void ConstantEvaluator::visit(const ir::operation::Squeeze &op)
+{
+  const auto &input_shape = operand(op.getInputs().at(0)).shape();
+  copyInput(op, shape_inference::inferSqueezeShape(input_shape, op.param()));
+}
+
+void ConstantEvaluator::visit(const ir::operation::StridedSlice &op)
+{
+  const auto input_index = op.getInputs().at(ir::operation::StridedSlice::Input::INPUT);
+  const auto starts_index = op.getInputs().at(ir::operation::StridedSlice::Input::STARTS);
+  const auto ends_index = op.getInputs().at(ir::operation::StridedSlice::Input::ENDS);
+  const auto strides_index = op.getInputs().at(ir::operation::StridedSlice::Input::STRIDES);
+  const auto output_index = op.getOutputs().at(0);
+  const auto &input_shape = operand(input_index).shape();
+  const auto rank = input_shape.rank();
+  if (rank > 4 || !isSameType(input_index, output_index))
+    return;
+  for (const auto &index : {starts_index, ends_index, strides_index})
+  {
+    if (operand(index).typeInfo().type() != ir::DataType::INT32)
+      return;
+  }
+
+  const auto begin_mask = op.param().begin_mask;
+  const auto end_mask = op.param().end_mask;
+  const auto shrink_axis_mask = op.param().shrink_axis_mask;
+  const auto *starts = buffer<uint32_t>(starts_index);
+  const auto *ends = buffer<uint32_t>(ends_index);
+  const auto *strides = buffer<uint32_t>(strides_index);
+
+  const auto shape_params = shape_inference::buildStridedSliceParams(
+      starts, ends, strides, begin_mask, end_mask, shrink_axis_mask, rank);
+  if (!allocate(shape_inference::inferStridedSliceShape(input_shape, shape_params, rank),
+                operand(output_index).typeInfo().type()))
+    return;
+
+  const auto params = nnfw::cker::buildStridedSliceParams(starts, ends, strides, begin_mask,
+                                                          end_mask, shrink_axis_mask, rank);
+  _evaluated = dispatchElementSize(
+      ir::sizeOfDataType(operand(output_index).typeInfo().type()), [&](auto tag) {
+        using T = decltype(tag);
+        nnfw::cker::StridedSlice(params, convertShape(input_shape), buffer<T>(input_index),
+                                 convertShape(_shape), reinterpret_cast<T *>(_data.data()));
+      });
+}
+
+void ConstantEvaluator::visit(const ir::operation::Transpose &op)
+{
+  const auto input_index = op.getInputs().at(ir::operation::Transpose::Input::INPUT);
+  const auto perm_index = op.getInputs().at(ir::operation::Transpose::Input::PERMUTATION);
+  const auto output_index = op.getOutputs().at(0);
+  const auto &input_shape = operand(input_index).shape();
+  const auto &perm = operand(perm_index);
+  const auto rank = input_shape.rank();
+  if (rank > 4 || !isSameType(input_index, output_index))
+    return;
+
+  // An empty permutation means (n-1...0)
+  nnfw::cker::TransposeParams params;
+  params.perm_count = rank;
+  if (perm.shape().num_elements() == 0)
+  {
+    for (int i = 0; i < rank; ++i)
+      params.perm[i] = rank - 1 - i;
+  }
+  else
+  {
+    if (perm.typeInfo().type() != ir::DataType::INT32 ||
+        perm.shape().num_elements() != static_cast<uint64_t>(rank))
+      return;
+    std::copy_n(buffer<int32_t>(perm_index), rank, params.perm);
+  }
+
+  if (!allocate(shape_inference::inferTransposeShape(input_shape, params.perm, rank),
+                operand(output_index).typeInfo().type()))
+    return;
+
+  _evaluated = dispatchElementSize(
+      ir::sizeOfDataType(operand(output_index).typeInfo().type()), [&](auto tag) {
+        using T = decltype(tag);
+        nnfw::cker::Transpose(params, convertShape(input_shape), buffer<T>(input_index),
+                              convertShape(_shape), reinterpret_cast<T *>(_data.data()));
+      });
+}
+
+// Whether @c op can be evaluated now, i.e. all its inputs are constant
+bool isFoldable(const ir::Graph &graph, const ir::Operation &op)
+{
+  if (op.getInputs().size() == 0 || op.getOutputs().size() != 1)
+    return false;
+
+  for (const auto &index : op.getInputs())
+  {
+    if (!index.valid() || !graph.operands().at(index).isConstant())
+      return false;
+  }
+
+  const auto &output = graph.operands().at(op.getOutputs().at(0));
+  return !output.info().isDynamic();
+}
+
+} // namespace
+
+void ConstantFoldingPass::run()
+{
+  _folded_count = 0;
+
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+
+    // Operations are removed while folding, so collect candidates first
+    std::vector<ir::OperationIndex> candidates;
+    _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+      if (isFoldable(_graph, op))
+        candidates.emplace_back(index);
+    });
+
+    for (const auto &index : candidates)
+    {
+      const auto &op = _graph.operations().at(index);
+      ConstantEvaluator evaluator{_graph, _max_folded_size};
+      op.accept(evaluator);
+      if (!evaluator.evaluated())
+        continue;
+
+      VERBOSE(ConstantFoldingPass) << "Fold " << op.name() << "(" << index << ")" << std::endl;
+
+      // Turn the output into a constant and drop the operation
+      const auto output_index = op.getOutputs().at(0);
+      auto &output = _graph.operands().at(output_index);
+      output.info().shape(evaluator.shape());
+      output.data(std::make_unique<ir::CachedData>(evaluator.data().data(),
+                                                    evaluator.data().size()));
+      output.unsetDef();
+
+      const auto inputs = op.getInputs() | ir::Remove::DUPLICATED;
+      for (const auto &input_index : inputs)
+        _graph.operands().at(input_index).removeUse(index);
+      _graph.operations().remove(index);
+
+      // Drop constants that were only used by the folded operation
+      for (const auto &input_index : inputs)
+      {
+        if (!_graph.operands().exist(input_index))
+          continue;
+        const auto &input = _graph.operands().at(input_index);
+        if (input.getUses().size() == 0 && !_graph.getOutputs().contains(input_index))
+          _graph.removeOperand(input_index);
+      }
+
+      _folded_count++;
+      changed = true;
+    }
+  }
+
+  VERBOSE(ConstantFoldingPass) << "Folded " << _folded_count << " operation(s)" << std::endl;
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
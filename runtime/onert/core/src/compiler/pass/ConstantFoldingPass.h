@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_CONSTANT_FOLDING_PASS_H__
+#define __ONERT_COMPILER_PASS_CONSTANT_FOLDING_PASS_H__
+
+#include "Pass.h"
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to evaluate operations whose inputs are all constant at compile time
+ *
+ * Models converted from other frameworks often carry small subgraphs that only depend on
+ * constants, such as Shape -> StridedSlice -> Pack -> Reshape or Transpose/Cast on weights.
+ * This pass evaluates them once and replaces their outputs with constant operands, so they
+ * neither run nor take activation memory at inference time.
+ *
+ * e.g.)
+ *
+ * (Const) -> [Transpose] -> (Operand) -> [Conv2D]
+ *
+ * becomes
+ *
+ * (Const) -> [Conv2D]
+ *
+ * Supported operations are Cast, Concat, ExpandDims, Fill, Pack, Reshape, Shape, Squeeze,
+ * StridedSlice and Transpose. Others are left as they are, and so are outputs larger than the
+ * given limit, since Fill or Concat could otherwise turn into constants of any size.
+ */
+class ConstantFoldingPass : public Pass
+{
+public:
+  /**
+   * @brief Construct a new ConstantFoldingPass object
+   * @param graph Graph to fold
+   * @param max_folded_size Maximum size in bytes of an output to be turned into a constant
+   */
+  ConstantFoldingPass(ir::Graph &graph, size_t max_folded_size = kDefaultMaxFoldedSize)
+      : Pass{graph}, _max_folded_size{max_folded_size}
+  {
+  }
+
+public:
+  static constexpr size_t kDefaultMaxFoldedSize = 1024 * 1024;
+
+public:
+  std::string id() final { return "ConstantFoldingPass"; }
+
+  void run() final;
+
+  /**
+   * @brief Get the number of operations folded in the last @c run()
+   */
+  uint32_t folded_count() const { return _folded_count; }
+
+private:
+  const size_t _max_folded_size;
+  uint32_t _folded_count = 0;
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_CONSTANT_FOLDING_PASS_H__
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FullyConnected.h"
+#include "util/logging.h"
+
+#include <limits>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+namespace
+{
+
+using namespace ir::operation;
+
+// Returns the fused activation equivalent to a ReLU family ElementwiseActivation, or NONE when
+// there is no such activation. Bounds follow what the loaders set (alpha: upper, beta: lower).
+ir::Activation toFusedActivation(const ElementwiseActivation &node)
+{
+  const auto &param = node.param();
+  if (param.op_type != ElementwiseActivation::Type::RELU)
+    return ir::Activation::NONE;
+
+  if (param.beta == 0.f && param.alpha == std::numeric_limits<float>::infinity())
+    return ir::Activation::RELU;
+  if (param.beta == 0.f && param.alpha == 6.f)
+    return ir::Activation::RELU6;
+  if (param.beta == -1.f && param.alpha == 1.f)
+    return ir::Activation::RELU1;
+  return ir::Activation::NONE;
+}
+
+// Get the fused activation of @c op. Returns false if @c op has no fused activation.
+bool getActivation(const ir::Operation &op, ir::Activation &activation)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      activation = static_cast<const Conv2D &>(op).param().activation;
+      return true;
+    case ir::OpCode::DepthwiseConv2D:
+      activation = static_cast<const DepthwiseConv2D &>(op).param().activation;
+      return true;
+    case ir::OpCode::FullyConnected:
+      activation = static_cast<const FullyConnected &>(op).param().activation;
+      return true;
+    case ir::OpCode::BinaryArithmetic:
+      activation = static_cast<const BinaryArithmetic &>(op).param().activation;
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Create a copy of @c op with given inputs, outputs and fused activation
+std::unique_ptr<ir::Operation> cloneWithActivation(const ir::Operation &op,
+                                                   const ir::OperandIndexSequence &inputs,
+                                                   const ir::OperandIndexSequence &outputs,
+                                                   ir::Activation activation)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      auto param = static_cast<const Conv2D &>(op).param();
+      param.activation = activation;
+      return std::make_unique<Conv2D>(inputs, outputs, param);
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      auto param = static_cast<const DepthwiseConv2D &>(op).param();
+      param.activation = activation;
+      return std::make_unique<DepthwiseConv2D>(inputs, outputs, param);
+    }
+    case ir::OpCode::FullyConnected:
+    {
+      auto param = static_cast<const FullyConnected &>(op).param();
+      param.activation = activation;
+      return std::make_unique<FullyConnected>(inputs, outputs, param);
+    }
+    case ir::OpCode::BinaryArithmetic:
+    {
+      auto param = static_cast<const BinaryArithmetic &>(op).param();
+      param.activation = activation;
+      return std::make_unique<BinaryArithmetic>(inputs, outputs, param);
+    }
+    default:
+      throw std::runtime_error{"OperationFusionPass: Unsupported operation " + op.name()};
+  }
+}
+
+// Conv2D, DepthwiseConv2D and FullyConnected share the input order (input, weights, bias)
+static_assert(static_cast<int>(Conv2D::Input::KERNEL) == FullyConnected::Input::WEIGHT &&
+                  static_cast<int>(DepthwiseConv2D::Input::KERNEL) == FullyConnected::Input::WEIGHT,
+              "Weights must be at the same input position");
+static_assert(static_cast<int>(Conv2D::Input::BIAS) == FullyConnected::Input::BIAS &&
+                  static_cast<int>(DepthwiseConv2D::Input::BIAS) == FullyConnected::Input::BIAS,
+              "Bias must be at the same input position");
+
+bool hasBias(ir::OpCode opcode)
+{
+  return opcode == ir::OpCode::Conv2D || opcode == ir::OpCode::DepthwiseConv2D ||
+         opcode == ir::OpCode::FullyConnected;
+}
+
+} // namespace
+
+void OperationFusionPass::run()
+{
+  _fused_count = 0;
+
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+
+    // Operations are replaced while fusing, so collect candidates first
+    std::vector<ir::OperationIndex> candidates;
+    _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+      if (op.opcode() == ir::OpCode::ElementwiseActivation ||
+          op.opcode() == ir::OpCode::BinaryArithmetic)
+        candidates.emplace_back(index);
+    });
+
+    for (const auto &index : candidates)
+    {
+      if (!_graph.operations().exist(index))
+        continue;
+
+      const auto opcode = _graph.operations().at(index).opcode();
+      bool fused = (opcode == ir::OpCode::ElementwiseActivation) ? tryFuseActivation(index)
+                                                                 : tryFuseBinaryArithmetic(index);
+      if (fused)
+      {
+        _fused_count++;
+        changed = true;
+      }
+    }
+  }
+
+  VERBOSE(OperationFusionPass) << "Fused " << _fused_count << " operation(s)" << std::endl;
+}
+
+bool OperationFusionPass::tryFuseActivation(const ir::OperationIndex &index)
+{
+  const auto &node = static_cast<const ElementwiseActivation &>(_graph.operations().at(index));
+  const auto activation = toFusedActivation(node);
+  if (activation == ir::Activation::NONE)
+    return false;
+
+  const auto input_index = node.getInputs().at(ElementwiseActivation::Input::INPUT);
+  const auto output_index = node.getOutputs().at(0);
+  const auto producer_index = fusibleProducer(input_index);
+  if (!producer_index.valid())
+    return false;
+
+  // Quantized kernels clamp with the output quantization, so it has to be the same
+  const auto &input_obj = _graph.operands().at(input_index);
+  const auto &output_obj = _graph.operands().at(output_index);
+  if (input_obj.typeInfo() != output_obj.typeInfo())
+    return false;
+
+  const auto &producer = _graph.operations().at(producer_index);
+  auto fused = cloneWithActivation(producer, producer.getInputs(),
+                                   ir::OperandIndexSequence{output_index}, activation);
+
+  VERBOSE(OperationFusionPass) << "Fuse " << node.name() << "(" << index << ") into "
+                               << producer.name() << "(" << producer_index << ")" << std::endl;
+  replace(producer_index, index, std::move(fused));
+  return true;
+}
+
+bool OperationFusionPass::tryFuseBinaryArithmetic(const ir::OperationIndex &index)
+{
+  const auto &node = static_cast<const BinaryArithmetic &>(_graph.operations().at(index));
+  const auto arithmetic_type = node.param().arithmetic_type;
+  if (arithmetic_type == BinaryArithmetic::ArithmeticType::DIV)
+    return false;
+
+  // Find out which side is the constant. Sub is only foldable as "x - const".
+  const auto lhs_index = node.getInputs().at(BinaryArithmetic::Input::LHS);
+  const auto rhs_index = node.getInputs().at(BinaryArithmetic::Input::RHS);
+  const auto &operands = _graph.operands();
+  ir::OperandIndex data_index, const_index;
+  if (operands.at(rhs_index).isConstant())
+  {
+    data_index = lhs_index;
+    const_index = rhs_index;
+  }
+  else if (operands.at(lhs_index).isConstant() &&
+           arithmetic_type != BinaryArithmetic::ArithmeticType::SUB)
+  {
+    data_index = rhs_index;
+    const_index = lhs_index;
+  }
+  else
+  {
+    return false;
+  }
+
+  const auto producer_index = fusibleProducer(data_index);
+  if (!producer_index.valid())
+    return false;
+  const auto &producer = _graph.operations().at(producer_index);
+  if (!hasBias(producer.opcode()))
+    return false;
+
+  // Only float32 is folded; quantized weights would need requantization
+  const auto output_index = node.getOutputs().at(0);
+  const auto &data_obj = operands.at(data_index);
+  const auto &const_obj = operands.at(const_index);
+  const auto &output_obj = operands.at(output_index);
+  if (data_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+      const_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output_obj.typeInfo().type() != ir::DataType::FLOAT32)
+    return false;
+
+  // The constant must not broadcast the output and must be a scalar or a per-channel vector
+  const auto &out_shape = data_obj.shape();
+  if (out_shape.rank() == 0 || out_shape != output_obj.shape())
+    return false;
+  const auto num_channels = out_shape.dim(out_shape.rank() - 1);
+  const auto &const_shape = const_obj.shape();
+  const auto const_size = const_shape.num_elements();
+  if (const_shape.rank() > out_shape.rank())
+    return false;
+  if (const_size != 1 &&
+      (const_size != static_cast<uint64_t>(num_channels) ||
+       const_shape.dim(const_shape.rank() - 1) != num_channels))
+    return false;
+
+  const auto weights_index = producer.getInputs().at(FullyConnected::Input::WEIGHT);
+  const auto bias_index = producer.getInputs().at(FullyConnected::Input::BIAS);
+  const auto &weights_obj = operands.at(weights_index);
+  const bool scale_weights = (arithmetic_type == BinaryArithmetic::ArithmeticType::MUL);
+  if (scale_weights &&
+      (!weights_obj.isConstant() || weights_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+       weights_obj.typeInfo().sparsity() != nullptr))
+    return false;
+
+  std::vector<float> bias(num_channels, 0.f);
+  if (bias_index.valid())
+  {
+    const auto &bias_obj = operands.at(bias_index);
+    if (!bias_obj.isConstant() || bias_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+        bias_obj.shape().num_elements() != static_cast<uint64_t>(num_channels))
+      return false;
+    bias = bias_obj.asVector<float>();
+  }
+
+  const auto values = const_obj.asVector<float>();
+  auto value = [&](int32_t c) { return values[const_size == 1 ? 0 : c]; };
+
+  ir::OperandIndex new_weights_index = weights_index;
+  if (scale_weights)
+  {
+    // Output channel is the outermost axis of Conv2D (OHWI) and FullyConnected ([O, I]) weights,
+    // and the innermost axis of DepthwiseConv2D ([1, H, W, O]) weights.
+    const auto &weights_shape = weights_obj.shape();
+    const bool channel_last = (producer.opcode() == ir::OpCode::DepthwiseConv2D);
+    const auto channel_dim = weights_shape.dim(channel_last ? weights_shape.rank() - 1 : 0);
+    if (channel_dim != num_channels)
+      return false;
+
+    auto weights = weights_obj.asVector<float>();
+    const size_t inner = weights.size() / num_channels;
+    for (size_t i = 0; i < weights.size(); ++i)
+    {
+      const auto c = channel_last ? i % num_channels : i / inner;
+      weights[i] *= value(c);
+    }
+    new_weights_index = addFloatConstant(weights_shape, weights_obj.typeInfo(), weights);
+  }
+
+  for (int32_t c = 0; c < num_channels; ++c)
+  {
+    switch (arithmetic_type)
+    {
+      case BinaryArithmetic::ArithmeticType::ADD:
+        bias[c] += value(c);
+        break;
+      case BinaryArithmetic::ArithmeticType::SUB:
+        bias[c] -= value(c);
+        break;
+      case BinaryArithmetic::ArithmeticType::MUL:
+        bias[c] *= value(c);
+        break;
+      default:
+        throw std::runtime_error{"OperationFusionPass: Unreachable"};
+    }
+  }
+  const auto new_bias_index = addFloatConstant(ir::Shape{num_channels},
+                                               ir::TypeInfo{ir::DataType::FLOAT32}, bias);
+
+  ir::OperandIndexSequence inputs;
+  inputs.append(producer.getInputs().at(FullyConnected::Input::INPUT));
+  inputs.append(new_weights_index);
+  inputs.append(new_bias_index);
+  auto fused = cloneWithActivation(producer, inputs, ir::OperandIndexSequence{output_index},
+                                   node.param().activation);
+
+  VERBOSE(OperationFusionPass) << "Fuse " << node.name() << "(" << index << ") into "
+                               << producer.name() << "(" << producer_index << ")" << std::endl;
+  replace(producer_index, index, std::move(fused));
+  return true;
+}
+
+ir::OperationIndex OperationFusionPass::fusibleProducer(const ir::OperandIndex &index) const
+{
+  const auto &obj = _graph.operands().at(index);
+  if (obj.isConstant() || obj.getUses().size() != 1 || _graph.getInputs().contains(index) ||
+      _graph.getOutputs().contains(index))
+    return ir::OperationIndex{};
+
+  const auto def = obj.getDef();
+  if (!def.valid())
+    return ir::OperationIndex{};
+
+  const auto &producer = _graph.operations().at(def);
+  ir::Activation activation;
+  if (!getActivation(producer, activation) || activation != ir::Activation::NONE)
+    return ir::OperationIndex{};
+
+  return def;
+}
+
+ir::OperandIndex OperationFusionPass::addFloatConstant(const ir::Shape &shape,
+                                                       const ir::TypeInfo &type,
+                                                       const std::vector<float> &values)
+{
+  const auto index = _graph.addOperand(shape, type);
+  _graph.operands().at(index).data(std::make_unique<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+  return index;
+}
+
+void OperationFusionPass::replace(const ir::OperationIndex &producer_index,
+                                  const ir::OperationIndex &consumer_index,
+                                  std::unique_ptr<ir::Operation> &&fused)
+{
+  auto &operations = _graph.operations();
+  auto &operands = _graph.operands();
+
+  // Detach the two operations being replaced
+  ir::OperandIndexSequence old_inputs;
+  for (const auto &op_index : {producer_index, consumer_index})
+  {
+    const auto &op = operations.at(op_index);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      operands.at(ind).removeUse(op_index);
+      old_inputs.append(ind);
+    }
+  }
+  const auto intermediate_index = operations.at(producer_index).getOutputs().at(0);
+  operations.remove(consumer_index);
+  operations.remove(producer_index);
+
+  // Attach the fused one
+  const auto fused_index = operations.push(std::move(fused));
+  const auto &fused_op = operations.at(fused_index);
+  for (const auto &ind : fused_op.getInputs() | ir::Remove::UNDEFINED)
+    operands.at(ind).insertUse(fused_index);
+  for (const auto &ind : fused_op.getOutputs())
+    operands.at(ind).setDef(fused_index);
+
+  // Drop operands no longer referenced such as the intermediate result and replaced constants
+  _graph.removeOperand(intermediate_index);
+  for (const auto &ind : old_inputs)
+  {
+    if (!operands.exist(ind) || ind == intermediate_index)
+      continue;
+    const auto &obj = operands.at(ind);
+    if (obj.getUses().size() == 0 && !obj.getDef().valid() && !_graph.getInputs().contains(ind) &&
+        !_graph.getOutputs().contains(ind))
+      _graph.removeOperand(ind);
+  }
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
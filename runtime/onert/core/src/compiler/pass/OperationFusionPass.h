@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+
+#include "Pass.h"
+
+#include "ir/Index.h"
+#include "ir/Operation.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to fold simple trailing operations into the operation that produces their input
+ *
+ * Kernels such as Conv2D, DepthwiseConv2D, FullyConnected and BinaryArithmetic already take a
+ * fused activation, and Conv2D, DepthwiseConv2D and FullyConnected take a bias. Models often
+ * express them as separate operations instead, which costs an extra kernel and an extra
+ * intermediate tensor each. This pass rewrites
+ *
+ * - [Conv2D|DepthwiseConv2D|FullyConnected|BinaryArithmetic] -> [ReLU|ReLU1|ReLU6]
+ *   into a single operation with the fused activation set
+ * - [Conv2D|DepthwiseConv2D|FullyConnected] -> [Add|Mul] with a constant per-channel operand
+ *   (float32 only) into a single operation with the bias (and the weights for Mul) updated
+ *
+ * An intermediate operand is only folded away when it has exactly one use and is not a graph
+ * output, so the rewrite never changes what is observable from outside the graph.
+ */
+class OperationFusionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "OperationFusionPass"; }
+
+  void run() final;
+
+  /**
+   * @brief Get the number of operations removed by fusion in the last @c run()
+   */
+  uint32_t fused_count() const { return _fused_count; }
+
+private:
+  bool tryFuseActivation(const ir::OperationIndex &index);
+  bool tryFuseBinaryArithmetic(const ir::OperationIndex &index);
+
+  ir::OperationIndex fusibleProducer(const ir::OperandIndex &index) const;
+  ir::OperandIndex addFloatConstant(const ir::Shape &shape, const ir::TypeInfo &type,
+                                    const std::vector<float> &values);
+  void replace(const ir::OperationIndex &producer_index, const ir::OperationIndex &consumer_index,
+               std::unique_ptr<ir::Operation> &&fused);
+
+private:
+  uint32_t _fused_count = 0;
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
@@ -16,6 +16,7 @@
 
 #include "DataflowExecutor.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "util/logging.h"
@@ -50,12 +51,52 @@ int64_t DataflowExecutor::calculateRank(const std::vector<ir::OperationIndex> &o
   return rank;
 }
 
+void DataflowExecutor::calculateCriticalPathRanks()
+{
+  const auto num_jobs = _output_info.size();
+
+  // Find topological order of jobs
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> input_info = _initial_input_info;
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    if (input_info[i] == 0)
+      order.push_back(i);
+  }
+  for (size_t n = 0; n < order.size(); ++n)
+  {
+    for (auto id : _output_info[order[n]])
+    {
+      assert(input_info[id] > 0);
+      if (--input_info[id] == 0)
+        order.push_back(id);
+    }
+  }
+  assert(order.size() == num_jobs);
+
+  // Accumulate the number of operations from the end of the graph
+  _critical_path_ranks.assign(num_jobs, 0);
+  for (auto it = order.rbegin(); it != order.rend(); ++it)
+  {
+    const auto job_index = *it;
+    int64_t max_successor_rank = 0;
+    for (auto id : _output_info[job_index])
+    {
+      max_successor_rank = std::max(max_successor_rank, _critical_path_ranks[id]);
+    }
+    const auto &op_seq = _lowered_graph->op_seqs().at(_job_to_op_seq[job_index]);
+    _critical_path_ranks[job_index] =
+        static_cast<int64_t>(op_seq.operations().size()) + max_successor_rank;
+  }
+}
+
 void DataflowExecutor::emplaceToReadyJobs(const uint32_t &id)
 {
   auto &job = _waiting_jobs[id];
   assert(job != nullptr);
   auto &op_seq = _lowered_graph->op_seqs().at(_job_to_op_seq[job->index()]);
-  auto rank = calculateRank(op_seq.operations());
+  // Run jobs on the critical path first if there is no ranks from the scheduler
+  auto rank = _indexed_ranks ? calculateRank(op_seq.operations()) : _critical_path_ranks[id];
   _ready_jobs.emplace(rank, std::move(job));
 }
 
@@ -123,6 +164,8 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
     _job_to_op_seq.emplace(s.second, s.first);
 
   _input_info = _initial_input_info;
+
+  calculateCriticalPathRanks();
 }
 
 void DataflowExecutor::executeImpl()
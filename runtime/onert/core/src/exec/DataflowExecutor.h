@@ -58,6 +58,7 @@ public:
 
 protected:
   int64_t calculateRank(const std::vector<ir::OperationIndex> &operations);
+  void calculateCriticalPathRanks();
   void emplaceToReadyJobs(const uint32_t &id);
 
 protected:
@@ -79,10 +80,17 @@ protected:
   std::vector<std::list<uint32_t>> _output_info;
   std::vector<uint32_t> _initial_input_info;
   std::vector<uint32_t> _input_info;
+  /**
+   * @brief Jobs' critical path ranks
+   *        The number of operations on the longest path from a job to the end of the graph,
+   *        including the job itself
+   */
+  std::vector<int64_t> _critical_path_ranks;
   /**
    * @brief A collection of jobs that are ready for execution
    *        Jobs in it are ready to be scheduled.
-   *        Ordered by priority from `_indexed_ranks`
+   *        Ordered by priority from `_indexed_ranks`, or from `_critical_path_ranks` if
+   *        `_indexed_ranks` is not given
    */
   std::multimap<int64_t, std::unique_ptr<Job>, std::greater<int64_t>> _ready_jobs;
 
@@ -276,6 +276,24 @@ void DynamicShapeInferer::visit(const ir::operation::Conv2D &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::DepthToSpace &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::DepthToSpace::Input::INPUT)};
+  const auto &input = _tensor_registry->getITensor(input_idx);
+
+  if (!input->is_dynamic())
+    return;
+
+  ir::Shape new_shape =
+      shape_inference::inferDepthToSpaceShape(input->getShape(), op.param().block_size);
+
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  output->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::ElementwiseActivation &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseActivation::INPUT));
@@ -414,11 +432,21 @@ void DynamicShapeInferer::visit(const ir::operation::Gather &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::InstanceNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::InstanceNorm::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::L2Normalization &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::LocalResponseNormalization &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LocalResponseNormalization::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::MatrixBandPart &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::MatrixBandPart::INPUT));
@@ -526,6 +554,12 @@ void DynamicShapeInferer::visit(const ir::operation::Pow &op)
                            op.getInputs().at(ir::operation::Pow::Input::RHS));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::PReLU &op)
+{
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::PReLU::Input::INPUT),
+                           op.getInputs().at(ir::operation::PReLU::Input::ALPHA));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Range &op)
 {
   // check if output is not dynamic
@@ -732,6 +766,52 @@ void DynamicShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::ResizeNearestNeighbor &op)
+{
+  // check if output is not dynamic
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  auto input_ind = op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_ind);
+
+  if ((!input->is_dynamic()) && (!output->is_dynamic()))
+    return;
+
+  // getting output shape from input shape and Params
+  int32_t height_out, width_out;
+  if (op.getInputs().size() == 2)
+  {
+    auto size_ind = op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::SIZE);
+    auto size = _tensor_registry->getITensor(size_ind);
+    if (size->data_type() == ir::DataType::INT32)
+    {
+      auto size_buf = reinterpret_cast<const int32_t *>(size->buffer());
+      height_out = size_buf[0];
+      width_out = size_buf[1];
+    }
+    else
+    {
+      throw std::runtime_error("DynamicShapeInferer ResizeNearestNeighbor : Unsupported data type");
+    }
+  }
+  else
+  {
+    height_out = op.param().height_out;
+    width_out = op.param().width_out;
+  }
+  auto output_shape =
+      shape_inference::inferResizeBilinearShape(input->getShape(), height_out, width_out);
+
+  // if shape is changed, change output shape and reallocate output tensor memory
+  if (output_shape != output->getShape() || output->buffer() == nullptr)
+  {
+    // change on output shape
+    output->applyShape(output_shape);
+  }
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Reverse &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::INPUT));
@@ -985,6 +1065,25 @@ void DynamicShapeInferer::visit(const ir::operation::Tile &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = _tensor_registry->getITensor(input_idx);
+
+  if (!input->is_dynamic())
+    return;
+
+  ir::Shape new_shape = shape_inference::inferTopKV2Shape(input->getShape(), op.param().k);
+
+  // values and indices have the same shape
+  for (const auto output_ind : op.getOutputs())
+  {
+    auto output = _tensor_registry->getITensor(output_ind);
+    output->applyShape(new_shape);
+    assert(output->buffer() != nullptr);
+  }
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
 {
   // check if output is not dynamic
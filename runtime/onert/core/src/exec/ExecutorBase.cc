@@ -126,6 +126,9 @@ void ExecutorBase::execute(const IODescription &desc)
                       desc.inputs[i]->size);
 
     handleDynamicInputTensor(ir::IOIndex{i}, desc);
+
+    if (!_zero_copy_input_tensors.empty())
+      bindUserBuffer(_zero_copy_input_tensors[i], *tensor, desc.inputs[i]->layout);
   }
 
   assert(_output_tensors.size() == desc.outputs.size());
@@ -138,6 +141,9 @@ void ExecutorBase::execute(const IODescription &desc)
     if (desc.outputs[i] == nullptr)
       throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is not set."};
     tensor->setBuffer(static_cast<uint8_t *>(desc.outputs[i]->buffer), desc.outputs[i]->size);
+
+    if (!_zero_copy_output_tensors.empty())
+      bindUserBuffer(_zero_copy_output_tensors[i], *tensor, desc.outputs[i]->layout);
   }
 
   executeImpl();
@@ -189,6 +195,46 @@ void ExecutorBase::handleDynamicInputTensor(ir::IOIndex io_ind, const IODescript
   }
 }
 
+void ExecutorBase::setZeroCopyTensors(const std::vector<backend::cpu_common::Tensor *> &inputs,
+                                      const std::vector<backend::cpu_common::Tensor *> &outputs)
+{
+  assert(inputs.size() == _input_tensors.size());
+  assert(outputs.size() == _output_tensors.size());
+  _zero_copy_input_tensors = inputs;
+  _zero_copy_output_tensors = outputs;
+
+  for (auto tensor : inputs)
+  {
+    if (tensor != nullptr)
+      _own_buffers[tensor] = tensor->buffer();
+  }
+  for (auto tensor : outputs)
+  {
+    if (tensor != nullptr)
+      _own_buffers[tensor] = tensor->buffer();
+  }
+}
+
+/**
+ * @brief Let a tensor that is permuted from/to a user tensor use the user buffer directly
+ *        if their types, shapes and layouts are the same. Otherwise the tensor uses its own
+ *        buffer again.
+ *
+ * @note  Dynamic tensors are not bound since they are allocated by DynamicTensorManager
+ */
+void ExecutorBase::bindUserBuffer(backend::cpu_common::Tensor *tensor,
+                                  const backend::ITensor &user_tensor, ir::Layout user_layout)
+{
+  if (tensor == nullptr || tensor->is_dynamic())
+    return;
+
+  const bool bindable = user_tensor.buffer() != nullptr && user_layout == tensor->layout() &&
+                        user_tensor.data_type() == tensor->data_type() &&
+                        user_tensor.getShape() == tensor->getShape() &&
+                        user_tensor.total_size() >= tensor->total_size();
+  tensor->overwriteBuffer(bindable ? user_tensor.buffer() : _own_buffers.at(tensor));
+}
+
 bool ExecutorBase::hasDynamicInput()
 {
   for (auto &tensor : _input_tensors)
@@ -35,7 +35,9 @@
 #include "backend/ITensorManager.h"
 #include "exec/ExecutionObservee.h"
 #include "compiler/TensorRegistries.h"
+#include "backend/cpu_common/Tensor.h"
 #include <list>
+#include <unordered_map>
 
 namespace onert
 {
@@ -84,6 +86,17 @@ public:
 
   const std::vector<backend::ITensor *> &getOutputTensors() const { return _output_tensors; }
 
+  /**
+   * @brief Set tensors that are copied from model inputs or to model outputs by Permute
+   *        These tensors use user buffers directly at @c execute when they can, so that the
+   *        copies are skipped
+   *
+   * @param inputs Tensor for each model input, or nullptr if there is no such tensor
+   * @param outputs Tensor for each model output, or nullptr if there is no such tensor
+   */
+  void setZeroCopyTensors(const std::vector<backend::cpu_common::Tensor *> &inputs,
+                          const std::vector<backend::cpu_common::Tensor *> &outputs);
+
 protected:
   /**
    * @brief Returns @c true if any input tensor is dynamic; @c false if all are static tensors
@@ -101,6 +114,14 @@ protected:
 
 private:
   void handleDynamicInputTensor(ir::IOIndex input_index, const IODescription &desc);
+  void bindUserBuffer(backend::cpu_common::Tensor *tensor, const backend::ITensor &user_tensor,
+                      ir::Layout user_layout);
+
+private:
+  std::vector<backend::cpu_common::Tensor *> _zero_copy_input_tensors;
+  std::vector<backend::cpu_common::Tensor *> _zero_copy_output_tensors;
+  // Buffers that zero-copy tensors have on their own
+  std::unordered_map<backend::cpu_common::Tensor *, uint8_t *> _own_buffers;
 };
 
 } // namespace exec
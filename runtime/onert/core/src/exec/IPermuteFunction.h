@@ -23,6 +23,8 @@
 #include "feature/nhwc/Reader.h"
 #include "feature/nhwc/View.h"
 
+#include "PermuteKernel.h"
+
 #include "backend/ITensor.h"
 #include "exec/IFunction.h"
 #include "ir/Index.h"
@@ -60,7 +62,6 @@ public:
       auto dst_tensor = *dst_it;
       if (src_tensor != dst_tensor)
       {
-        // TODO Change to permute in parallel
         assert(underlying_type(src_tensor->data_type()) ==
                underlying_type(dst_tensor->data_type()));
         const auto rank = src_tensor->num_dimensions();
@@ -129,10 +130,26 @@ private:
           if (!src_tensor.has_padding() && !dst_tensor.has_padding())
           {
             assert(src_size <= dst_tensor.total_size());
-            memcpy(dst_buffer, src_buffer, src_size);
+            // Tensors can share a user buffer (See ExecutorBase::setZeroCopyTensors)
+            if (dst_buffer != src_buffer)
+              permute::copy(_thread_pool.get(), src_buffer, dst_buffer, src_size);
             return;
           }
         }
+        else if (rank == 4 && !src_tensor.has_padding() && !dst_tensor.has_padding())
+        {
+          // NHWC <-> NCHW is a transpose of matrices in each batch
+          const bool to_nchw = (permute_type == PermuteType::NHWC_TO_NCHW);
+          const size_t batches = src_tensor.dimension(0);
+          const size_t channels = src_tensor.dimension(to_nchw ? 3 : 1);
+          const size_t spatial =
+              src_tensor.dimension(to_nchw ? 1 : 2) * src_tensor.dimension(to_nchw ? 2 : 3);
+          const size_t rows = to_nchw ? spatial : channels;
+          const size_t cols = to_nchw ? channels : spatial;
+          permute::transpose(_thread_pool.get(), reinterpret_cast<const T *>(src_buffer),
+                             reinterpret_cast<T *>(dst_buffer), batches, rows, cols);
+          return;
+        }
         switch (rank)
         {
           case 0:
@@ -278,6 +295,8 @@ protected:
   std::vector<backend::ITensor *> _dst_tensors;
   // TODO Remove this member if it is possible
   std::vector<size_t> _ranks;
+  // Thread pool of the session that large permutations are split onto, nullptr if not limited
+  std::shared_ptr<ThreadPool> _thread_pool;
 };
 
 } // namespace exec
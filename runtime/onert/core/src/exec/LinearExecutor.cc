@@ -39,6 +39,11 @@ char *seq_to_label(const onert::ir::OpSequence *op_seq, const onert::ir::Operati
 
 void LinearExecutor::executeImpl()
 {
+  const bool dynamic_input = hasDynamicInput();
+  // With a cached plan, shapes and memory of all tensors are ready before running kernels
+  const bool planned =
+      _shape_plan_cache && dynamic_input && _shape_plan_cache->bind(_input_tensors);
+
   _subject.notifyModelBegin(this);
   for (auto &&code : _code)
   {
@@ -51,14 +56,36 @@ void LinearExecutor::executeImpl()
     _subject.notifyJobBegin(this, op_seq, backend);
 
     auto &fn_seq = code.fn_seq;
-    bool handle_dynamic_tensor = op_seq->has_dynamic_tensor() || hasDynamicInput();
+    if (planned)
+    {
+      try
+      {
+        // Run as static so that nested sequences do not keep the flag of a previous run
+        fn_seq->enableDynamicShapeInferer(false);
+        fn_seq->run();
+      }
+      catch (...)
+      {
+        _shape_plan_cache->unbind();
+        throw;
+      }
+    }
+    else
+    {
+      bool handle_dynamic_tensor = op_seq->has_dynamic_tensor() || dynamic_input;
 
-    fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
-    fn_seq->run();
+      fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
+      fn_seq->run();
+    }
 
     _subject.notifyJobEnd(this, op_seq, backend);
   }
   _subject.notifyModelEnd(this);
+
+  if (planned)
+    _shape_plan_cache->unbind();
+  else if (_shape_plan_cache && dynamic_input)
+    _shape_plan_cache->record(_input_tensors);
 }
 
 } // namespace exec
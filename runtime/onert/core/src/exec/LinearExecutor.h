@@ -24,6 +24,7 @@
 
 #include "ir/Index.h"
 #include "ExecutorBase.h"
+#include "ShapePlanCache.h"
 #include "compiler/Linear.h"
 #include "exec/FunctionSequence.h"
 #include "compiler/CodeMap.h"
@@ -45,17 +46,29 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param shape_plan_cache_size Number of input shapes whose plans are cached (disabled if 0)
    */
   LinearExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                  const std::vector<backend::ITensor *> &input_tensors,
                  const std::vector<backend::ITensor *> &output_tensors,
                  const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                 const std::vector<ir::OpSequenceIndex> &order)
+                 const std::vector<ir::OpSequenceIndex> &order, size_t shape_plan_cache_size = 0)
       : ExecutorBase{std::move(lowered_graph), input_tensors, output_tensors, tensor_regs}
   {
+    std::vector<ir::OperationIndex> operation_order;
     for (auto index : order)
     {
       _code.emplace_back(std::move(code_map.at(index)));
+      for (const auto &operation_index : *_code.back().op_seq)
+        operation_order.emplace_back(operation_index);
+    }
+
+    // Only primary executor is given model inputs of which shapes can be changed by users
+    const bool primary_executor = !(input_tensors.empty() && output_tensors.empty());
+    if (primary_executor && shape_plan_cache_size > 0 && ShapePlanCache::isCacheable(_graph))
+    {
+      _shape_plan_cache = std::make_unique<ShapePlanCache>(_graph, tensor_regs, operation_order,
+                                                           shape_plan_cache_size);
     }
   }
 
@@ -64,6 +77,7 @@ public:
 
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  std::unique_ptr<ShapePlanCache> _shape_plan_cache;
 };
 
 } // namespace exec
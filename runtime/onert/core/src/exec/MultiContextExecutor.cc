@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiContextExecutor.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+MultiContextExecutor::MultiContextExecutor(std::vector<std::shared_ptr<ExecutorMap>> &&contexts)
+    : _contexts{std::move(contexts)}
+{
+  if (_contexts.empty())
+    throw std::runtime_error{"MultiContextExecutor: No execution context is given"};
+
+  // Push in reverse order so that the first context is used first
+  for (size_t i = _contexts.size(); i > 0; --i)
+  {
+    assert(_contexts[i - 1] != nullptr);
+    _free_contexts.push_back(i - 1);
+  }
+}
+
+const ir::Graph &MultiContextExecutor::graph() { return primaryExecutor(0).graph(); }
+
+void MultiContextExecutor::setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks)
+{
+  for (size_t i = 0; i < _contexts.size(); ++i)
+  {
+    primaryExecutor(i).setIndexedRanks(ranks);
+  }
+}
+
+void MultiContextExecutor::execute(const IODescription &desc)
+{
+  const auto context_index = acquireContext();
+  VERBOSE(MultiContextExecutor) << "Execute on context " << context_index << std::endl;
+
+  try
+  {
+    primaryExecutor(context_index).execute(desc);
+  }
+  catch (...)
+  {
+    releaseContext(context_index);
+    throw;
+  }
+
+  releaseContext(context_index);
+}
+
+size_t MultiContextExecutor::acquireContext()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [&] { return !_free_contexts.empty(); });
+  const auto context_index = _free_contexts.back();
+  _free_contexts.pop_back();
+  return context_index;
+}
+
+void MultiContextExecutor::releaseContext(size_t context_index)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _free_contexts.push_back(context_index);
+  }
+  _cv.notify_one();
+}
+
+IExecutor &MultiContextExecutor::primaryExecutor(size_t context_index)
+{
+  return *_contexts.at(context_index)->at(ir::SubgraphIndex{0});
+}
+
+} // namespace exec
+} // namespace onert
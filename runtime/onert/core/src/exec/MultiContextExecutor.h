@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MULTI_CONTEXT_EXECUTOR_H__
+#define __ONERT_EXEC_MULTI_CONTEXT_EXECUTOR_H__
+
+#include "exec/IExecutor.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run multiple executions of a model at the same time
+ *
+ * Each execution context is a set of executors of all subgraphs that owns its own non-constant
+ * tensors and kernels, while constant data is shared among contexts. An execution occupies a free
+ * context for the run so that executions on different contexts do not wait for each other.
+ * If all contexts are busy, an execution waits until one of them is released.
+ */
+class MultiContextExecutor : public IExecutor
+{
+public:
+  /**
+   * @brief Construct a new MultiContextExecutor object
+   * @param contexts Executor maps for each execution context, compiled from the same subgraphs
+   */
+  MultiContextExecutor(std::vector<std::shared_ptr<ExecutorMap>> &&contexts);
+
+public:
+  const ir::Graph &graph() final;
+
+  void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final;
+
+  void execute(const IODescription &desc) final;
+
+  /**
+   * @brief Returns the number of execution contexts
+   */
+  size_t numContexts() const { return _contexts.size(); }
+
+private:
+  size_t acquireContext();
+  void releaseContext(size_t context_index);
+  IExecutor &primaryExecutor(size_t context_index);
+
+private:
+  std::vector<std::shared_ptr<ExecutorMap>> _contexts;
+  std::vector<size_t> _free_contexts;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MULTI_CONTEXT_EXECUTOR_H__
@@ -63,25 +63,26 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                                    const std::vector<backend::ITensor *> &input_tensors,
                                    const std::vector<backend::ITensor *> &output_tensors,
                                    const compiler::TensorRegistries &tensor_regs,
-                                   compiler::CodeMap &&code_map)
+                                   compiler::CodeMap &&code_map, uint32_t num_threads)
     : DataflowExecutor{std::move(lowered_graph), input_tensors, output_tensors, tensor_regs,
                        std::move(code_map)}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
-
-void ParallelExecutor::executeImpl()
-{
-  bool dynamic_input_exists = hasDynamicInput();
 
   // Init scheduler
+  // Worker threads of the scheduler are reused for every execution
   // TODO Consider to have distinct backend set in LowerInfoMap
   BackendSet backends;
   for (auto &itr : _lowered_graph->getLowerInfo()->op_seq)
   {
     backends.add(itr.second->backend());
   }
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_threads);
+}
+
+void ParallelExecutor::executeImpl()
+{
+  bool dynamic_input_exists = hasDynamicInput();
 
   assert(noWaitingJobs());
 
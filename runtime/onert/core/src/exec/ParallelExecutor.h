@@ -49,11 +49,14 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param num_threads Number of worker threads for each backend that supports concurrent
+   *                    execution
    */
   ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                    const std::vector<backend::ITensor *> &input_tensors,
                    const std::vector<backend::ITensor *> &output_tensors,
-                   const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map);
+                   const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
+                   uint32_t num_threads);
 
   void executeImpl() override;
 
@@ -19,6 +19,8 @@
 #include <cassert>
 
 #include <memory>
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
 #include "util/logging.h"
 
 namespace onert
@@ -26,13 +28,19 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends, uint32_t num_threads)
 {
   assert(!backends.empty());
+  assert(num_threads >= 1);
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    // Kernels of a backend that does not support concurrent execution must run one by one
+    const auto backend_num_threads =
+        backend->config()->supportConcurrentExecution() ? num_threads : 1;
+    VERBOSE(ParallelScheduler) << backend->config()->id() << " : " << backend_num_threads
+                               << " thread(s)" << std::endl;
+    _thread_pools[backend] = std::make_unique<ThreadPool>(backend_num_threads);
   }
 }
 
@@ -22,7 +22,7 @@
 
 #include "exec/IFunction.h"
 #include "BackendSet.h"
-#include "ThreadPool.h"
+#include "exec/ThreadPool.h"
 
 namespace onert
 {
@@ -36,8 +36,10 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   * @param num_threads Number of threads for each backend that supports concurrent execution.
+   *                    Other backends get a single thread.
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends, uint32_t num_threads);
   /**
    * @brief Assign a task to the given backend
    *
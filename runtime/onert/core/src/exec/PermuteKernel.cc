@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PermuteKernel.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace
+{
+
+// Work smaller than this is not worth waking up other threads
+constexpr size_t kMinBytesPerThread = 64 * 1024;
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+namespace permute
+{
+
+void parallelFor(ThreadPool *pool, size_t size, size_t item_bytes,
+                 const std::function<void(size_t, size_t)> &fn)
+{
+  if (pool == nullptr)
+  {
+    fn(0, size);
+    return;
+  }
+
+  const size_t max_threads = std::max(size * item_bytes / kMinBytesPerThread, size_t{1});
+  const size_t num_threads = std::min({max_threads, size, size_t{pool->numThreads()}});
+  if (num_threads <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  // Do not use ThreadPool::finish() since other permutations may share the pool
+  std::mutex mu;
+  std::condition_variable cv;
+  size_t num_remaining = num_threads - 1;
+  auto done = [&]() {
+    std::lock_guard<std::mutex> lock{mu};
+    if (--num_remaining == 0)
+      cv.notify_one();
+  };
+
+  const size_t chunk = (size + num_threads - 1) / num_threads;
+  for (size_t t = 1; t < num_threads; ++t)
+  {
+    const size_t begin = std::min(t * chunk, size);
+    const size_t end = std::min(begin + chunk, size);
+    pool->enqueue([&fn, &done, begin, end]() {
+      fn(begin, end);
+      done();
+    });
+  }
+  fn(0, std::min(chunk, size));
+
+  std::unique_lock<std::mutex> lock{mu};
+  cv.wait(lock, [&]() { return num_remaining == 0; });
+}
+
+void copy(ThreadPool *pool, const uint8_t *src, uint8_t *dst, size_t size)
+{
+  constexpr size_t kChunkBytes = 4096;
+  const size_t num_chunks = (size + kChunkBytes - 1) / kChunkBytes;
+  parallelFor(pool, num_chunks, kChunkBytes, [&](size_t begin, size_t end) {
+    const size_t offset = begin * kChunkBytes;
+    memcpy(dst + offset, src + offset, std::min(end * kChunkBytes, size) - offset);
+  });
+}
+
+} // namespace permute
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_PERMUTE_KERNEL_H__
+#define __ONERT_EXEC_PERMUTE_KERNEL_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "exec/ThreadPool.h"
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace onert
+{
+namespace exec
+{
+namespace permute
+{
+
+/**
+ * @brief Run @c fn on ranges of [0, size) in parallel
+ *
+ * @param pool Thread pool for intra-op parallelism, or nullptr to run on the caller thread only
+ * @param size Number of items
+ * @param item_bytes Bytes that each item touches. Work is split only if it is large enough.
+ * @param fn Function to be called with [begin, end) of items
+ * @note  The caller thread takes a range too, so at most as many threads as the pool has work
+ */
+void parallelFor(ThreadPool *pool, size_t size, size_t item_bytes,
+                 const std::function<void(size_t, size_t)> &fn);
+
+/**
+ * @brief Copy @c size bytes, splitting the copy into chunks for threads if it is large
+ */
+void copy(ThreadPool *pool, const uint8_t *src, uint8_t *dst, size_t size);
+
+/**
+ * @brief Kernel that transposes a square tile of elements at once
+ *
+ * @note  Scalar version that transposes a single element
+ */
+template <size_t ElemSize> struct MicroKernel
+{
+  static constexpr size_t size = 1;
+  static void run(const uint8_t *src, size_t, uint8_t *dst, size_t)
+  {
+    std::memcpy(dst, src, ElemSize);
+  }
+};
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+template <> struct MicroKernel<4>
+{
+  static constexpr size_t size = 4;
+  static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+  {
+    const auto s = reinterpret_cast<const float *>(src);
+    const auto d = reinterpret_cast<float *>(dst);
+    const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(s), vld1q_f32(s + src_stride));
+    const float32x4x2_t t23 =
+        vtrnq_f32(vld1q_f32(s + 2 * src_stride), vld1q_f32(s + 3 * src_stride));
+    vst1q_f32(d, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+    vst1q_f32(d + dst_stride, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+    vst1q_f32(d + 2 * dst_stride,
+              vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+    vst1q_f32(d + 3 * dst_stride,
+              vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+  }
+};
+
+template <> struct MicroKernel<1>
+{
+  static constexpr size_t size = 8;
+  static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+  {
+    const uint8x8x2_t t01 = vtrn_u8(vld1_u8(src), vld1_u8(src + src_stride));
+    const uint8x8x2_t t23 = vtrn_u8(vld1_u8(src + 2 * src_stride), vld1_u8(src + 3 * src_stride));
+    const uint8x8x2_t t45 = vtrn_u8(vld1_u8(src + 4 * src_stride), vld1_u8(src + 5 * src_stride));
+    const uint8x8x2_t t67 = vtrn_u8(vld1_u8(src + 6 * src_stride), vld1_u8(src + 7 * src_stride));
+    const uint16x4x2_t s02 =
+        vtrn_u16(vreinterpret_u16_u8(t01.val[0]), vreinterpret_u16_u8(t23.val[0]));
+    const uint16x4x2_t s13 =
+        vtrn_u16(vreinterpret_u16_u8(t01.val[1]), vreinterpret_u16_u8(t23.val[1]));
+    const uint16x4x2_t s46 =
+        vtrn_u16(vreinterpret_u16_u8(t45.val[0]), vreinterpret_u16_u8(t67.val[0]));
+    const uint16x4x2_t s57 =
+        vtrn_u16(vreinterpret_u16_u8(t45.val[1]), vreinterpret_u16_u8(t67.val[1]));
+    const uint32x2x2_t q04 =
+        vtrn_u32(vreinterpret_u32_u16(s02.val[0]), vreinterpret_u32_u16(s46.val[0]));
+    const uint32x2x2_t q15 =
+        vtrn_u32(vreinterpret_u32_u16(s13.val[0]), vreinterpret_u32_u16(s57.val[0]));
+    const uint32x2x2_t q26 =
+        vtrn_u32(vreinterpret_u32_u16(s02.val[1]), vreinterpret_u32_u16(s46.val[1]));
+    const uint32x2x2_t q37 =
+        vtrn_u32(vreinterpret_u32_u16(s13.val[1]), vreinterpret_u32_u16(s57.val[1]));
+    vst1_u8(dst, vreinterpret_u8_u32(q04.val[0]));
+    vst1_u8(dst + dst_stride, vreinterpret_u8_u32(q15.val[0]));
+    vst1_u8(dst + 2 * dst_stride, vreinterpret_u8_u32(q26.val[0]));
+    vst1_u8(dst + 3 * dst_stride, vreinterpret_u8_u32(q37.val[0]));
+    vst1_u8(dst + 4 * dst_stride, vreinterpret_u8_u32(q04.val[1]));
+    vst1_u8(dst + 5 * dst_stride, vreinterpret_u8_u32(q15.val[1]));
+    vst1_u8(dst + 6 * dst_stride, vreinterpret_u8_u32(q26.val[1]));
+    vst1_u8(dst + 7 * dst_stride, vreinterpret_u8_u32(q37.val[1]));
+  }
+};
+
+#elif defined(__SSE2__)
+
+template <> struct MicroKernel<4>
+{
+  static constexpr size_t size = 4;
+  static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+  {
+    const auto s = reinterpret_cast<const float *>(src);
+    const auto d = reinterpret_cast<float *>(dst);
+    __m128 r0 = _mm_loadu_ps(s);
+    __m128 r1 = _mm_loadu_ps(s + src_stride);
+    __m128 r2 = _mm_loadu_ps(s + 2 * src_stride);
+    __m128 r3 = _mm_loadu_ps(s + 3 * src_stride);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(d, r0);
+    _mm_storeu_ps(d + dst_stride, r1);
+    _mm_storeu_ps(d + 2 * dst_stride, r2);
+    _mm_storeu_ps(d + 3 * dst_stride, r3);
+  }
+};
+
+template <> struct MicroKernel<1>
+{
+  static constexpr size_t size = 8;
+  static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+  {
+    auto load = [&](size_t i) {
+      return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i * src_stride));
+    };
+    auto store = [&](size_t i, __m128i v) {
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i * dst_stride), v);
+    };
+    const __m128i t0 = _mm_unpacklo_epi8(load(0), load(1));
+    const __m128i t1 = _mm_unpacklo_epi8(load(2), load(3));
+    const __m128i t2 = _mm_unpacklo_epi8(load(4), load(5));
+    const __m128i t3 = _mm_unpacklo_epi8(load(6), load(7));
+    const __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+    const __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+    const __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+    const __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+    const __m128i v0 = _mm_unpacklo_epi32(u0, u2);
+    const __m128i v1 = _mm_unpackhi_epi32(u0, u2);
+    const __m128i v2 = _mm_unpacklo_epi32(u1, u3);
+    const __m128i v3 = _mm_unpackhi_epi32(u1, u3);
+    store(0, v0);
+    store(1, _mm_unpackhi_epi64(v0, v0));
+    store(2, v1);
+    store(3, _mm_unpackhi_epi64(v1, v1));
+    store(4, v2);
+    store(5, _mm_unpackhi_epi64(v2, v2));
+    store(6, v3);
+    store(7, _mm_unpackhi_epi64(v3, v3));
+  }
+};
+
+#endif
+
+/**
+ * @brief Transpose rows [row_begin, row_end) of a @c rows x @c cols matrix into a @c cols x @c rows
+ *        matrix, tile by tile so that both source and destination stay in cache
+ */
+template <typename T>
+void transposeRows(const T *src, T *dst, size_t rows, size_t cols, size_t row_begin,
+                   size_t row_end)
+{
+  using Kernel = MicroKernel<sizeof(T)>;
+  constexpr size_t kTile = 32;
+  constexpr size_t kMicro = Kernel::size;
+
+  auto transpose_scalar = [&](size_t r, size_t c) { dst[c * rows + r] = src[r * cols + c]; };
+
+  for (size_t rb = row_begin; rb < row_end; rb += kTile)
+  {
+    const size_t re = std::min(rb + kTile, row_end);
+    for (size_t cb = 0; cb < cols; cb += kTile)
+    {
+      const size_t ce = std::min(cb + kTile, cols);
+      size_t r = rb;
+      for (; r + kMicro <= re; r += kMicro)
+      {
+        size_t c = cb;
+        for (; c + kMicro <= ce; c += kMicro)
+        {
+          Kernel::run(reinterpret_cast<const uint8_t *>(src + r * cols + c), cols,
+                      reinterpret_cast<uint8_t *>(dst + c * rows + r), rows);
+        }
+        for (; c < ce; ++c)
+          for (size_t rr = r; rr < r + kMicro; ++rr)
+            transpose_scalar(rr, c);
+      }
+      for (; r < re; ++r)
+        for (size_t c = cb; c < ce; ++c)
+          transpose_scalar(r, c);
+    }
+  }
+}
+
+/**
+ * @brief Transpose @c batches matrices of @c rows x @c cols elements
+ *
+ * @note  NHWC to NCHW is a transpose of (H*W) x C matrices per batch, and NCHW to NHWC is that of
+ *        C x (H*W) matrices
+ */
+template <typename T>
+void transpose(ThreadPool *pool, const T *src, T *dst, size_t batches, size_t rows, size_t cols)
+{
+  constexpr size_t kRowsPerItem = 32;
+  const size_t items_per_batch = (rows + kRowsPerItem - 1) / kRowsPerItem;
+  const size_t matrix_size = rows * cols;
+  parallelFor(pool, batches * items_per_batch, kRowsPerItem * cols * sizeof(T),
+              [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                  const size_t batch = i / items_per_batch;
+                  const size_t row_begin = (i % items_per_batch) * kRowsPerItem;
+                  const size_t row_end = std::min(row_begin + kRowsPerItem, rows);
+                  transposeRows(src + batch * matrix_size, dst + batch * matrix_size, rows, cols,
+                                row_begin, row_end);
+                }
+              });
+}
+
+} // namespace permute
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PERMUTE_KERNEL_H__
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ShapePlanCache.h"
+
+#include "backend/controlflow/UserTensor.h"
+#include "backend/cpu_common/MemoryPlanner.h"
+#include "ir/Operations.Include.h"
+#include "util/logging.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace exec
+{
+
+ShapePlanCache::ShapePlanCache(const ir::Graph &graph,
+                               const compiler::TensorRegistries &tensor_regs,
+                               const std::vector<ir::OperationIndex> &order, size_t capacity)
+    : _graph{graph}, _order{order}, _capacity{capacity}, _bound_plan{nullptr}
+{
+  _graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &) {
+    auto tensor = tensor_regs.getITensor(ind);
+    if (tensor != nullptr)
+      _tensors[ind] = tensor;
+  });
+}
+
+bool ShapePlanCache::isCacheable(const ir::Graph &graph)
+{
+  using namespace ir::operation;
+
+  bool cacheable = true;
+  graph.operations().iterate([&](const ir::OperationIndex &, const ir::Operation &op) {
+    // Output shapes depend on values of the given inputs, which must be constant to be cached
+    auto require_constant = [&](std::initializer_list<uint32_t> positions) {
+      for (auto pos : positions)
+      {
+        if (pos >= op.getInputs().size())
+          continue;
+        const auto &ind = op.getInputs().at(pos);
+        if (ind.valid() && !graph.operands().at(ind).isConstant())
+          cacheable = false;
+      }
+    };
+
+    switch (op.opcode())
+    {
+      // Subgraphs of control flow operations have their own dynamic tensors
+      case ir::OpCode::If:
+      case ir::OpCode::While:
+        cacheable = false;
+        break;
+      case ir::OpCode::ArgMax:
+        require_constant({ArgMax::Input::AXIS});
+        break;
+      case ir::OpCode::BatchToSpaceND:
+        require_constant({BatchToSpaceND::Input::BLOCK_SIZE, BatchToSpaceND::Input::CROPS_DATA});
+        break;
+      case ir::OpCode::BroadcastTo:
+        require_constant({BroadcastTo::Input::SHAPE});
+        break;
+      case ir::OpCode::ExpandDims:
+        require_constant({ExpandDims::Input::AXIS});
+        break;
+      case ir::OpCode::Fill:
+        require_constant({Fill::Input::INPUT});
+        break;
+      case ir::OpCode::OneHot:
+        require_constant({OneHot::Input::DEPTH});
+        break;
+      case ir::OpCode::Pad:
+        require_constant({Pad::Input::PAD});
+        break;
+      case ir::OpCode::Range:
+        require_constant({Range::Input::START, Range::Input::LIMIT, Range::Input::DELTA});
+        break;
+      case ir::OpCode::Reduce:
+        require_constant({Reduce::Input::AXES});
+        break;
+      case ir::OpCode::Reshape:
+        require_constant({Reshape::Input::SHAPE});
+        break;
+      case ir::OpCode::ResizeBilinear:
+        require_constant({ResizeBilinear::Input::SIZE});
+        break;
+      case ir::OpCode::ResizeNearestNeighbor:
+        require_constant({ResizeNearestNeighbor::Input::SIZE});
+        break;
+      case ir::OpCode::Slice:
+        require_constant({Slice::Input::BEGINS, Slice::Input::SIZES});
+        break;
+      case ir::OpCode::SpaceToBatchND:
+        require_constant({SpaceToBatchND::Input::BLOCK_SIZE, SpaceToBatchND::Input::PADDINGS});
+        break;
+      case ir::OpCode::Split:
+        require_constant({Split::Input::AXIS});
+        break;
+      case ir::OpCode::SplitV:
+        require_constant({SplitV::Input::SIZE_SPLITS, SplitV::Input::SPLIT_DIM});
+        break;
+      case ir::OpCode::StatelessRandomUniform:
+        require_constant({StatelessRandomUniform::Input::SHAPE});
+        break;
+      case ir::OpCode::StridedSlice:
+        require_constant(
+            {StridedSlice::Input::STARTS, StridedSlice::Input::ENDS, StridedSlice::Input::STRIDES});
+        break;
+      case ir::OpCode::Tile:
+        require_constant({Tile::Input::MULTIPLES});
+        break;
+      case ir::OpCode::Transpose:
+        require_constant({Transpose::Input::PERMUTATION});
+        break;
+      case ir::OpCode::TransposeConv:
+        require_constant({TransposeConv::Input::OUTPUT_SHAPE});
+        break;
+      default:
+        break;
+    }
+  });
+  return cacheable;
+}
+
+size_t ShapePlanCache::countDynamicTensors() const
+{
+  // Tensors never become static again, so the count tells whether the set has changed
+  size_t count = 0;
+  for (const auto &pair : _tensors)
+  {
+    if (pair.second->is_dynamic())
+      ++count;
+  }
+  return count;
+}
+
+bool ShapePlanCache::bind(const std::vector<backend::ITensor *> &input_tensors)
+{
+  assert(_bound_plan == nullptr);
+
+  const auto num_dynamic_tensors = countDynamicTensors();
+  auto found = std::find_if(_plans.begin(), _plans.end(), [&](const Plan &plan) {
+    if (plan.num_dynamic_tensors != num_dynamic_tensors)
+      return false;
+    for (size_t i = 0; i < input_tensors.size(); ++i)
+    {
+      if (plan.input_shapes[i] != input_tensors[i]->getShape())
+        return false;
+    }
+    return true;
+  });
+  if (found == _plans.end())
+    return false;
+
+  // Move the plan to the front to be evicted last
+  _plans.splice(_plans.begin(), _plans, found);
+  auto &plan = _plans.front();
+
+  for (auto &pair : plan.shapes)
+    pair.first->setShape(pair.second);
+
+  for (auto &pair : plan.offsets)
+  {
+    auto tensor = pair.first;
+    tensor->deallocBuffer();
+    tensor->setBuffer(plan.arena->base() + pair.second);
+  }
+
+  _bound_plan = &plan;
+  return true;
+}
+
+void ShapePlanCache::unbind()
+{
+  assert(_bound_plan != nullptr);
+
+  // Let dynamic shape inference allocate memory on its own if next inputs are not cached
+  for (auto &pair : _bound_plan->offsets)
+    pair.first->resetBuffer();
+
+  _bound_plan = nullptr;
+}
+
+void ShapePlanCache::record(const std::vector<backend::ITensor *> &input_tensors)
+{
+  assert(_bound_plan == nullptr);
+
+  if (_capacity == 0)
+    return;
+
+  Plan plan;
+  for (auto tensor : input_tensors)
+    plan.input_shapes.emplace_back(tensor->getShape());
+  plan.num_dynamic_tensors = countDynamicTensors();
+
+  ir::OperandIndexMap<backend::cpu_common::Tensor *> native_tensors;
+  for (const auto &pair : _tensors)
+  {
+    const auto &ind = pair.first;
+    auto tensor = pair.second;
+    if (!tensor->is_dynamic() || _graph.getInputs().contains(ind))
+      continue;
+
+    plan.shapes.emplace_back(tensor, tensor->getShape());
+    if (auto native_tensor = dynamic_cast<backend::cpu_common::Tensor *>(tensor))
+    {
+      native_tensors[ind] = native_tensor;
+    }
+    else if (dynamic_cast<backend::controlflow::UserTensor *>(tensor) == nullptr)
+    {
+      // Memory of other tensors cannot be planned here
+      VERBOSE(ShapePlanCache) << "Cannot plan memory of #" << ind.value() << std::endl;
+      _capacity = 0;
+      return;
+    }
+  }
+
+  // Find where each tensor is used for the last time
+  std::unordered_map<ir::OperandIndex, size_t> last_uses;
+  for (size_t pos = 0; pos < _order.size(); ++pos)
+  {
+    const auto &op = _graph.operations().at(_order[pos]);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+      last_uses[ind] = pos;
+  }
+
+  backend::cpu_common::WICPlanner planner;
+  for (size_t pos = 0; pos < _order.size(); ++pos)
+  {
+    const auto &op = _graph.operations().at(_order[pos]);
+    for (const auto &ind : op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      auto found = native_tensors.find(ind);
+      if (found == native_tensors.end())
+        continue;
+      const auto size = std::max(found->second->total_size(), static_cast<size_t>(1));
+      planner.claim(ind, (size + backend::cpu_common::kMemoryAlignment - 1) /
+                             backend::cpu_common::kMemoryAlignment *
+                             backend::cpu_common::kMemoryAlignment);
+      // Tensors that are not used by any operation are released right after their definition
+      if (last_uses.find(ind) == last_uses.end())
+        last_uses[ind] = pos;
+    }
+    for (const auto &ind : op.getInputs() + op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      if (native_tensors.find(ind) != native_tensors.end() && last_uses.at(ind) == pos)
+        planner.release(ind);
+    }
+  }
+
+  const auto &mem_plans = planner.memory_plans();
+  for (const auto &pair : native_tensors)
+  {
+    auto found = mem_plans.find(pair.first);
+    if (found == mem_plans.end())
+    {
+      // A dynamic tensor which no operation defines cannot be planned
+      VERBOSE(ShapePlanCache) << "Cannot plan memory of #" << pair.first.value() << std::endl;
+      _capacity = 0;
+      return;
+    }
+    plan.offsets.emplace_back(pair.second, found->second.offset);
+  }
+  plan.arena = std::make_unique<backend::cpu_common::Allocator>(planner.capacity());
+
+  VERBOSE(ShapePlanCache) << "Recorded a plan of " << plan.shapes.size() << " tensors ("
+                          << planner.capacity() << " bytes)" << std::endl;
+
+  if (_plans.size() >= _capacity)
+    _plans.pop_back();
+  _plans.emplace_front(std::move(plan));
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
+#define __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
+
+#include "backend/ITensor.h"
+#include "backend/cpu_common/Allocator.h"
+#include "backend/cpu_common/Tensor.h"
+#include "compiler/TensorRegistries.h"
+#include "ir/Graph.h"
+#include "ir/Shape.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to cache shapes and memory plans of dynamic tensors by shapes of model inputs
+ *
+ * After a run with dynamic input shapes, shapes of all dynamic tensors are recorded and memory
+ * for them is planned statically. When the same input shapes are given again, the recorded plan
+ * is bound to tensors so that the run needs neither dynamic shape inference nor allocation.
+ *
+ * @note This is valid only if shapes of all tensors are determined by shapes of model inputs and
+ *       operations run in the given order. Check @c isCacheable before using this.
+ */
+class ShapePlanCache
+{
+public:
+  /**
+   * @brief Construct a new ShapePlanCache object
+   * @param graph Graph whose operations run
+   * @param tensor_regs Tensor registries that have tensors of @c graph
+   * @param order Operations in the order they run
+   * @param capacity Maximum number of input shape signatures to cache
+   */
+  ShapePlanCache(const ir::Graph &graph, const compiler::TensorRegistries &tensor_regs,
+                 const std::vector<ir::OperationIndex> &order, size_t capacity);
+
+public:
+  /**
+   * @brief Check if shapes of all tensors in @c graph depend only on shapes of model inputs
+   */
+  static bool isCacheable(const ir::Graph &graph);
+
+  /**
+   * @brief Bind the plan of current input shapes to tensors
+   * @return @c true if the plan was found and bound, otherwise @c false
+   */
+  bool bind(const std::vector<backend::ITensor *> &input_tensors);
+  /**
+   * @brief Detach memory of the bound plan from tensors
+   */
+  void unbind();
+  /**
+   * @brief Record shapes of tensors after a run with dynamic shape inference
+   */
+  void record(const std::vector<backend::ITensor *> &input_tensors);
+
+private:
+  struct Plan
+  {
+    std::vector<ir::Shape> input_shapes;
+    size_t num_dynamic_tensors;
+    std::vector<std::pair<backend::ITensor *, ir::Shape>> shapes;
+    std::vector<std::pair<backend::cpu_common::Tensor *, uint32_t>> offsets;
+    std::unique_ptr<backend::cpu_common::Allocator> arena;
+  };
+
+  size_t countDynamicTensors() const;
+
+private:
+  const ir::Graph &_graph;
+  std::vector<ir::OperationIndex> _order;
+  ir::OperandIndexMap<backend::ITensor *> _tensors;
+  size_t _capacity;
+  // The most recently used plan is at the front
+  std::list<Plan> _plans;
+  Plan *_bound_plan;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
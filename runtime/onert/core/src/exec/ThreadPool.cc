@@ -14,10 +14,30 @@
  * limitations under the License.
  */
 
-#include "ThreadPool.h"
+#include "exec/ThreadPool.h"
 
 #include <cassert>
 
+namespace
+{
+
+// The pool and the worker index of the current thread, if the thread is a worker thread
+thread_local const onert::exec::ThreadPool *tl_pool = nullptr;
+thread_local uint32_t tl_worker_index = 0;
+
+class CallableFunction final : public onert::exec::IFunction
+{
+public:
+  CallableFunction(std::function<void()> &&fn) : _fn{std::move(fn)} {}
+
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -29,36 +49,138 @@ ThreadPool::ThreadPool(uint32_t num_threads)
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _workers.emplace_back(std::make_unique<Worker>());
+  }
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&ThreadPool::work, this, i);
   }
 }
 
 ThreadPool::~ThreadPool()
 {
-  if (!_threads.empty())
   {
-    _worker.terminate();
-    join();
+    std::unique_lock<std::mutex> lock{_mu};
+    // A job may be still returning even after whoever waits for its work has been notified, e.g.
+    // the jobs of Eigen kernels
+    _cv_finish.wait(lock, [this] { return _num_unfinished_jobs == 0; });
+    _terminating = true;
+  }
+  _cv_jobs.notify_all();
+
+  for (auto &thread : _threads)
+  {
+    thread.join();
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn)
+{
+  const auto num_workers = static_cast<uint32_t>(_workers.size());
+  const auto worker_index = (tl_pool == this) ? tl_worker_index : (_next_worker++ % num_workers);
+  {
+    auto &worker = *_workers.at(worker_index);
+    std::unique_lock<std::mutex> lock{worker.mu};
+    worker.jobs.emplace_back(std::move(fn));
+  }
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    ++_num_queued_jobs;
+    ++_num_unfinished_jobs;
+  }
+  _cv_jobs.notify_one();
+}
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+void ThreadPool::enqueue(std::function<void()> fn)
+{
+  enqueue(std::make_unique<CallableFunction>(std::move(fn)));
+}
 
-void ThreadPool::join()
+int ThreadPool::currentWorkerIndex() const
 {
-  for (auto &thread : _threads)
+  return (tl_pool == this) ? static_cast<int>(tl_worker_index) : -1;
+}
+
+uint32_t ThreadPool::numJobsInQueue()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  return _num_queued_jobs;
+}
+
+void ThreadPool::finish()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_finish.wait(lock, [this] { return _num_unfinished_jobs == 0; });
+}
+
+void ThreadPool::work(uint32_t worker_index)
+{
+  tl_pool = this;
+  tl_worker_index = worker_index;
+
+  while (true)
   {
-    thread.join();
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      _cv_jobs.wait(lock, [this] { return _terminating || _num_queued_jobs > 0; });
+
+      if (_num_queued_jobs == 0)
+      {
+        assert(_terminating);
+        return;
+      }
+      // Reserve a job. It is guaranteed that one of deques has a job for this reservation
+      // since a job is pushed into a deque before it is counted.
+      --_num_queued_jobs;
+    }
+
+    std::unique_ptr<IFunction> fn = nullptr;
+    while (!pop(worker_index, fn) && !steal(worker_index, fn))
+    {
+      std::this_thread::yield();
+    }
+
+    assert(fn);
+    fn->run();
+
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      assert(_num_unfinished_jobs > 0);
+      if (--_num_unfinished_jobs == 0)
+      {
+        _cv_finish.notify_all();
+      }
+    }
   }
-  _threads.clear();
 }
 
-void ThreadPool::finish()
+bool ThreadPool::pop(uint32_t worker_index, std::unique_ptr<IFunction> &fn)
+{
+  auto &worker = *_workers.at(worker_index);
+  std::unique_lock<std::mutex> lock{worker.mu};
+  if (worker.jobs.empty())
+    return false;
+
+  fn = std::move(worker.jobs.front());
+  worker.jobs.pop_front();
+  return true;
+}
+
+bool ThreadPool::steal(uint32_t thief_index, std::unique_ptr<IFunction> &fn)
 {
-  _worker.finish();
-  join();
+  const auto num_workers = static_cast<uint32_t>(_workers.size());
+  for (uint32_t i = 1; i < num_workers; ++i)
+  {
+    auto &victim = *_workers.at((thief_index + i) % num_workers);
+    std::unique_lock<std::mutex> lock{victim.mu};
+    if (victim.jobs.empty())
+      continue;
+
+    fn = std::move(victim.jobs.back());
+    victim.jobs.pop_back();
+    return true;
+  }
+  return false;
 }
 
 } // namespace exec
@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/reference/DepthwiseConv.h>
 #include <misc/polymorphic_downcast.h>
 
 #include "OperationUtil.h"
@@ -115,8 +115,9 @@ void invoke(const ITensor *ifm_tensor, const ITensor *ker_tensor, const ITensor
   const float *bias_ptr = reinterpret_cast<const float *>(bias_tensor->bufferRO());
   float *ofm_ptr = reinterpret_cast<float *>(ofm_tensor->buffer());
 
-  nnfw::cker::DepthwiseConv(cker_param, cker_ifm_shape, ifm_ptr, cker_ker_shape, ker_ptr,
-                            cker_bias_shape, bias_ptr, cker_ofm_shape, ofm_ptr);
+  nnfw::cker::reference::DepthwiseConv(cker_param, cker_ifm_shape, ifm_ptr, cker_ker_shape,
+                                       ker_ptr, cker_bias_shape, bias_ptr, cker_ofm_shape,
+                                       ofm_ptr);
 }
 
 void invokeDepthwiseConv(const ExecEnv *env, const ir::Operation &node)
@@ -38,6 +38,16 @@ bool operator==(const TypeInfo &lhs, const TypeInfo &rhs)
     return false;
   }
 
+  if (lhs.scales() != rhs.scales())
+  {
+    return false;
+  }
+
+  if (!lhs.scales().empty() && lhs.quantized_dimension() != rhs.quantized_dimension())
+  {
+    return false;
+  }
+
   return true;
 }
 
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/CompileCache.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <iomanip>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+// Bump this when the layout of any cached data changes
+constexpr char kMagic[8] = {'O', 'N', 'E', 'C', 'C', '0', '0', '1'};
+
+// The payload starts at a cache line boundary of the mapping
+struct EntryHeader
+{
+  char magic[8];
+  uint64_t payload_size;
+  uint8_t reserved[48];
+};
+static_assert(sizeof(EntryHeader) == 64, "EntryHeader must be 64 bytes");
+
+inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline uint64_t fmix(uint64_t k)
+{
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+class MappedEntry final : public ir::Data
+{
+public:
+  MappedEntry(const uint8_t *map, size_t map_size) : _map{map}, _map_size{map_size} {}
+  ~MappedEntry() { munmap(const_cast<uint8_t *>(_map), _map_size); }
+
+public:
+  size_t size(void) const override { return _map_size - sizeof(EntryHeader); }
+  const uint8_t *base(void) const override { return _map + sizeof(EntryHeader); }
+
+private:
+  const uint8_t *_map;
+  size_t _map_size;
+};
+
+} // namespace
+
+// Mixes 16-byte blocks as the body of MurmurHash3 x64_128 does
+CompileCache::Key &CompileCache::Key::append(const void *data, size_t size)
+{
+  constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+  constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  const size_t num_blocks = size / 16;
+  for (size_t i = 0; i <= num_blocks; ++i)
+  {
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    if (i < num_blocks)
+    {
+      std::memcpy(&k1, bytes + i * 16, 8);
+      std::memcpy(&k2, bytes + i * 16 + 8, 8);
+    }
+    else
+    {
+      // Zero-padded tail, which is also hashed when empty so that appends are delimited
+      uint8_t tail[16] = {0};
+      if (size > i * 16)
+        std::memcpy(tail, bytes + i * 16, size - i * 16);
+      std::memcpy(&k1, tail, 8);
+      std::memcpy(&k2, tail + 8, 8);
+      k2 ^= size - i * 16;
+    }
+
+    k1 *= c1;
+    k1 = rotl(k1, 31);
+    k1 *= c2;
+    _h1 ^= k1;
+    _h1 = rotl(_h1, 27);
+    _h1 += _h2;
+    _h1 = _h1 * 5 + 0x52dce729;
+
+    k2 *= c2;
+    k2 = rotl(k2, 33);
+    k2 *= c1;
+    _h2 ^= k2;
+    _h2 = rotl(_h2, 31);
+    _h2 += _h1;
+    _h2 = _h2 * 5 + 0x38495ab5;
+  }
+  _length += size;
+  return *this;
+}
+
+std::string CompileCache::Key::str() const
+{
+  uint64_t h1 = _h1 ^ _length;
+  uint64_t h2 = _h2 ^ _length;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix(h1);
+  h2 = fmix(h2);
+  h1 += h2;
+  h2 += h1;
+
+  std::ostringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16) << h1 << std::setw(16) << h2;
+  return ss.str();
+}
+
+CompileCache::CompileCache(const std::string &dir, size_t max_size)
+    : _dir{dir}, _max_size{max_size}
+{
+  if (mkdir(_dir.c_str(), 0755) != 0 && errno != EEXIST)
+  {
+    VERBOSE(CompileCache) << "Cannot create cache directory " << _dir << std::endl;
+  }
+}
+
+std::string CompileCache::hashFile(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return "";
+
+  struct stat st;
+  void *map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (map == MAP_FAILED)
+    return "";
+
+  const auto hash = Key{}.append(map, st.st_size).str();
+  munmap(map, st.st_size);
+  return hash;
+}
+
+void CompileCache::addConstant(const void *data, const Key &identity)
+{
+  _constants[data] = identity;
+}
+
+CompileCache::Key CompileCache::constantKey(const void *data, size_t size) const
+{
+  auto found = _constants.find(data);
+  if (found != _constants.end())
+    return Key{found->second}.append(size);
+  return Key{}.append(data, size);
+}
+
+std::string CompileCache::path(const Key &key) const { return _dir + "/" + key.str() + ".bin"; }
+
+void CompileCache::evict(size_t incoming_size) const
+{
+  DIR *dir = opendir(_dir.c_str());
+  if (dir == nullptr)
+    return;
+
+  struct Entry
+  {
+    std::string file;
+    size_t size;
+    struct timespec mtime;
+  };
+  std::vector<Entry> entries;
+  size_t total_size = incoming_size;
+  const std::string suffix = ".bin";
+  while (const auto *dirent = readdir(dir))
+  {
+    const std::string name = dirent->d_name;
+    if (name.size() <= suffix.size() ||
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+      continue;
+
+    const auto file = _dir + "/" + name;
+    struct stat st;
+    if (stat(file.c_str(), &st) != 0)
+      continue;
+    entries.push_back({file, static_cast<size_t>(st.st_size), st.st_mtim});
+    total_size += st.st_size;
+  }
+  closedir(dir);
+
+  // Loads touch entries, so the oldest modification time is the least recently used
+  std::sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs) {
+    return lhs.mtime.tv_sec != rhs.mtime.tv_sec ? lhs.mtime.tv_sec < rhs.mtime.tv_sec
+                                                : lhs.mtime.tv_nsec < rhs.mtime.tv_nsec;
+  });
+  for (const auto &entry : entries)
+  {
+    if (total_size <= _max_size)
+      break;
+    if (unlink(entry.file.c_str()) == 0)
+    {
+      VERBOSE(CompileCache) << "Evict " << entry.file << std::endl;
+      total_size -= entry.size;
+    }
+  }
+}
+
+std::shared_ptr<ir::Data> CompileCache::load(const Key &key) const
+{
+  const auto file = path(key);
+  int fd = open(file.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  void *map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(EntryHeader))
+  {
+    map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  // Mark the entry as recently used for eviction, which is fine to fail
+  futimens(fd, nullptr);
+  close(fd);
+  if (map == MAP_FAILED)
+    return nullptr;
+
+  const auto map_size = static_cast<size_t>(st.st_size);
+  auto entry = std::make_shared<MappedEntry>(static_cast<const uint8_t *>(map), map_size);
+  const auto *header = static_cast<const EntryHeader *>(map);
+  if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+      header->payload_size != map_size - sizeof(EntryHeader))
+  {
+    VERBOSE(CompileCache) << "Ignore invalid entry " << file << std::endl;
+    return nullptr;
+  }
+
+  VERBOSE(CompileCache) << "Hit " << file << std::endl;
+  return entry;
+}
+
+void CompileCache::store(const Key &key, const void *data, size_t size) const
+{
+  const auto entry_size = sizeof(EntryHeader) + size;
+  if (_max_size > 0)
+  {
+    if (entry_size > _max_size)
+    {
+      VERBOSE(CompileCache) << "Skip an entry larger than the cache size" << std::endl;
+      return;
+    }
+    evict(entry_size);
+  }
+
+  const auto file = path(key);
+  const auto temp_file = file + "." + std::to_string(getpid()) + ".tmp";
+  int fd = open(temp_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    VERBOSE(CompileCache) << "Cannot write " << temp_file << std::endl;
+    return;
+  }
+
+  EntryHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.payload_size = size;
+
+  auto write_all = [fd](const void *buf, size_t len) {
+    const auto *p = static_cast<const uint8_t *>(buf);
+    while (len > 0)
+    {
+      const auto written = write(fd, p, len);
+      if (written <= 0)
+        return false;
+      p += written;
+      len -= written;
+    }
+    return true;
+  };
+
+  const bool written = write_all(&header, sizeof(header)) && write_all(data, size);
+  close(fd);
+  if (!written || rename(temp_file.c_str(), file.c_str()) != 0)
+  {
+    VERBOSE(CompileCache) << "Cannot write " << file << std::endl;
+    unlink(temp_file.c_str());
+    return;
+  }
+
+  VERBOSE(CompileCache) << "Stored " << file << std::endl;
+}
+
+} // namespace util
+} // namespace onert
@@ -323,6 +323,24 @@ ir::Shape inferConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape
   return ir::Shape{ifm_shape.N, out_h_w.first, out_h_w.second, kf_shape.N};
 }
 
+ir::Shape inferDepthToSpaceShape(const ir::Shape &in_shape, const int32_t block_size)
+{
+  if (in_shape.rank() != 4)
+  {
+    throw std::runtime_error{"DepthToSpace: input rank must be 4, rank = " +
+                             std::to_string(in_shape.rank())};
+  }
+  if (block_size < 1 || in_shape.dim(3) % (block_size * block_size) != 0)
+  {
+    throw std::runtime_error{
+        "DepthToSpace: depth must be divisible by block_size^2, block_size = " +
+        std::to_string(block_size)};
+  }
+
+  return ir::Shape{in_shape.dim(0), in_shape.dim(1) * block_size, in_shape.dim(2) * block_size,
+                   in_shape.dim(3) / (block_size * block_size)};
+}
+
 ir::Shape inferDepthwiseConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape,
                                     const ir::operation::DepthwiseConv2D::Param &param,
                                     ir::Layout layout)
@@ -493,10 +511,10 @@ ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, const int32_t outp
     throw std::runtime_error{"ResizeBilinear: size value must be positive value, output_height = " +
                              std::to_string(output_height)};
   }
-  if (output_height < 0)
+  if (output_width < 0)
   {
     throw std::runtime_error{"ResizeBilinear: size value must be positive value, output_width = " +
-                             std::to_string(output_height)};
+                             std::to_string(output_width)};
   }
 
   ir::Shape ret(in_shape.rank());
@@ -984,6 +1002,24 @@ ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier,
   return new_Shape;
 }
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, const int32_t k)
+{
+  const auto rank = in_shape.rank();
+  if (rank < 1)
+  {
+    throw std::runtime_error{"TopKV2: input rank must be at least 1"};
+  }
+  if (k < 0 || k > in_shape.dim(rank - 1))
+  {
+    throw std::runtime_error{"TopKV2: k must be in [0, last dimension], k = " + std::to_string(k)};
+  }
+
+  // Both the values and the indices outputs have this shape
+  ir::Shape ret = in_shape;
+  ret.dim(rank - 1) = k;
+  return ret;
+}
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm,
                               const int32_t perm_size)
 {
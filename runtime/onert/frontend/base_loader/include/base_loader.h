@@ -156,6 +156,9 @@ private:
   void loadLogSoftmax(const Operator *op, ir::Graph &subg);
   void loadSpaceToDepth(const Operator *op, ir::Graph &subg);
   void loadLeakyRelu(const Operator *op, ir::Graph &subg);
+  void loadDepthToSpace(const Operator *op, ir::Graph &subg);
+  void loadLocalResponseNormalization(const Operator *op, ir::Graph &subg);
+  void loadTopKV2(const Operator *op, ir::Graph &subg);
 
 protected:
   // Base address for mapped region for loading (if needed)
@@ -337,24 +340,32 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   auto q_params = tensor->quantization();
   float scale = 0.0;
   long zero_point = 0;
+  std::vector<float> scales;
+  int32_t quantized_dimension = 0;
   if (q_params != nullptr)
   {
-    if (q_params->scale())
+    if (q_params->scale() && q_params->scale()->size() > 0)
     {
-      if (q_params->scale()->size() != 1)
+      scale = q_params->scale()->Get(0);
+      // Tensor quantized per channel has a scale for each channel
+      if (q_params->scale()->size() > 1)
       {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        scales.assign(q_params->scale()->begin(), q_params->scale()->end());
+        quantized_dimension = q_params->quantized_dimension();
       }
-      scale = q_params->scale()->Get(0);
     }
 
-    if (q_params->zero_point())
+    if (q_params->zero_point() && q_params->zero_point()->size() > 0)
     {
-      if (q_params->zero_point()->size() != 1)
+      zero_point = q_params->zero_point()->Get(0);
+      // Only symmetric per-channel quantization, whose zero points are all the same, is supported
+      for (auto channel_zero_point : *q_params->zero_point())
       {
-        throw std::runtime_error("Only 1 zero_point value for a tensor is supported.");
+        if (channel_zero_point != zero_point)
+        {
+          throw std::runtime_error("Only the same zero_point value for all channels is supported.");
+        }
       }
-      zero_point = q_params->zero_point()->Get(0);
       // zero_point is long while TypeInfo.zero_point is defined as int32_t.
       assert(zero_point >= std::numeric_limits<int32_t>::min());
       assert(zero_point <= std::numeric_limits<int32_t>::max());
@@ -365,6 +376,8 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   }
   // Create TypeInfo
   ir::TypeInfo type_info(data_type, scale, zero_point);
+  type_info.scales(scales);
+  type_info.quantized_dimension(quantized_dimension);
   // Sparsity
   auto src_sparsity = tensor->sparsity();
   if (src_sparsity != nullptr)
@@ -381,34 +394,40 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
           throw std::runtime_error("traversal_order [0, 1, ..., n-1] is only supported.");
       }
     }
+    // load metadata
+    // Sparse weights of FullyConnected [O, I] and pointwise Conv2D [O, 1, 1, I] are supported,
+    // whose last dimension is compressed in CSR format and may be blocked along the first and
+    // the last dimensions
+    auto dense_rank = shape.rank();
+    if (dense_rank != 2 && !(dense_rank == 4 && shape.dim(1) == 1 && shape.dim(2) == 1))
+      throw std::runtime_error("sparsity is supported only for [O, I] or [O, 1, 1, I] tensor.");
     // check block_map
     int block_rank = 0;
     if (src_sparsity->block_map())
     {
       block_rank = src_sparsity->block_map()->size();
+      if (block_rank > 2)
+        throw std::runtime_error("sparsity block_map is too long.");
       for (int i = 0; i < block_rank; ++i)
       {
-        if (i != src_sparsity->block_map()->Get(i))
-          throw std::runtime_error("block_map [0, 1, ..., n-1] is only supported.");
+        const int block_dim = src_sparsity->block_map()->Get(i);
+        if (block_dim != 0 && block_dim != dense_rank - 1)
+          throw std::runtime_error("sparsity block is supported only in the first and last dims.");
+        if (i > 0 && block_dim <= src_sparsity->block_map()->Get(i - 1))
+          throw std::runtime_error("sparsity block_map must be in ascending order.");
       }
     }
-    // load metadata
     const int dim_metadata_size = src_sparsity->dim_metadata()->size();
-    auto dense_rank = shape.rank();
     if (dense_rank + block_rank != dim_metadata_size)
       throw std::runtime_error("sparsity dim_metadata length is wrong.");
-    bool random_sparsity = dim_metadata_size == 2 && block_rank == 0;
-    bool block2D_sparsity = dim_metadata_size == 4 && block_rank == 2;
-    if (dim_metadata_size != !random_sparsity && !block2D_sparsity)
-      throw std::runtime_error(
-          "sparsity is supported only for 2D tensor with random or 16x1 block sparsity.");
-
-    const auto *src_metadata = src_sparsity->dim_metadata()->Get(0);
-    if (src_metadata->format() != DimensionType::DimensionType_DENSE)
-      throw std::runtime_error("sparse tensor dim[0] is not DENSE");
-    src_metadata = src_sparsity->dim_metadata()->Get(1);
+    for (int i = 0; i < dense_rank - 1; ++i)
+    {
+      if (src_sparsity->dim_metadata()->Get(i)->format() != DimensionType::DimensionType_DENSE)
+        throw std::runtime_error("sparse tensor dim[" + std::to_string(i) + "] is not DENSE");
+    }
+    const auto *src_metadata = src_sparsity->dim_metadata()->Get(dense_rank - 1);
     if (src_metadata->format() != DimensionType::DimensionType_SPARSE_CSR)
-      throw std::runtime_error("sparse tensor dim[0] is not SPARSE_CSR");
+      throw std::runtime_error("sparse tensor last dim is not SPARSE_CSR");
     auto ParseSparseIndexVector = [src_metadata, &w1_segments, &w1_indices]() {
       if (src_metadata->array_segments() == nullptr || src_metadata->array_indices() == nullptr)
         return false;
@@ -444,14 +463,19 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
     };
     if (ParseSparseIndexVector() == false)
       throw std::runtime_error("Error during parsing sparsity index information");
-    // Get block size
+    // Get block size as {rows, cols}, which stays empty for random sparsity
     std::vector<int32_t> block_size;
-    for (int i = 0; i < block_rank; ++i)
+    if (block_rank > 0)
     {
-      auto block_metadata = src_sparsity->dim_metadata()->Get(dense_rank + i);
-      if (block_metadata->format() != DimensionType::DimensionType_DENSE)
-        throw std::runtime_error("block dimension must be DENSE.");
-      block_size.push_back(block_metadata->dense_size());
+      block_size = {1, 1};
+      for (int i = 0; i < block_rank; ++i)
+      {
+        auto block_metadata = src_sparsity->dim_metadata()->Get(dense_rank + i);
+        if (block_metadata->format() != DimensionType::DimensionType_DENSE)
+          throw std::runtime_error("block dimension must be DENSE.");
+        const bool is_col = src_sparsity->block_map()->Get(i) == dense_rank - 1;
+        block_size[is_col ? 1 : 0] = block_metadata->dense_size();
+      }
     }
     type_info.sparsity(std::make_shared<ir::Sparsity>(std::move(w1_segments), std::move(w1_indices),
                                                       std::move(block_size)));
@@ -789,6 +813,8 @@ void BaseLoader<LoaderDomain>::loadResizeNearestNeighbor(const Operator *op, ir:
 {
   ir::operation::ResizeNearestNeighbor::Param param;
   param.align_corners = op->builtin_options_as_ResizeNearestNeighborOptions()->align_corners();
+  param.half_pixel_centers =
+      op->builtin_options_as_ResizeNearestNeighborOptions()->half_pixel_centers();
 
   loadOperationTo<ir::operation::ResizeNearestNeighbor>(op, subg, param);
 }
@@ -1239,6 +1265,50 @@ void BaseLoader<LoaderDomain>::loadLeakyRelu(const Operator *op, ir::Graph &subg
                             1.f);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadDepthToSpace(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::DepthToSpace::Param param;
+  const auto *options = op->builtin_options_as_DepthToSpaceOptions();
+  param.block_size = options->block_size();
+
+  loadOperationTo<ir::operation::DepthToSpace>(op, subg, param);
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadLocalResponseNormalization(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::LocalResponseNormalization::Param param;
+  const auto *options = op->builtin_options_as_LocalResponseNormalizationOptions();
+  param.radius = options->radius();
+  param.bias = options->bias();
+  param.alpha = options->alpha();
+  param.beta = options->beta();
+
+  loadOperationTo<ir::operation::LocalResponseNormalization>(op, subg, param);
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadTopKV2(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  // ir::operation::TopKV2 takes k as a parameter, so k must be a constant
+  const auto &k_operand = subg.operands().at(inputs.at(1));
+  if (!k_operand.isConstant() || k_operand.typeInfo().type() != ir::DataType::INT32)
+    throw std::runtime_error("TopKV2: only constant int32 k is supported.");
+
+  ir::operation::TopKV2::Param param;
+  param.k = k_operand.asScalar<int32_t>();
+
+  std::unique_ptr<ir::Operation> new_op(
+      new ir::operation::TopKV2(ir::OperandIndexSequence{inputs.at(0)}, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg)
 {
@@ -1483,6 +1553,15 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_RANK:
       loadOperationTo<ir::operation::Rank>(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_DEPTH_TO_SPACE:
+      loadDepthToSpace(op, subg);
+      return;
+    case BuiltinOperator::BuiltinOperator_LOCAL_RESPONSE_NORMALIZATION:
+      loadLocalResponseNormalization(op, subg);
+      return;
+    case BuiltinOperator::BuiltinOperator_TOPK_V2:
+      loadTopKV2(op, subg);
+      return;
     default:
       throw std::runtime_error(
           std::string("Unsupported operation: ").append(EnumNameBuiltinOperator(builtin_op)));
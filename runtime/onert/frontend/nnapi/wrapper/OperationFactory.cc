@@ -968,15 +968,37 @@ OperationFactory::OperationFactory()
     // Each input should be interpreted as follows:
     //
     //  0 -> IFM Index
-    //  1 -> Height Index
-    //  2 -> Width Index
+    //  1 -> Height Index (INT32 output height or FLOAT32 height scale)
+    //  2 -> Width Index (INT32 output width or FLOAT32 width scale)
+    //  3 -> Layout Index (optional, true for NCHW)
     OperandIndexSequence inputs{init_param.inputs[0]};
 
+    if (init_param.input_count == 4 &&
+        operands.at(OperandIndex{init_param.inputs[3]}).asScalar<bool>())
+    {
+      throw std::runtime_error{"RESIZE_NEAREST_NEIGHBOR: NCHW layout is not supported"};
+    }
+
+    const auto &ifm = operands.at(OperandIndex{init_param.inputs[0]});
+    const auto &height = operands.at(OperandIndex{init_param.inputs[1]});
+    const auto &width = operands.at(OperandIndex{init_param.inputs[2]});
+
     operation::ResizeNearestNeighbor::Param param;
-    param.height_out = operands.at(OperandIndex{init_param.inputs[1]}).asScalar<int32_t>();
-    param.width_out = operands.at(OperandIndex{init_param.inputs[2]}).asScalar<int32_t>();
+    if (height.typeInfo().type() == DataType::FLOAT32)
+    {
+      // Scales give the output size as floor(input size * scale)
+      assert(width.typeInfo().type() == DataType::FLOAT32);
+      const auto ifm_shape = ifm.shape().asFeature(Layout::NHWC);
+      param.height_out = static_cast<int32_t>(ifm_shape.H * height.asScalar<float>());
+      param.width_out = static_cast<int32_t>(ifm_shape.W * width.asScalar<float>());
+    }
+    else
+    {
+      param.height_out = height.asScalar<int32_t>();
+      param.width_out = width.asScalar<int32_t>();
+    }
     param.align_corners = false;
-    // The layout input is not supported yet
+    param.half_pixel_centers = false;
     return new operation::ResizeNearestNeighbor{inputs, outputs, param};
   };
 
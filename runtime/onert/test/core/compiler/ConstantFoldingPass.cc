@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/pass/ConstantFoldingPass.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Concat.h"
+#include "ir/operation/Fill.h"
+#include "ir/operation/Transpose.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert::ir;
+using onert::compiler::pass::ConstantFoldingPass;
+
+const TypeInfo float_type{DataType::FLOAT32};
+const TypeInfo int32_type{DataType::INT32};
+
+template <typename T>
+OperandIndex addConstant(Graph &graph, const Shape &shape, const TypeInfo &type,
+                         const std::vector<T> &values)
+{
+  auto ind = graph.addOperand(shape, type);
+  graph.operands().at(ind).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(T)));
+  return ind;
+}
+
+// output <= input + rhs, so that the folded operand stays used
+void addConsumer(Graph &graph, const OperandIndex &rhs, const Shape &shape)
+{
+  auto input = graph.addOperand(shape, float_type);
+  auto output = graph.addOperand(shape, float_type);
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{input, rhs}, OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addOutput(output);
+}
+
+size_t countOperations(const Graph &graph)
+{
+  size_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &) { ++count; });
+  return count;
+}
+
+} // namespace
+
+TEST(ConstantFoldingPass, TransposeAndConcat)
+{
+  // folded <= concat(transpose(weights), weights2) along the last axis
+  Graph graph;
+  auto weights = addConstant<float>(graph, Shape{2, 3}, float_type, {0, 1, 2, 3, 4, 5});
+  auto perm = addConstant<int32_t>(graph, Shape{2}, int32_type, {1, 0});
+  auto transposed = graph.addOperand(Shape{3, 2}, float_type);
+  auto weights2 = addConstant<float>(graph, Shape{3, 1}, float_type, {6, 7, 8});
+  auto folded = graph.addOperand(Shape{3, 3}, float_type);
+  graph.addOperation(std::make_unique<operation::Transpose>(OperandIndexSequence{weights, perm},
+                                                            OperandIndexSequence{transposed}));
+  graph.addOperation(std::make_unique<operation::Concat>(
+      OperandIndexSequence{transposed, weights2}, OperandIndexSequence{folded},
+      operation::Concat::Param{-1}));
+  addConsumer(graph, folded, Shape{3, 3});
+  graph.finishBuilding();
+
+  ConstantFoldingPass pass{graph};
+  pass.run();
+
+  EXPECT_EQ(pass.folded_count(), 2);
+  EXPECT_EQ(countOperations(graph), 1);
+  const auto &folded_obj = graph.operands().at(folded);
+  ASSERT_TRUE(folded_obj.isConstant());
+  EXPECT_FALSE(folded_obj.getDef().valid());
+  EXPECT_EQ(folded_obj.shape(), (Shape{3, 3}));
+  EXPECT_EQ(folded_obj.asVector<float>(), (std::vector<float>{0, 3, 6, 1, 4, 7, 2, 5, 8}));
+
+  // Inputs used only by the folded operations are dropped
+  for (const auto &ind : {weights, perm, transposed, weights2})
+    EXPECT_FALSE(graph.operands().exist(ind));
+}
+
+TEST(ConstantFoldingPass, OutputSizeLimit)
+{
+  // A Fill whose output is over the limit stays as an operation
+  Graph graph;
+  auto dims = addConstant<int32_t>(graph, Shape{2}, int32_type, {64, 64});
+  auto value = addConstant<float>(graph, Shape{1}, float_type, {1.f});
+  auto filled = graph.addOperand(Shape{64, 64}, float_type);
+  graph.addOperation(std::make_unique<operation::Fill>(OperandIndexSequence{dims, value},
+                                                       OperandIndexSequence{filled}));
+  addConsumer(graph, filled, Shape{64, 64});
+  graph.finishBuilding();
+
+  ConstantFoldingPass limited{graph, 64 * 64 * sizeof(float) - 1};
+  limited.run();
+  EXPECT_EQ(limited.folded_count(), 0);
+  EXPECT_EQ(countOperations(graph), 2);
+  EXPECT_FALSE(graph.operands().at(filled).isConstant());
+
+  // The same Fill within the limit is folded
+  ConstantFoldingPass pass{graph, 64 * 64 * sizeof(float)};
+  pass.run();
+  EXPECT_EQ(pass.folded_count(), 1);
+  EXPECT_EQ(countOperations(graph), 1);
+  const auto &filled_obj = graph.operands().at(filled);
+  ASSERT_TRUE(filled_obj.isConstant());
+  EXPECT_EQ(filled_obj.asVector<float>(), std::vector<float>(64 * 64, 1.f));
+}
+
+TEST(ConstantFoldingPass, NegativeFillDims)
+{
+  Graph graph;
+  auto dims = addConstant<int32_t>(graph, Shape{2}, int32_type, {2, -3});
+  auto value = addConstant<float>(graph, Shape{1}, float_type, {1.f});
+  auto filled = graph.addOperand(Shape{2, 3}, float_type);
+  graph.addOperation(std::make_unique<operation::Fill>(OperandIndexSequence{dims, value},
+                                                       OperandIndexSequence{filled}));
+  addConsumer(graph, filled, Shape{2, 3});
+  graph.finishBuilding();
+
+  ConstantFoldingPass pass{graph};
+  pass.run();
+  EXPECT_EQ(pass.folded_count(), 0);
+  EXPECT_FALSE(graph.operands().at(filled).isConstant());
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/Linear.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/Reshape.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace
+{
+
+using namespace onert::ir;
+using onert::compiler::Linear;
+
+const TypeInfo float_type{DataType::FLOAT32};
+
+OperationIndex addRelu(Graph &graph, const OperandIndex &input, const OperandIndex &output)
+{
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  param.alpha = std::numeric_limits<float>::infinity();
+  param.beta = 0.f;
+  return graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+      OperandIndexSequence{input}, OperandIndexSequence{output}, param));
+}
+
+OperationIndex addReshape(Graph &graph, const OperandIndex &input, const OperandIndex &output)
+{
+  operation::Reshape::Param param;
+  const auto &shape = graph.operands().at(output).shape();
+  for (int i = 0; i < shape.rank(); ++i)
+    param.new_shape.push_back(shape.dim(i));
+  auto new_shape = graph.addOperand(Shape{shape.rank()}, TypeInfo{DataType::INT32});
+  graph.operands().at(new_shape).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(param.new_shape.data()),
+      param.new_shape.size() * sizeof(int32_t)));
+  return graph.addOperation(std::make_unique<operation::Reshape>(
+      OperandIndexSequence{input, new_shape}, OperandIndexSequence{output}, param));
+}
+
+OperationIndex addAdd(Graph &graph, const OperandIndex &lhs, const OperandIndex &rhs,
+                      const OperandIndex &output)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  return graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+}
+
+} // namespace
+
+// input -> Relu -> a {1, 2, 2, 1} -> Reshape -> b {1, 4} -> Add(b, c {1}) -> d -> Relu -> output
+TEST(Linear, inplace_candidates)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto a = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto b = graph.addOperand(Shape{1, 4}, float_type);
+  auto c = graph.addOperand(Shape{1}, float_type);
+  auto d = graph.addOperand(Shape{1, 4}, float_type);
+  auto output = graph.addOperand(Shape{1, 4}, float_type);
+  auto relu = addRelu(graph, input, a);
+  auto reshape = addReshape(graph, a, b);
+  auto add = addAdd(graph, b, c, d);
+  auto relu2 = addRelu(graph, d, output);
+  graph.addInput(input);
+  graph.addInput(c);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  // Reshape changes the shape but keeps the bytes
+  auto reshape_candidates = Linear::getInPlaceCandidates(graph, graph.operations().at(reshape));
+  ASSERT_EQ(reshape_candidates.size(), 1);
+  EXPECT_EQ(reshape_candidates.at(0), a);
+  // Model inputs and outputs are not in the arena
+  EXPECT_EQ(Linear::getInPlaceCandidates(graph, graph.operations().at(relu)).size(), 0);
+  EXPECT_EQ(Linear::getInPlaceCandidates(graph, graph.operations().at(relu2)).size(), 0);
+  // Only b has the shape of the output
+  auto add_candidates = Linear::getInPlaceCandidates(graph, graph.operations().at(add));
+  ASSERT_EQ(add_candidates.size(), 1);
+  EXPECT_EQ(add_candidates.at(0), b);
+}
+
+TEST(Linear, neg_inplace_candidates)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 4}, float_type);
+  auto a = graph.addOperand(Shape{1, 4}, float_type);
+  auto b = graph.addOperand(Shape{4}, TypeInfo{DataType::INT32});
+  auto c = graph.addOperand(Shape{1}, float_type);
+  auto d = graph.addOperand(Shape{1, 4}, float_type);
+  auto output = graph.addOperand(Shape{1, 4}, float_type);
+  addRelu(graph, input, a);
+  addRelu(graph, input, c);
+  // The same bytes of another type
+  auto reshape = addReshape(graph, a, b);
+  // c is broadcast, and a is used by reshape, which the planner checks later
+  auto add = addAdd(graph, c, a, d);
+  addRelu(graph, d, output);
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  EXPECT_EQ(Linear::getInPlaceCandidates(graph, graph.operations().at(reshape)).size(), 0);
+  auto add_candidates = Linear::getInPlaceCandidates(graph, graph.operations().at(add));
+  ASSERT_EQ(add_candidates.size(), 1);
+  EXPECT_EQ(add_candidates.at(0), a);
+}
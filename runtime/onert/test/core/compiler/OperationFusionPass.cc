@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/pass/OperationFusionPass.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/verifier/Verifier.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace
+{
+
+using namespace onert::ir;
+using onert::compiler::pass::OperationFusionPass;
+
+const TypeInfo float_type{DataType::FLOAT32};
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &values)
+{
+  auto ind = graph.addOperand(shape, float_type);
+  graph.operands().at(ind).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+  return ind;
+}
+
+OperationIndex addConv(Graph &graph, const OperandIndex &input, const OperandIndex &weights,
+                       const OperandIndex &bias, const OperandIndex &output)
+{
+  operation::Conv2D::Param param;
+  param.stride = Stride{1, 1};
+  param.padding.type = PaddingType::VALID;
+  param.activation = Activation::NONE;
+  param.dilation = Dilation{1, 1};
+  return graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, weights, bias}, OperandIndexSequence{output}, param));
+}
+
+OperationIndex addBinary(Graph &graph, operation::BinaryArithmetic::ArithmeticType type,
+                         const OperandIndex &lhs, const OperandIndex &rhs,
+                         const OperandIndex &output)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = type;
+  param.activation = Activation::NONE;
+  return graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+}
+
+OperationIndex addRelu(Graph &graph, float upper_bound, const OperandIndex &input,
+                       const OperandIndex &output)
+{
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  param.alpha = upper_bound;
+  param.beta = 0.f;
+  return graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+      OperandIndexSequence{input}, OperandIndexSequence{output}, param));
+}
+
+std::vector<OperationIndex> operationsOf(const Graph &graph)
+{
+  std::vector<OperationIndex> indices;
+  graph.operations().iterate(
+      [&](const OperationIndex &index, const Operation &) { indices.emplace_back(index); });
+  return indices;
+}
+
+bool isConsistent(const Graph &graph)
+{
+  return verifier::DAGChecker{}.verify(graph) && verifier::EdgeConsistencyChecker{}.verify(graph);
+}
+
+} // namespace
+
+TEST(OperationFusionPass, ConvMulAddRelu6)
+{
+  // output <= relu6((conv(input, weights, bias) * {2, 3}) + {1, -1})
+  const Shape feature_shape{1, 2, 2, 2};
+  const std::vector<float> weights_data{1, -2};
+  const std::vector<float> bias_data{0.5f, 1};
+  const std::vector<float> scale_data{2, 3};
+  const std::vector<float> offset_data{1, -1};
+
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto weights = addConstant(graph, Shape{2, 1, 1, 1}, weights_data);
+  auto bias = addConstant(graph, Shape{2}, bias_data);
+  auto conv_out = graph.addOperand(feature_shape, float_type);
+  auto scale = addConstant(graph, Shape{2}, scale_data);
+  auto mul_out = graph.addOperand(feature_shape, float_type);
+  auto offset = addConstant(graph, Shape{2}, offset_data);
+  auto add_out = graph.addOperand(feature_shape, float_type);
+  auto output = graph.addOperand(feature_shape, float_type);
+  addConv(graph, input, weights, bias, conv_out);
+  addBinary(graph, operation::BinaryArithmetic::ArithmeticType::MUL, conv_out, scale, mul_out);
+  addBinary(graph, operation::BinaryArithmetic::ArithmeticType::ADD, mul_out, offset, add_out);
+  addRelu(graph, 6.f, add_out, output);
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  OperationFusionPass pass{graph};
+  pass.run();
+
+  EXPECT_EQ(pass.fused_count(), 3);
+  const auto indices = operationsOf(graph);
+  ASSERT_EQ(indices.size(), 1);
+  const auto &fused = graph.operations().at(indices[0]);
+  ASSERT_EQ(fused.opcode(), OpCode::Conv2D);
+  EXPECT_EQ(static_cast<const operation::Conv2D &>(fused).param().activation, Activation::RELU6);
+  EXPECT_EQ(fused.getOutputs().at(0), output);
+  EXPECT_EQ(fused.getInputs().at(operation::Conv2D::Input::INPUT), input);
+
+  const auto &fused_weights =
+      graph.operands().at(fused.getInputs().at(operation::Conv2D::Input::KERNEL));
+  const auto &fused_bias = graph.operands().at(fused.getInputs().at(operation::Conv2D::Input::BIAS));
+  EXPECT_EQ(fused_weights.asVector<float>(), (std::vector<float>{2, -6}));
+  EXPECT_EQ(fused_bias.asVector<float>(), (std::vector<float>{2, 2}));
+
+  // Intermediate results and the replaced constants are gone
+  for (const auto &ind : {conv_out, mul_out, add_out, weights, bias, scale, offset})
+    EXPECT_FALSE(graph.operands().exist(ind));
+  EXPECT_TRUE(isConsistent(graph));
+}
+
+TEST(OperationFusionPass, SharedWeights)
+{
+  // out1 <= conv(input, weights, bias) * 2, out2 <= conv(input, weights, bias)
+  // Scaling the weights for out1 must not change what the other convolution reads
+  const Shape feature_shape{1, 2, 2, 2};
+  const std::vector<float> weights_data{1, -2};
+  const std::vector<float> bias_data{0.5f, 1};
+  const std::vector<float> scale_data{2};
+
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto weights = addConstant(graph, Shape{2, 1, 1, 1}, weights_data);
+  auto bias = addConstant(graph, Shape{2}, bias_data);
+  auto conv1_out = graph.addOperand(feature_shape, float_type);
+  auto scale = addConstant(graph, Shape{1}, scale_data);
+  auto out1 = graph.addOperand(feature_shape, float_type);
+  auto out2 = graph.addOperand(feature_shape, float_type);
+  addConv(graph, input, weights, bias, conv1_out);
+  addBinary(graph, operation::BinaryArithmetic::ArithmeticType::MUL, conv1_out, scale, out1);
+  const auto conv2 = addConv(graph, input, weights, bias, out2);
+  graph.addInput(input);
+  graph.addOutput(out1);
+  graph.addOutput(out2);
+  graph.finishBuilding();
+
+  OperationFusionPass pass{graph};
+  pass.run();
+
+  EXPECT_EQ(pass.fused_count(), 1);
+  EXPECT_EQ(operationsOf(graph).size(), 2);
+
+  // The unfused convolution keeps the shared constants as they were
+  ASSERT_TRUE(graph.operations().exist(conv2));
+  ASSERT_TRUE(graph.operands().exist(weights));
+  ASSERT_TRUE(graph.operands().exist(bias));
+  EXPECT_EQ(graph.operands().at(weights).asVector<float>(), weights_data);
+  EXPECT_EQ(graph.operands().at(bias).asVector<float>(), bias_data);
+  EXPECT_EQ(graph.operands().at(weights).getUses().size(), 1);
+  EXPECT_TRUE(graph.operands().at(weights).getUses().contains(conv2));
+
+  const auto &fused = graph.operations().at(graph.operands().at(out1).getDef());
+  ASSERT_EQ(fused.opcode(), OpCode::Conv2D);
+  EXPECT_NE(fused.getInputs().at(operation::Conv2D::Input::KERNEL), weights);
+  EXPECT_EQ(graph.operands().at(fused.getInputs().at(operation::Conv2D::Input::KERNEL))
+                .asVector<float>(),
+            (std::vector<float>{2, -4}));
+  EXPECT_EQ(graph.operands().at(fused.getInputs().at(operation::Conv2D::Input::BIAS))
+                .asVector<float>(),
+            (std::vector<float>{1, 2}));
+  EXPECT_TRUE(isConsistent(graph));
+}
+
+TEST(OperationFusionPass, AddSameOperands)
+{
+  // output <= relu(x + x) where x <= conv(input, weights, bias)
+  const Shape feature_shape{1, 2, 2, 2};
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto weights = addConstant(graph, Shape{2, 1, 1, 1}, {1, -2});
+  auto bias = addConstant(graph, Shape{2}, {0.5f, 1});
+  auto x = graph.addOperand(feature_shape, float_type);
+  auto sum = graph.addOperand(feature_shape, float_type);
+  auto output = graph.addOperand(feature_shape, float_type);
+  const auto conv = addConv(graph, input, weights, bias, x);
+  const auto add = addBinary(graph, operation::BinaryArithmetic::ArithmeticType::ADD, x, x, sum);
+  addRelu(graph, std::numeric_limits<float>::infinity(), sum, output);
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  OperationFusionPass pass{graph};
+  pass.run();
+
+  // Only the activation is fused, since no side of the addition is constant
+  EXPECT_EQ(pass.fused_count(), 1);
+  EXPECT_EQ(operationsOf(graph).size(), 2);
+  EXPECT_TRUE(graph.operations().exist(conv));
+  EXPECT_FALSE(graph.operations().exist(add));
+
+  const auto fused_index = graph.operands().at(output).getDef();
+  const auto &fused = graph.operations().at(fused_index);
+  ASSERT_EQ(fused.opcode(), OpCode::BinaryArithmetic);
+  EXPECT_EQ(static_cast<const operation::BinaryArithmetic &>(fused).param().activation,
+            Activation::RELU);
+  ASSERT_EQ(fused.getInputs().size(), 2);
+  EXPECT_EQ(fused.getInputs().at(0), x);
+  EXPECT_EQ(fused.getInputs().at(1), x);
+
+  const auto &x_uses = graph.operands().at(x).getUses();
+  EXPECT_EQ(x_uses.size(), 1);
+  EXPECT_TRUE(x_uses.contains(fused_index));
+  EXPECT_FALSE(graph.operands().exist(sum));
+  EXPECT_TRUE(isConsistent(graph));
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/OperationValidator.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/FullyConnected.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert::ir;
+using onert::compiler::OperationValidator;
+
+TypeInfo perChannelType(DataType type, int32_t num_channels, int32_t quantized_dimension)
+{
+  TypeInfo type_info{type, 0.1f, 0};
+  type_info.scales(std::vector<float>(num_channels, 0.1f));
+  type_info.quantized_dimension(quantized_dimension);
+  return type_info;
+}
+
+// FullyConnected of [2, 8] input and [4, 8] weights
+std::unique_ptr<Graph> fullyConnectedGraph(DataType input_type, const TypeInfo &weights_type,
+                                           const TypeInfo &bias_type)
+{
+  auto graph = std::make_unique<Graph>();
+  const TypeInfo activation_type{input_type, 0.5f, 0};
+  auto input = graph->addOperand(Shape{2, 8}, activation_type);
+  auto weights = graph->addOperand(Shape{4, 8}, weights_type);
+  auto bias = graph->addOperand(Shape{4}, bias_type);
+  auto output = graph->addOperand(Shape{2, 4}, activation_type);
+  operation::FullyConnected::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weights, bias}, OperandIndexSequence{output}, param));
+  graph->addInput(input);
+  graph->addInput(weights);
+  graph->addInput(bias);
+  graph->addOutput(output);
+  graph->finishBuilding();
+  return graph;
+}
+
+} // namespace
+
+TEST(OperationValidator, PerChannelFullyConnected)
+{
+  auto graph = fullyConnectedGraph(DataType::QUANT_INT8_SYMM,
+                                   perChannelType(DataType::QUANT_INT8_SYMM, 4, 0),
+                                   perChannelType(DataType::INT32, 4, 0));
+  EXPECT_NO_THROW(OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, PerChannelConv2D)
+{
+  // Kernel of [depth_out, kernel_height, kernel_width, depth_in]
+  Graph graph;
+  const TypeInfo activation_type{DataType::QUANT_INT8_SYMM, 0.5f, 0};
+  auto input = graph.addOperand(Shape{1, 3, 3, 2}, activation_type);
+  auto kernel =
+      graph.addOperand(Shape{5, 3, 3, 2}, perChannelType(DataType::QUANT_INT8_SYMM, 5, 0));
+  auto bias = graph.addOperand(Shape{5}, perChannelType(DataType::INT32, 5, 0));
+  auto output = graph.addOperand(Shape{1, 1, 1, 5}, activation_type);
+  operation::Conv2D::Param param;
+  param.stride = Stride{1, 1};
+  param.padding.type = PaddingType::VALID;
+  param.activation = Activation::NONE;
+  param.dilation = Dilation{1, 1};
+  graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addInput(kernel);
+  graph.addInput(bias);
+  graph.addOutput(output);
+  graph.finishBuilding();
+  EXPECT_NO_THROW(OperationValidator{graph}());
+}
+
+TEST(OperationValidator, neg_PerChannelWrongDimension)
+{
+  // Scales along input channels
+  auto graph = fullyConnectedGraph(DataType::QUANT_INT8_SYMM,
+                                   perChannelType(DataType::QUANT_INT8_SYMM, 8, 1),
+                                   TypeInfo{DataType::INT32, 0.05f, 0});
+  EXPECT_ANY_THROW(OperationValidator{*graph}());
+
+  // Number of scales different from the number of channels
+  graph = fullyConnectedGraph(DataType::QUANT_INT8_SYMM,
+                              perChannelType(DataType::QUANT_INT8_SYMM, 3, 0),
+                              TypeInfo{DataType::INT32, 0.05f, 0});
+  EXPECT_ANY_THROW(OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_PerChannelHybrid)
+{
+  // Hybrid kernels have a single scale of weights
+  auto graph = fullyConnectedGraph(DataType::FLOAT32,
+                                   perChannelType(DataType::QUANT_INT8_SYMM, 4, 0),
+                                   TypeInfo{DataType::FLOAT32});
+  EXPECT_ANY_THROW(OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_PerChannelUnsupportedOperation)
+{
+  Graph graph;
+  const TypeInfo type{DataType::QUANT_INT8_SYMM, 0.5f, 0};
+  auto lhs = graph.addOperand(Shape{1, 4}, type);
+  auto rhs = graph.addOperand(Shape{1, 4}, perChannelType(DataType::QUANT_INT8_SYMM, 4, 1));
+  auto output = graph.addOperand(Shape{1, 4}, type);
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(output);
+  graph.finishBuilding();
+  EXPECT_ANY_THROW(OperationValidator{graph}());
+}
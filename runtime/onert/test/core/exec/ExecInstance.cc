@@ -15,12 +15,18 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "ir/Graph.h"
 #include "compiler/Compiler.h"
 #include "exec/Execution.h"
 #include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Comparison.h"
+#include "ir/operation/While.h"
 
 namespace
 {
@@ -30,7 +36,7 @@ using namespace onert::ir;
 class CompiledMockUpModel
 {
 public:
-  CompiledMockUpModel()
+  CompiledMockUpModel(int num_exec_contexts = 1, bool zero_copy_io = false, int num_threads = -1)
   {
     // Model: two elementwise add operation
     // model input: lhs, rhs1
@@ -78,6 +84,167 @@ public:
     auto subgs = std::make_shared<onert::ir::Subgraphs>();
     subgs->push(onert::ir::SubgraphIndex{0}, graph);
     onert::compiler::Compiler compiler{subgs};
+    compiler.options().num_exec_contexts = num_exec_contexts;
+    compiler.options().zero_copy_io = zero_copy_io;
+    compiler.options().num_threads = num_threads;
+    executors = compiler.compile();
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+};
+
+// Model whose two branches run concurrently on the Parallel executor
+class CompiledParallelMockUpModel
+{
+public:
+  CompiledParallelMockUpModel()
+  {
+    // Model: two independent operations and an add of their results
+    // model input: lhs, rhs
+    // model output: sum of results (result)
+    // result1 <= (lhs + rhs)
+    // result2 <= (lhs - rhs)
+    // result <= (result1 + result2)
+    // all shape: {1, 2, 2, 1}
+    graph = std::make_shared<Graph>();
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+    auto operand_lhs = graph->addOperand(shape, type);
+    auto operand_rhs = graph->addOperand(shape, type);
+    auto operand_result1 = graph->addOperand(shape, type);
+    auto operand_result2 = graph->addOperand(shape, type);
+    auto operand_result = graph->addOperand(shape, type);
+    auto add_operation = [&](operation::BinaryArithmetic::ArithmeticType arithmetic_type,
+                             OperandIndex lhs, OperandIndex rhs, OperandIndex out) {
+      operation::BinaryArithmetic::Param param;
+      param.arithmetic_type = arithmetic_type;
+      param.activation = Activation::NONE;
+      graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+          OperandIndexSequence{lhs, rhs}, OperandIndexSequence{out}, param));
+    };
+    add_operation(operation::BinaryArithmetic::ArithmeticType::ADD, operand_lhs, operand_rhs,
+                  operand_result1);
+    add_operation(operation::BinaryArithmetic::ArithmeticType::SUB, operand_lhs, operand_rhs,
+                  operand_result2);
+    add_operation(operation::BinaryArithmetic::ArithmeticType::ADD, operand_result1,
+                  operand_result2, operand_result);
+    graph->addInput(operand_lhs);
+    graph->addInput(operand_rhs);
+    graph->addOutput(operand_result);
+    graph->finishBuilding();
+
+    // Compile
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    subgs->push(onert::ir::SubgraphIndex{0}, graph);
+    onert::compiler::Compiler compiler{subgs};
+    compiler.options().executor = "Parallel";
+    compiler.options().parallel_threads = 4;
+    executors = compiler.compile();
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+};
+
+// Model whose While loop carries its tensors between iterations
+class CompiledWhileMockUpModel
+{
+public:
+  CompiledWhileMockUpModel()
+  {
+    // Model: While loop over a counter and an accumulator
+    // model input: counter (i), accumulator (x)
+    // model output: loop results of counter and accumulator
+    // cond: i < limit (accumulator is not used)
+    // body: i <= (i + 1), x <= (x + step)
+    // counter shape: {1}, accumulator shape: {1, 2, 2, 1}
+    const Shape counter_shape{1};
+    const Shape shape{1, 2, 2, 1};
+    const TypeInfo counter_type{DataType::INT32};
+    const TypeInfo type{DataType::FLOAT32};
+    static int32_t limit_data[1] = {4};
+    static int32_t one_data[1] = {1};
+    static float step_data[4] = {1, -2, 0.5, 4};
+
+    // Cond subgraph
+    auto cond = std::make_shared<Graph>();
+    {
+      auto operand_i = cond->addOperand(counter_shape, counter_type);
+      auto operand_x = cond->addOperand(shape, type);
+      auto operand_limit = cond->addOperand(counter_shape, counter_type);
+      auto operand_result = cond->addOperand(counter_shape, TypeInfo{DataType::BOOL8});
+      cond->operands()
+          .at(operand_limit)
+          .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&limit_data), 4));
+      operation::Comparison::Param param;
+      param.comparison_type = operation::Comparison::ComparisonType::Less;
+      cond->addOperation(std::make_unique<operation::Comparison>(
+          OperandIndexSequence{operand_i, operand_limit}, OperandIndexSequence{operand_result},
+          param));
+      cond->addInput(operand_i);
+      cond->addInput(operand_x);
+      cond->addOutput(operand_result);
+      cond->finishBuilding();
+    }
+
+    // Body subgraph
+    auto body = std::make_shared<Graph>();
+    {
+      auto operand_i = body->addOperand(counter_shape, counter_type);
+      auto operand_x = body->addOperand(shape, type);
+      auto operand_one = body->addOperand(counter_shape, counter_type);
+      auto operand_step = body->addOperand(shape, type);
+      auto operand_next_i = body->addOperand(counter_shape, counter_type);
+      auto operand_next_x = body->addOperand(shape, type);
+      body->operands()
+          .at(operand_one)
+          .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&one_data), 4));
+      body->operands()
+          .at(operand_step)
+          .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&step_data), 16));
+      operation::BinaryArithmetic::Param param;
+      param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+      param.activation = Activation::NONE;
+      body->addOperation(std::make_unique<operation::BinaryArithmetic>(
+          OperandIndexSequence{operand_i, operand_one}, OperandIndexSequence{operand_next_i},
+          param));
+      body->addOperation(std::make_unique<operation::BinaryArithmetic>(
+          OperandIndexSequence{operand_x, operand_step}, OperandIndexSequence{operand_next_x},
+          param));
+      body->addInput(operand_i);
+      body->addInput(operand_x);
+      body->addOutput(operand_next_i);
+      body->addOutput(operand_next_x);
+      body->finishBuilding();
+    }
+
+    // Primary subgraph
+    graph = std::make_shared<Graph>();
+    auto operand_i = graph->addOperand(counter_shape, counter_type);
+    auto operand_x = graph->addOperand(shape, type);
+    auto operand_result_i = graph->addOperand(counter_shape, counter_type);
+    auto operand_result_x = graph->addOperand(shape, type);
+    operation::While::Param param;
+    param.cond_subg_index = SubgraphIndex{1};
+    param.body_subg_index = SubgraphIndex{2};
+    graph->addOperation(std::make_unique<operation::While>(
+        OperandIndexSequence{operand_i, operand_x},
+        OperandIndexSequence{operand_result_i, operand_result_x}, param));
+    graph->addInput(operand_i);
+    graph->addInput(operand_x);
+    graph->addOutput(operand_result_i);
+    graph->addOutput(operand_result_x);
+    graph->finishBuilding();
+
+    // Compile
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    subgs->push(SubgraphIndex{0}, graph);
+    subgs->push(SubgraphIndex{1}, cond);
+    subgs->push(SubgraphIndex{2}, body);
+    onert::compiler::Compiler compiler{subgs};
     executors = compiler.compile();
   }
 
@@ -232,6 +399,65 @@ private:
 };
 
 // Support multi-thread execution
+TEST(ExecInstance, zeroCopyIO)
+{
+  auto mockup = CompiledMockUpModel(1, /*zero_copy_io=*/true);
+  auto executors = mockup.executors;
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output1 = IOIndex{0};
+
+  const float exe1_input1_buffer[4] = {1, 0, -1, -2};
+  const float exe1_input2_buffer[4] = {1, -3, 2, -4};
+  float exe1_output_buffer[4] = {};
+  const float exe1_output_expected[4] = {5, -2, 0, -1};
+  const float exe2_input1_buffer[4] = {2, 1, -2, 0};
+  const float exe2_input2_buffer[4] = {-3, 3, 1, 2};
+  float exe2_output_buffer[4] = {};
+  const float exe2_output_expected[4] = {2, 5, -2, 7};
+
+  // Tensors are bound to the user buffers of each execution
+  onert::exec::Execution execution{executors};
+  execution.setInput(input1, reinterpret_cast<const void *>(exe1_input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(exe1_input2_buffer), 16);
+  execution.setOutput(output1, reinterpret_cast<void *>(exe1_output_buffer), 16);
+  execution.execute();
+
+  execution.setInput(input1, reinterpret_cast<const void *>(exe2_input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(exe2_input2_buffer), 16);
+  execution.setOutput(output1, reinterpret_cast<void *>(exe2_output_buffer), 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+    EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+  }
+
+  // An output of another layout is not bound, so its tensor falls back to its own buffer
+  float nchw_output_buffer[4] = {};
+  execution.setOutput(output1, reinterpret_cast<void *>(nchw_output_buffer), 16,
+                      onert::ir::Layout::NCHW);
+  execution.execute();
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(nchw_output_buffer[i], exe2_output_expected[i]);
+  }
+
+  // The first user buffers are bound again
+  std::fill(exe1_output_buffer, exe1_output_buffer + 4, 0.f);
+  execution.setInput(input1, reinterpret_cast<const void *>(exe1_input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(exe1_input2_buffer), 16);
+  execution.setOutput(output1, reinterpret_cast<void *>(exe1_output_buffer), 16);
+  execution.execute();
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+    // The buffer of the previous run is not written through a stale binding
+    EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+  }
+}
+
 TEST(ExecInstance, twoThreads)
 {
   auto mockup = CompiledMockUpModel();
@@ -264,6 +490,132 @@ TEST(ExecInstance, twoThreads)
   }
 }
 
+// Support multi-thread execution on separate execution contexts
+TEST(ExecInstance, twoThreadsMultiContext)
+{
+  auto mockup = CompiledMockUpModel(2);
+  auto executors = mockup.executors;
+
+  const float exe1_input1_buffer[4] = {1, 0, -1, -2};
+  const float exe1_input2_buffer[4] = {1, -3, 2, -4};
+  float exe1_output_buffer[4] = {};
+  const float exe1_output_expected[4] = {5, -2, 0, -1};
+
+  Inference execution1{exe1_input1_buffer, exe1_input2_buffer, exe1_output_buffer, executors};
+
+  const float exe2_input1_buffer[4] = {2, 1, -2, 0};
+  const float exe2_input2_buffer[4] = {-3, 3, 1, 2};
+  float exe2_output_buffer[4] = {};
+  const float exe2_output_expected[4] = {2, 5, -2, 7};
+
+  Inference execution2{exe2_input1_buffer, exe2_input2_buffer, exe2_output_buffer, executors};
+
+  std::thread t1{&Inference::inference, &execution1};
+  std::thread t2{&Inference::inference, &execution2};
+
+  t1.join();
+  t2.join();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+    EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+  }
+}
+
+// Number of threads of this process, or -1 if Linux does not tell it
+int numLiveThreads()
+{
+  std::ifstream status{"/proc/self/status"};
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 8, "Threads:") == 0)
+      return std::stoi(line.substr(8));
+  }
+  return -1;
+}
+
+// Threads of all execution contexts stay in NUM_THREADS with the threads of users
+TEST(ExecInstance, threadBudgetMultiContext)
+{
+  const int threads_before = numLiveThreads();
+  ASSERT_GT(threads_before, 0);
+
+  const int num_threads = 4;
+  auto mockup = CompiledMockUpModel(2, false, num_threads);
+  auto executors = mockup.executors;
+
+  const float exe1_input1_buffer[4] = {1, 0, -1, -2};
+  const float exe1_input2_buffer[4] = {1, -3, 2, -4};
+  float exe1_output_buffer[4] = {};
+  const float exe1_output_expected[4] = {5, -2, 0, -1};
+
+  Inference execution1{exe1_input1_buffer, exe1_input2_buffer, exe1_output_buffer, executors};
+
+  const float exe2_input1_buffer[4] = {2, 1, -2, 0};
+  const float exe2_input2_buffer[4] = {-3, 3, 1, 2};
+  float exe2_output_buffer[4] = {};
+  const float exe2_output_expected[4] = {2, 5, -2, 7};
+
+  Inference execution2{exe2_input1_buffer, exe2_input2_buffer, exe2_output_buffer, executors};
+
+  std::thread t1{&Inference::inference, &execution1};
+  std::thread t2{&Inference::inference, &execution2};
+
+  t1.join();
+  t2.join();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+    EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+  }
+
+  // Two threads of users call kernels, and the runtime keeps the others of NUM_THREADS
+  EXPECT_LE(numLiveThreads() - threads_before, num_threads - 2);
+}
+
+// Dynamic tensors of concurrent operations are allocated and deallocated at the same time
+TEST(ExecInstance, parallelDynamicShape)
+{
+  auto mockup = CompiledParallelMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  onert::exec::Execution execution{executors};
+
+  for (int32_t batch = 1; batch <= 16; batch++)
+  {
+    const Shape new_shape{batch, 2, 2, 1};
+    const auto num_elements = static_cast<size_t>(new_shape.num_elements());
+    std::vector<float> input1_buffer(num_elements);
+    std::vector<float> input2_buffer(num_elements);
+    std::vector<float> output_buffer(num_elements);
+    for (size_t i = 0; i < num_elements; i++)
+    {
+      input1_buffer[i] = static_cast<float>(i);
+      input2_buffer[i] = static_cast<float>(batch);
+    }
+
+    execution.changeInputShape(input1, new_shape);
+    execution.changeInputShape(input2, new_shape);
+    execution.setInput(input1, input1_buffer.data(), num_elements * sizeof(float));
+    execution.setInput(input2, input2_buffer.data(), num_elements * sizeof(float));
+    execution.setOutput(output, output_buffer.data(), num_elements * sizeof(float));
+    execution.execute();
+
+    ASSERT_EQ(execution.getOutputShape(output).dim(0), batch);
+    for (size_t i = 0; i < num_elements; i++)
+    {
+      EXPECT_EQ(output_buffer[i], 2 * input1_buffer[i]);
+    }
+  }
+}
+
 // Support asynchronous execution
 TEST(ExecInstance, async)
 {
@@ -294,4 +646,39 @@ TEST(ExecInstance, async)
   }
 }
 
+// Loop-carried tensors alternate between two buffers, so check both parities of iterations
+TEST(ExecInstance, whileLoop)
+{
+  auto mockup = CompiledWhileMockUpModel();
+  auto executors = mockup.executors;
+  auto input_i = IOIndex{0};
+  auto input_x = IOIndex{1};
+  auto output_i = IOIndex{0};
+  auto output_x = IOIndex{1};
+
+  const float input_x_buffer[4] = {2, 1, -2, 0};
+  const float step[4] = {1, -2, 0.5, 4};
+
+  onert::exec::Execution execution{executors};
+  // Run zero, one, an odd and an even number of iterations, and repeat the first to check that
+  // the planned buffers are restored after each loop
+  for (int32_t start : {4, 3, 1, 0, 4, 1})
+  {
+    int32_t output_i_buffer[1] = {};
+    float output_x_buffer[4] = {};
+    execution.setInput(input_i, reinterpret_cast<const void *>(&start), 4);
+    execution.setInput(input_x, reinterpret_cast<const void *>(input_x_buffer), 16);
+    execution.setOutput(output_i, reinterpret_cast<void *>(output_i_buffer), 4);
+    execution.setOutput(output_x, reinterpret_cast<void *>(output_x_buffer), 16);
+    execution.execute();
+
+    const int32_t iterations = 4 - start;
+    EXPECT_EQ(output_i_buffer[0], 4);
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_x_buffer[i], input_x_buffer[i] + iterations * step[i]);
+    }
+  }
+}
+
 } // namespace
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/IPermuteFunction.h"
+
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+// Dense tensor that can report padding to make IPermuteFunction take its scalar path
+class MockTensor : public backend::ITensor
+{
+public:
+  MockTensor(const ir::Shape &shape, ir::Layout layout, ir::DataType type, bool has_padding)
+      : _shape{shape}, _layout{layout}, _type{type}, _has_padding{has_padding},
+        _data(shape.num_elements() * ir::sizeOfDataType(type))
+  {
+  }
+
+public:
+  uint8_t *buffer() const override { return const_cast<uint8_t *>(_data.data()); }
+  size_t total_size() const override { return _data.size(); }
+  size_t dimension(size_t index) const override { return _shape.dim(index); }
+  size_t num_dimensions() const override { return _shape.rank(); }
+  size_t calcOffset(const ir::Coordinates &coords) const override
+  {
+    size_t offset = 0;
+    for (size_t i = 0; i < num_dimensions(); ++i)
+      offset = offset * dimension(i) + coords[i];
+    return offset * ir::sizeOfDataType(_type);
+  }
+  ir::Layout layout() const override { return _layout; }
+  ir::DataType data_type() const override { return _type; }
+  float data_scale() const override { return 0.f; }
+  int32_t data_offset() const override { return 0; }
+  bool has_padding() const override { return _has_padding; }
+  void access(const std::function<void(ITensor &tensor)> &fn) override { fn(*this); }
+  bool is_dynamic() const override { return false; }
+
+private:
+  ir::Shape _shape;
+  ir::Layout _layout;
+  ir::DataType _type;
+  bool _has_padding;
+  std::vector<uint8_t> _data;
+};
+
+class MockPermuteFunction : public exec::IPermuteFunction
+{
+public:
+  MockPermuteFunction(backend::ITensor *src, backend::ITensor *dst,
+                      const std::shared_ptr<exec::ThreadPool> &thread_pool)
+  {
+    _src_tensors = {src};
+    _dst_tensors = {dst};
+    _thread_pool = thread_pool;
+  }
+
+  void optimize() override {}
+};
+
+// Gives each element a distinct value as far as the type allows
+void fill(backend::ITensor &tensor)
+{
+  const size_t num_elements = tensor.total_size() / ir::sizeOfDataType(tensor.data_type());
+  if (tensor.data_type() == ir::DataType::FLOAT32)
+  {
+    auto data = reinterpret_cast<float *>(tensor.buffer());
+    std::iota(data, data + num_elements, 0.f);
+  }
+  else
+  {
+    auto data = tensor.buffer();
+    for (size_t i = 0; i < num_elements; ++i)
+      data[i] = static_cast<uint8_t>(i % 251);
+  }
+}
+
+ir::Shape toNCHW(const ir::Shape &nhwc)
+{
+  return ir::Shape{nhwc.dim(0), nhwc.dim(3), nhwc.dim(1), nhwc.dim(2)};
+}
+
+// Compares the blocked transpose with the scalar permutation of padded tensors
+void verifyPermute(const ir::Shape &nhwc_shape, ir::DataType type,
+                   const std::shared_ptr<exec::ThreadPool> &thread_pool)
+{
+  const auto nchw_shape = toNCHW(nhwc_shape);
+  for (const bool to_nchw : {true, false})
+  {
+    const auto &src_shape = to_nchw ? nhwc_shape : nchw_shape;
+    const auto &dst_shape = to_nchw ? nchw_shape : nhwc_shape;
+    const auto src_layout = to_nchw ? ir::Layout::NHWC : ir::Layout::NCHW;
+    const auto dst_layout = to_nchw ? ir::Layout::NCHW : ir::Layout::NHWC;
+
+    MockTensor src{src_shape, src_layout, type, false};
+    MockTensor padded_src{src_shape, src_layout, type, true};
+    fill(src);
+    std::copy(src.buffer(), src.buffer() + src.total_size(), padded_src.buffer());
+
+    MockTensor dst{dst_shape, dst_layout, type, false};
+    MockTensor expected{dst_shape, dst_layout, type, true};
+    MockPermuteFunction{&src, &dst, thread_pool}.run();
+    MockPermuteFunction{&padded_src, &expected, nullptr}.run();
+
+    ASSERT_TRUE(std::equal(dst.buffer(), dst.buffer() + dst.total_size(), expected.buffer()))
+        << (to_nchw ? "NHWC to NCHW" : "NCHW to NHWC");
+  }
+}
+
+} // namespace
+
+TEST(PermuteKernel, NHWCAndNCHW_FLOAT32)
+{
+  // Sizes that leave partial tiles of both the cache blocks and the SIMD kernels
+  verifyPermute(ir::Shape{2, 5, 7, 11}, ir::DataType::FLOAT32, nullptr);
+  verifyPermute(ir::Shape{1, 33, 35, 4}, ir::DataType::FLOAT32, nullptr);
+  verifyPermute(ir::Shape{3, 1, 1, 3}, ir::DataType::FLOAT32, nullptr);
+}
+
+TEST(PermuteKernel, NHWCAndNCHW_UINT8)
+{
+  verifyPermute(ir::Shape{2, 5, 7, 11}, ir::DataType::QUANT_UINT8_ASYMM, nullptr);
+  verifyPermute(ir::Shape{1, 33, 35, 17}, ir::DataType::QUANT_UINT8_ASYMM, nullptr);
+  verifyPermute(ir::Shape{3, 1, 1, 3}, ir::DataType::QUANT_UINT8_ASYMM, nullptr);
+}
+
+TEST(PermuteKernel, NHWCAndNCHW_ThreadPool)
+{
+  // Large enough to be split onto threads
+  auto thread_pool = std::make_shared<exec::ThreadPool>(3);
+  verifyPermute(ir::Shape{2, 64, 67, 19}, ir::DataType::FLOAT32, thread_pool);
+  verifyPermute(ir::Shape{2, 128, 131, 19}, ir::DataType::QUANT_UINT8_ASYMM, thread_pool);
+}
+
+TEST(PermuteKernel, Copy_ThreadPool)
+{
+  auto thread_pool = std::make_shared<exec::ThreadPool>(3);
+  const ir::Shape shape{1, 100, 100, 33};
+  MockTensor src{shape, ir::Layout::NHWC, ir::DataType::FLOAT32, false};
+  MockTensor dst{shape, ir::Layout::NHWC, ir::DataType::FLOAT32, false};
+  fill(src);
+  MockPermuteFunction{&src, &dst, thread_pool}.run();
+  ASSERT_TRUE(std::equal(src.buffer(), src.buffer() + src.total_size(), dst.buffer()));
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "exec/ShapePlanCache.h"
+#include "ir/Graph.h"
+#include "ir/operation/BatchToSpaceND.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Reshape.h"
+#include "ir/operation/ResizeNearestNeighbor.h"
+#include "ir/operation/Split.h"
+#include "ir/operation/StatelessRandomUniform.h"
+#include "ir/operation/TransposeConv.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+const TypeInfo float_type{DataType::FLOAT32};
+const TypeInfo int32_type{DataType::INT32};
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const TypeInfo &type,
+                         const int32_t *data)
+{
+  auto ind = graph.addOperand(shape, type);
+  graph.operands().at(ind).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(data), shape.num_elements() * sizeof(int32_t)));
+  return ind;
+}
+
+void addBinary(Graph &graph, const OperandIndexSequence &inputs, const OperandIndex &output)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph.addOperation(
+      std::make_unique<operation::BinaryArithmetic>(inputs, OperandIndexSequence{output}, param));
+}
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(const std::shared_ptr<Graph> &graph)
+{
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  onert::compiler::Compiler compiler{subgs};
+  compiler.options().executor = "Linear";
+  compiler.options().shape_plan_cache_size = 2;
+  return compiler.compile();
+}
+
+} // namespace
+
+TEST(ShapePlanCache, isCacheable_SplitAxis)
+{
+  // Split takes its axis as the first input, and the data input does not decide shapes
+  static const int32_t axis_data[1] = {0};
+  Graph graph;
+  auto input = graph.addOperand(Shape{2, 2}, float_type);
+  auto output1 = graph.addOperand(Shape{1, 2}, float_type);
+  auto output2 = graph.addOperand(Shape{1, 2}, float_type);
+  auto axis = addConstant(graph, Shape{1}, int32_type, axis_data);
+  graph.addOperation(std::make_unique<operation::Split>(
+      OperandIndexSequence{axis, input}, OperandIndexSequence{output1, output2},
+      operation::Split::Param{2}));
+  EXPECT_TRUE(onert::exec::ShapePlanCache::isCacheable(graph));
+
+  Graph dynamic_axis_graph;
+  input = dynamic_axis_graph.addOperand(Shape{2, 2}, float_type);
+  output1 = dynamic_axis_graph.addOperand(Shape{1, 2}, float_type);
+  output2 = dynamic_axis_graph.addOperand(Shape{1, 2}, float_type);
+  axis = dynamic_axis_graph.addOperand(Shape{1}, int32_type);
+  dynamic_axis_graph.addOperation(std::make_unique<operation::Split>(
+      OperandIndexSequence{axis, input}, OperandIndexSequence{output1, output2},
+      operation::Split::Param{2}));
+  EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(dynamic_axis_graph));
+}
+
+TEST(ShapePlanCache, isCacheable_NonConstantShapeOperands)
+{
+  {
+    Graph graph;
+    auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+    auto block_size = graph.addOperand(Shape{2}, int32_type);
+    auto output = graph.addOperand(Shape{4, 1, 1, 1}, float_type);
+    graph.addOperation(std::make_unique<operation::BatchToSpaceND>(
+        OperandIndexSequence{input, block_size}, OperandIndexSequence{output}));
+    EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(graph));
+  }
+  {
+    Graph graph;
+    auto shape = graph.addOperand(Shape{2}, int32_type);
+    auto seed = graph.addOperand(Shape{2}, int32_type);
+    auto output = graph.addOperand(Shape{2, 2}, float_type);
+    graph.addOperation(std::make_unique<operation::StatelessRandomUniform>(
+        OperandIndexSequence{shape, seed}, OperandIndexSequence{output}));
+    EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(graph));
+  }
+  {
+    Graph graph;
+    auto output_shape = graph.addOperand(Shape{4}, int32_type);
+    auto kernel = graph.addOperand(Shape{1, 3, 3, 1}, float_type);
+    auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+    auto output = graph.addOperand(Shape{1, 4, 4, 1}, float_type);
+    operation::TransposeConv::Param param;
+    param.padding.type = PaddingType::SAME;
+    param.stride = Stride{2, 2};
+    graph.addOperation(std::make_unique<operation::TransposeConv>(
+        OperandIndexSequence{output_shape, kernel, input}, OperandIndexSequence{output}, param));
+    EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(graph));
+  }
+  {
+    Graph graph;
+    auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+    auto size = graph.addOperand(Shape{2}, int32_type);
+    auto output = graph.addOperand(Shape{1, 4, 4, 1}, float_type);
+    operation::ResizeNearestNeighbor::Param param;
+    param.height_out = 0;
+    param.width_out = 0;
+    param.align_corners = false;
+    param.half_pixel_centers = false;
+    graph.addOperation(std::make_unique<operation::ResizeNearestNeighbor>(
+        OperandIndexSequence{input, size}, OperandIndexSequence{output}, param));
+    EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(graph));
+  }
+}
+
+TEST(ShapePlanCache, AlternateInputShapes)
+{
+  // result1 <= lhs + rhs, result2 <= result1 + constant
+  // Running two input shapes in turn makes the second round use the recorded plans
+  static const float constant_data[1] = {10};
+  auto graph = std::make_shared<Graph>();
+  auto lhs = graph->addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto rhs = graph->addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto result1 = graph->addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto constant = graph->addOperand(Shape{1}, float_type);
+  auto result2 = graph->addOperand(Shape{1, 2, 2, 1}, float_type);
+  graph->operands().at(constant).data(
+      std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(constant_data), 4));
+  addBinary(*graph, OperandIndexSequence{lhs, rhs}, result1);
+  addBinary(*graph, OperandIndexSequence{result1, constant}, result2);
+  graph->addInput(lhs);
+  graph->addInput(rhs);
+  graph->addOutput(result2);
+  graph->finishBuilding();
+
+  EXPECT_TRUE(onert::exec::ShapePlanCache::isCacheable(*graph));
+  auto executors = compile(graph);
+
+  const std::vector<Shape> shapes{Shape{1, 2, 2, 1}, Shape{1, 3, 3, 1}};
+  for (int round = 0; round < 2; ++round)
+  {
+    for (const auto &shape : shapes)
+    {
+      const auto num_elements = shape.num_elements();
+      std::vector<float> lhs_buffer(num_elements), rhs_buffer(num_elements);
+      std::vector<float> output_buffer(9, -1);
+      for (int i = 0; i < num_elements; ++i)
+      {
+        lhs_buffer[i] = i + round;
+        rhs_buffer[i] = 2 * i;
+      }
+
+      onert::exec::Execution execution{executors};
+      execution.changeInputShape(IOIndex{0}, shape);
+      execution.changeInputShape(IOIndex{1}, shape);
+      execution.setInput(IOIndex{0}, lhs_buffer.data(), num_elements * sizeof(float));
+      execution.setInput(IOIndex{1}, rhs_buffer.data(), num_elements * sizeof(float));
+      execution.setOutput(IOIndex{0}, output_buffer.data(), output_buffer.size() * sizeof(float));
+      execution.execute();
+
+      EXPECT_EQ(execution.getOutputShape(IOIndex{0}), shape);
+      for (int i = 0; i < num_elements; ++i)
+        EXPECT_EQ(output_buffer[i], 3 * i + round + 10);
+    }
+  }
+}
+
+TEST(ShapePlanCache, NonConstantShapeOperand)
+{
+  // output <= reshape(input + input, shape) where shape is a model input
+  auto graph = std::make_shared<Graph>();
+  auto input = graph->addOperand(Shape{2, 3}, float_type);
+  auto shape = graph->addOperand(Shape{2}, int32_type);
+  auto sum = graph->addOperand(Shape{2, 3}, float_type);
+  auto output = graph->addOperand(Shape{3, 2}, float_type);
+  addBinary(*graph, OperandIndexSequence{input, input}, sum);
+  graph->addOperation(std::make_unique<operation::Reshape>(
+      OperandIndexSequence{sum, shape}, OperandIndexSequence{output}, operation::Reshape::Param{}));
+  graph->addInput(input);
+  graph->addInput(shape);
+  graph->addOutput(output);
+  graph->finishBuilding();
+
+  // The input shape alone does not decide the output shape, so plans must not be cached
+  EXPECT_FALSE(onert::exec::ShapePlanCache::isCacheable(*graph));
+  auto executors = compile(graph);
+
+  const std::vector<std::vector<int32_t>> new_shapes{{3, 2}, {1, 6}, {3, 2}, {1, 6}};
+  const float input_buffer[6] = {0, 1, 2, 3, 4, 5};
+  for (const auto &new_shape : new_shapes)
+  {
+    float output_buffer[6] = {};
+    onert::exec::Execution execution{executors};
+    execution.changeInputShape(IOIndex{0}, Shape{2, 3});
+    execution.setInput(IOIndex{0}, input_buffer, sizeof(input_buffer));
+    execution.setInput(IOIndex{1}, new_shape.data(), new_shape.size() * sizeof(int32_t));
+    execution.setOutput(IOIndex{0}, output_buffer, sizeof(output_buffer));
+    execution.execute();
+
+    EXPECT_EQ(execution.getOutputShape(IOIndex{0}), (Shape{new_shape[0], new_shape[1]}));
+    for (int i = 0; i < 6; ++i)
+      EXPECT_EQ(output_buffer[i], 2 * i);
+  }
+}
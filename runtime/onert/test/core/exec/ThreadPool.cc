@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/ThreadPool.h"
+#include "backend/cpu_common/MemoryManager.h"
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+class CountFunction : public exec::IFunction
+{
+public:
+  CountFunction(std::atomic<uint32_t> &count) : _count(count) {}
+  void run() override { ++_count; }
+
+private:
+  std::atomic<uint32_t> &_count;
+};
+
+// Enqueues another job onto the pool it runs on, as the Parallel executor does with successors
+class ChainFunction : public exec::IFunction
+{
+public:
+  ChainFunction(exec::ThreadPool &pool, std::atomic<uint32_t> &count, uint32_t depth)
+      : _pool(pool), _count(count), _depth(depth)
+  {
+  }
+  void run() override
+  {
+    ++_count;
+    if (_depth > 0)
+      _pool.enqueue(std::make_unique<ChainFunction>(_pool, _count, _depth - 1));
+  }
+
+private:
+  exec::ThreadPool &_pool;
+  std::atomic<uint32_t> &_count;
+  uint32_t _depth;
+};
+
+// Allocates and deallocates buffers of its own tensors as dynamic tensors of an operation do
+class DynamicAllocFunction : public exec::IFunction
+{
+public:
+  DynamicAllocFunction(backend::cpu_common::DynamicMemoryManager &mgr,
+                       const std::vector<const backend::ITensor *> &tensors)
+      : _mgr(mgr), _tensors(tensors)
+  {
+  }
+  void run() override
+  {
+    for (uint32_t round = 0; round < 100; ++round)
+    {
+      for (size_t i = 0; i < _tensors.size(); ++i)
+      {
+        auto alloc = _mgr.allocate(_tensors[i], 64 * (i + 1));
+        alloc->base()[0] = static_cast<uint8_t>(i);
+      }
+      for (auto tensor : _tensors)
+        _mgr.deallocate(tensor);
+    }
+  }
+
+private:
+  backend::cpu_common::DynamicMemoryManager &_mgr;
+  std::vector<const backend::ITensor *> _tensors;
+};
+
+} // namespace
+
+TEST(ThreadPool, RunAllJobs)
+{
+  exec::ThreadPool pool{4};
+  ASSERT_EQ(pool.numThreads(), 4);
+
+  std::atomic<uint32_t> count{0};
+  for (int i = 0; i < 1000; ++i)
+    pool.enqueue(std::make_unique<CountFunction>(count));
+  pool.finish();
+  ASSERT_EQ(count, 1000);
+  ASSERT_EQ(pool.numJobsInQueue(), 0);
+
+  // Workers are reused after finish()
+  for (int i = 0; i < 1000; ++i)
+    pool.enqueue(std::make_unique<CountFunction>(count));
+  pool.finish();
+  ASSERT_EQ(count, 2000);
+}
+
+TEST(ThreadPool, EnqueueFromWorker)
+{
+  exec::ThreadPool pool{4};
+  std::atomic<uint32_t> count{0};
+  for (int i = 0; i < 8; ++i)
+    pool.enqueue(std::make_unique<ChainFunction>(pool, count, 99));
+  pool.finish();
+  ASSERT_EQ(count, 800);
+}
+
+TEST(ThreadPool, EnqueueCallable)
+{
+  exec::ThreadPool pool{2};
+  ASSERT_EQ(pool.currentWorkerIndex(), -1);
+
+  std::atomic<uint32_t> count{0};
+  std::atomic<bool> on_worker{true};
+  for (int i = 0; i < 100; ++i)
+    pool.enqueue([&]() {
+      const auto index = pool.currentWorkerIndex();
+      if (index < 0 || index >= static_cast<int>(pool.numThreads()))
+        on_worker = false;
+      ++count;
+    });
+  pool.finish();
+  ASSERT_EQ(count, 100);
+  ASSERT_TRUE(on_worker);
+}
+
+TEST(ThreadPool, DynamicMemoryManager)
+{
+  // Placeholders that only serve as keys of the memory manager
+  constexpr uint32_t num_jobs = 8;
+  constexpr uint32_t num_tensors = 4;
+  std::vector<uint8_t> keys(num_jobs * num_tensors);
+
+  backend::cpu_common::DynamicMemoryManager mgr;
+  exec::ThreadPool pool{4};
+  for (uint32_t job = 0; job < num_jobs; ++job)
+  {
+    std::vector<const backend::ITensor *> tensors;
+    for (uint32_t i = 0; i < num_tensors; ++i)
+      tensors.push_back(reinterpret_cast<const backend::ITensor *>(&keys[job * num_tensors + i]));
+    pool.enqueue(std::make_unique<DynamicAllocFunction>(mgr, tensors));
+  }
+  pool.finish();
+
+  // Every buffer was deallocated, so deallocating again fails
+  ASSERT_THROW(mgr.deallocate(reinterpret_cast<const backend::ITensor *>(&keys[0])),
+               std::runtime_error);
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/CompileCache.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace onert;
+using Key = util::CompileCache::Key;
+
+namespace
+{
+
+class CompileCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/onert_compile_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    _dir = dir;
+  }
+
+  void TearDown() override
+  {
+    for (const auto &file : entries())
+      unlink(file.c_str());
+    rmdir(_dir.c_str());
+  }
+
+  std::vector<std::string> entries() const
+  {
+    std::vector<std::string> files;
+    DIR *dir = opendir(_dir.c_str());
+    if (dir == nullptr)
+      return files;
+    while (const auto *dirent = readdir(dir))
+    {
+      const std::string name = dirent->d_name;
+      if (name != "." && name != "..")
+        files.push_back(_dir + "/" + name);
+    }
+    closedir(dir);
+    return files;
+  }
+
+  // Give every entry the same old modification time so that only loads order them
+  void ageEntries() const
+  {
+    const struct timespec times[2] = {{1, 0}, {1, 0}};
+    for (const auto &file : entries())
+      utimensat(AT_FDCWD, file.c_str(), times, 0);
+  }
+
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(CompileCacheTest, StoreLoad)
+{
+  util::CompileCache cache{_dir};
+  const std::vector<float> data{1.f, 2.f, 3.f, 4.f, 5.f};
+  const auto key = Key{}.append(std::string{"StoreLoad"});
+
+  ASSERT_EQ(cache.load(key), nullptr);
+  cache.store(key, data.data(), data.size() * sizeof(float));
+  ASSERT_EQ(entries().size(), 1);
+
+  // Another instance, as in another session, sees the entry
+  util::CompileCache other{_dir};
+  auto loaded = other.load(key);
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(loaded->size(), data.size() * sizeof(float));
+  ASSERT_EQ(std::memcmp(loaded->base(), data.data(), loaded->size()), 0);
+
+  ASSERT_EQ(cache.load(Key{}.append(std::string{"Other"})), nullptr);
+}
+
+TEST_F(CompileCacheTest, TruncatedEntry)
+{
+  util::CompileCache cache{_dir};
+  const std::vector<float> data(64, 1.f);
+  const auto key = Key{}.append(std::string{"TruncatedEntry"});
+  cache.store(key, data.data(), data.size() * sizeof(float));
+  ASSERT_EQ(entries().size(), 1);
+
+  const auto file = entries().front();
+  struct stat st;
+  ASSERT_EQ(stat(file.c_str(), &st), 0);
+  ASSERT_EQ(truncate(file.c_str(), st.st_size - 4), 0);
+  ASSERT_EQ(cache.load(key), nullptr);
+
+  // Shorter than the header
+  ASSERT_EQ(truncate(file.c_str(), 16), 0);
+  ASSERT_EQ(cache.load(key), nullptr);
+}
+
+TEST_F(CompileCacheTest, MagicMismatch)
+{
+  util::CompileCache cache{_dir};
+  const std::vector<float> data(64, 1.f);
+  const auto key = Key{}.append(std::string{"MagicMismatch"});
+  cache.store(key, data.data(), data.size() * sizeof(float));
+  ASSERT_EQ(entries().size(), 1);
+
+  {
+    std::fstream fs{entries().front(), std::ios::in | std::ios::out | std::ios::binary};
+    fs.seekp(0);
+    fs.write("ONECC999", 8);
+  }
+  ASSERT_EQ(cache.load(key), nullptr);
+}
+
+TEST_F(CompileCacheTest, EvictLeastRecentlyUsed)
+{
+  // Room for two entries of a 64-byte header and 100 bytes of data
+  util::CompileCache cache{_dir, 2 * (64 + 100)};
+  const std::vector<uint8_t> data(100, 7);
+  const auto key0 = Key{}.append(0);
+  const auto key1 = Key{}.append(1);
+  const auto key2 = Key{}.append(2);
+
+  cache.store(key0, data.data(), data.size());
+  cache.store(key1, data.data(), data.size());
+  ASSERT_EQ(entries().size(), 2);
+
+  ageEntries();
+  ASSERT_NE(cache.load(key0), nullptr);
+  cache.store(key2, data.data(), data.size());
+  ASSERT_EQ(entries().size(), 2);
+  ASSERT_NE(cache.load(key0), nullptr);
+  ASSERT_EQ(cache.load(key1), nullptr);
+  ASSERT_NE(cache.load(key2), nullptr);
+
+  // An entry that never fits is not stored
+  const std::vector<uint8_t> large(1000, 7);
+  cache.store(Key{}.append(3), large.data(), large.size());
+  ASSERT_EQ(cache.load(Key{}.append(3)), nullptr);
+  ASSERT_EQ(entries().size(), 2);
+}
+
+TEST_F(CompileCacheTest, ConstantKey)
+{
+  util::CompileCache cache{_dir};
+  std::vector<float> weights(16, 1.f);
+  const auto size = weights.size() * sizeof(float);
+
+  // Unregistered constants are identified by their contents
+  const auto hashed = cache.constantKey(weights.data(), size).str();
+  ASSERT_EQ(hashed, Key{}.append(weights.data(), size).str());
+  std::vector<float> same(weights);
+  ASSERT_EQ(cache.constantKey(same.data(), size).str(), hashed);
+  weights[3] = 2.f;
+  ASSERT_NE(cache.constantKey(weights.data(), size).str(), hashed);
+
+  // Registered constants are identified without reading them
+  const auto identity = Key{}.append(std::string{"model"}).append(3u);
+  cache.addConstant(weights.data(), identity);
+  const auto registered = cache.constantKey(weights.data(), size).str();
+  weights[3] = 3.f;
+  ASSERT_EQ(cache.constantKey(weights.data(), size).str(), registered);
+  ASSERT_NE(registered, hashed);
+  ASSERT_NE(cache.constantKey(weights.data(), size / 2).str(), registered);
+}
+
+TEST_F(CompileCacheTest, HashFile)
+{
+  const auto file = _dir + "/model";
+  {
+    std::ofstream ofs{file, std::ios::binary};
+    ofs << "model contents";
+  }
+  const auto hash = util::CompileCache::hashFile(file);
+  ASSERT_FALSE(hash.empty());
+  ASSERT_EQ(hash, util::CompileCache::hashFile(file));
+  ASSERT_EQ(hash, Key{}.append(std::string{"model contents"}).str());
+
+  {
+    std::ofstream ofs{file, std::ios::binary};
+    ofs << "other contents";
+  }
+  ASSERT_NE(hash, util::CompileCache::hashFile(file));
+  ASSERT_TRUE(util::CompileCache::hashFile(_dir + "/none").empty());
+}
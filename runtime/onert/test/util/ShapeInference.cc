@@ -381,3 +381,59 @@ TEST(ShapeInference, neg_Transpose)
                  std::runtime_error);
   }
 }
+
+TEST(ShapeInference, DepthToSpace)
+{
+  Shape in_shape{1, 2, 3, 8};
+  auto infered_out_shape = onert::shape_inference::inferDepthToSpaceShape(in_shape, 2);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 1);
+  ASSERT_EQ(infered_out_shape.dim(1), 4);
+  ASSERT_EQ(infered_out_shape.dim(2), 6);
+  ASSERT_EQ(infered_out_shape.dim(3), 2);
+}
+
+TEST(ShapeInference, neg_DepthToSpace)
+{
+  Shape in_shape{1, 2, 3, 6};
+  ASSERT_THROW(onert::shape_inference::inferDepthToSpaceShape(in_shape, 2), std::runtime_error);
+}
+
+TEST(ShapeInference, ResizeBilinear)
+{
+  Shape in_shape{2, 4, 5, 3};
+  auto infered_out_shape = onert::shape_inference::inferResizeBilinearShape(in_shape, 8, 10);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 8);
+  ASSERT_EQ(infered_out_shape.dim(2), 10);
+  ASSERT_EQ(infered_out_shape.dim(3), 3);
+}
+
+TEST(ShapeInference, neg_ResizeBilinear)
+{
+  Shape in_shape{2, 4, 5, 3};
+  ASSERT_THROW(onert::shape_inference::inferResizeBilinearShape(in_shape, -1, 10),
+               std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferResizeBilinearShape(in_shape, 8, -1),
+               std::runtime_error);
+}
+
+TEST(ShapeInference, TopKV2)
+{
+  Shape in_shape{2, 3, 7};
+  auto infered_out_shape = onert::shape_inference::inferTopKV2Shape(in_shape, 4);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 4);
+}
+
+TEST(ShapeInference, neg_TopKV2)
+{
+  Shape in_shape{2, 3, 7};
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, 8), std::runtime_error);
+}
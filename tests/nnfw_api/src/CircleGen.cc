@@ -43,6 +43,13 @@ uint32_t CircleGen::addTensor(const TensorParams &params)
   return ind;
 }
 
+uint32_t CircleGen::addTensor(const TensorParams &params, float scale, int64_t zero_point)
+{
+  int ind = curSubgCtx().tensors.size();
+  curSubgCtx().tensors.emplace_back(buildTensor(params, scale, zero_point));
+  return ind;
+}
+
 void CircleGen::setInputsAndOutputs(const std::vector<int> &inputs, const std::vector<int> &outputs)
 {
   curSubgCtx().inputs = inputs;
@@ -204,9 +211,11 @@ uint32_t CircleGen::addOperatorResizeBilinear(const OperatorParams &params, bool
                                 circle::BuiltinOptions_ResizeBilinearOptions, options);
 }
 
-uint32_t CircleGen::addOperatorResizeNearestNeighbor(const OperatorParams &params)
+uint32_t CircleGen::addOperatorResizeNearestNeighbor(const OperatorParams &params,
+                                                     bool align_corners, bool half_pixel_centers)
 {
-  auto options = circle::CreateResizeNearestNeighborOptions(_fbb).Union();
+  auto options =
+      circle::CreateResizeNearestNeighborOptions(_fbb, align_corners, half_pixel_centers).Union();
   return addOperatorWithOptions(params, circle::BuiltinOperator_RESIZE_NEAREST_NEIGHBOR,
                                 circle::BuiltinOptions_ResizeNearestNeighborOptions, options);
 }
@@ -248,6 +257,14 @@ uint32_t CircleGen::addOperatorTranspose(const OperatorParams &params)
                                 circle::BuiltinOptions_TransposeOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTransposeConv(const OperatorParams &params, circle::Padding padding,
+                                             int stride_w, int stride_h)
+{
+  auto options = circle::CreateTransposeConvOptions(_fbb, padding, stride_w, stride_h).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TRANSPOSE_CONV,
+                                circle::BuiltinOptions_TransposeConvOptions, options);
+}
+
 // NOTE Please add addOperator functions ABOVE this lie
 //
 // %  How to add a new addOperatorXXX fuction
@@ -298,6 +315,19 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
                               0 /* shape_signature */);
 }
 
+flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &params, float scale,
+                                                           int64_t zero_point)
+{
+  auto shape = _fbb.CreateVector(params.shape);
+  auto name = _fbb.CreateString(params.name);
+  std::vector<float> scale_vector = {scale};
+  std::vector<int64_t> zero_point_vector = {zero_point};
+  auto quantization = circle::CreateQuantizationParametersDirect(_fbb, nullptr, nullptr,
+                                                                 &scale_vector, &zero_point_vector);
+  return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name, quantization,
+                              false /* is_variable */, 0 /* sparsity */, 0 /* shape_signature */);
+}
+
 flatbuffers::Offset<circle::SubGraph> CircleGen::buildSubGraph(const SubgraphContext &ctx)
 {
   return circle::CreateSubGraphDirect(_fbb, &ctx.tensors, &ctx.inputs, &ctx.outputs, &ctx.operators,
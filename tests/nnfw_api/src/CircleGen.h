@@ -88,6 +88,7 @@ public:
   }
   uint32_t addBuffer(const uint8_t *buf, size_t size);
   uint32_t addTensor(const TensorParams &params);
+  uint32_t addTensor(const TensorParams &params, float scale, int64_t zero_point);
   void setInputsAndOutputs(const std::vector<int> &inputs, const std::vector<int> &outputs);
   uint32_t nextSubgraph();
   CircleBuffer finish();
@@ -119,10 +120,14 @@ public:
   uint32_t addOperatorReshape(const OperatorParams &params, const Shape &new_shape);
   uint32_t addOperatorResizeBilinear(const OperatorParams &params, bool align_corners = false,
                                      bool half_pixel_centers = false);
-  uint32_t addOperatorResizeNearestNeighbor(const OperatorParams &params);
+  uint32_t addOperatorResizeNearestNeighbor(const OperatorParams &params,
+                                            bool align_corners = false,
+                                            bool half_pixel_centers = false);
   uint32_t addOperatorSplit(const OperatorParams &params, int32_t num_split);
   uint32_t addOperatorTile(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
+  uint32_t addOperatorTransposeConv(const OperatorParams &params, circle::Padding padding,
+                                    int stride_w, int stride_h);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
 
   // NOTE Please add addOperator functions ABOVE this line in ALPHABETICAL ORDER
@@ -135,6 +140,8 @@ private:
   uint32_t addOperatorCode(circle::BuiltinOperator opcode);
   flatbuffers::Offset<circle::Buffer> buildBuffer(const uint8_t *buf, size_t size);
   flatbuffers::Offset<circle::Tensor> buildTensor(const TensorParams &params);
+  flatbuffers::Offset<circle::Tensor> buildTensor(const TensorParams &params, float scale,
+                                                  int64_t zero_point);
   flatbuffers::Offset<circle::SubGraph> buildSubGraph(const SubgraphContext &ctx);
 
   SubgraphContext &curSubgCtx() { return _subgraph_contexts.back(); }
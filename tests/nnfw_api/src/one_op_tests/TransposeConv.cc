@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_TransposeConv)
+{
+  CircleGen cgen;
+  std::vector<int32_t> out_shape_data{1, 4, 4, 1};
+  uint32_t out_shape_buf = cgen.addBuffer(out_shape_data);
+  int out_shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, out_shape_buf});
+  std::vector<float> weight_data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int weight = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 4, 4, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{out_shape, weight, in}, {out}}, circle::Padding_SAME, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+      {{1, 2, 3, 4}}, {{1, 2, 5, 4, 4, 5, 14, 10, 10, 14, 36, 24, 12, 15, 34, 20}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_Quant8)
+{
+  CircleGen cgen;
+  std::vector<int32_t> out_shape_data{1, 5, 5, 1};
+  uint32_t out_shape_buf = cgen.addBuffer(out_shape_data);
+  int out_shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, out_shape_buf});
+  std::vector<uint8_t> weight_data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int weight =
+      cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_UINT8, weight_buf}, 1.0f, 0);
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_UINT8}, 1.0f, 0);
+  // The output scale is smaller than input scale * weight scale, so the multiplier exceeds one
+  int out = cgen.addTensor({{1, 5, 5, 1}, circle::TensorType::TensorType_UINT8}, 0.5f, 0);
+  cgen.addOperatorTransposeConv({{out_shape, weight, in}, {out}}, circle::Padding_VALID, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<uint8_t>(
+      {{1, 2, 3, 4}}, {{2,  4,  10, 8,  12, 8,  10, 28, 20, 24, 20, 28, 72,
+                        48, 60, 24, 30, 68, 40, 48, 42, 48, 110, 64, 72}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_TransposeConv_InvalidOutputShape)
+{
+  CircleGen cgen;
+  std::vector<int32_t> out_shape_data{1, 4, 4, 1};
+  uint32_t out_shape_buf = cgen.addBuffer(out_shape_data);
+  int out_shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, out_shape_buf});
+  std::vector<float> weight_data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int weight = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  // The output depth does not match the depth_out of the weight
+  int out = cgen.addTensor({{1, 4, 4, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{out_shape, weight, in}, {out}}, circle::Padding_SAME, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}